@@ -25,66 +25,37 @@
 //                                                                                  //
 //==================================================================================//
 
-#include <Aryiele/CodeGenerator/BlockStack.h>
+#ifndef ARYIELE_AST_ASTCACHE_H
+#define ARYIELE_AST_ASTCACHE_H
 
-namespace Aryiele {
-    std::shared_ptr<Block> BlockStack::create(bool setAsCurrent) {
-        auto block = std::make_shared<Block>();
-
-        if (current) {
-            block->parent = current;
-            current->children.emplace_back(block);
-        }
-
-        if (setAsCurrent) {
-            current = block;
-        }
-
-        return current;
-    }
-
-    std::shared_ptr<Block> BlockStack::escape() {
-        if (current->parent) {
-            current = current->parent;
-        } else {
-            current = nullptr;
-        }
-
-        return current;
-    }
-    
-    std::shared_ptr<BlockVariable> BlockStack::findVariable(const std::string& identifier) {
-        auto block = current;
-        std::shared_ptr<BlockVariable> variable = nullptr;
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <Aryiele/Common.h>
+#include <Aryiele/AST/ASTContext.h>
+#include <Aryiele/AST/Nodes/NodeRoot.h>
 
-        if (block->variables.find(identifier) != block->variables.end()) {
-            variable = current->variables[identifier];
-        }
-
-        while (!variable) {
-            block = block->parent;
-
-            if (!block) {
-                break;
-            }
-
-            if (block->variables.find(identifier) != block->variables.end()) {
-                variable = block->variables[identifier];
-            }
-        }
-
-        return variable;
-    }
-    
-    void
-    BlockStack::addVariable(const std::string &identifier, llvm::AllocaInst *instance, Node* initializationNode, bool isConstant) {
-        addVariable(identifier, std::make_shared<BlockVariable>(instance, initializationNode, isConstant));
-    }
-    
-    void BlockStack::addVariable(const std::string &identifier, std::shared_ptr<BlockVariable> variable) {
-        if (!current->variables[identifier]) {
-            current->variables[identifier] = variable;
-        }
-    }
-    
-} /* Namespace Aryiele. */
\ No newline at end of file
+namespace Aryiele {
+    // Binary copy of a parsed file, keyed by a hash of its source, so an unchanged file is neither lexed nor parsed
+    // again. Nothing in the file is an address: nodes are written in postorder, each record holding its kind, its
+    // fields and the number of nodes it takes from the ones before it, and symbols are indices into a table of
+    // names interned again on load. Integers are in the byte order of the machine, the cache is not meant to be
+    // shared between machines. Version changes with the layout of the records, or with the nodes the parser creates.
+    class ASTCache {
+    public:
+        static constexpr uint32_t Version = 5;
+
+        // FNV-1a of the source, written in the cache and checked on load, as is the one of the rest of the file.
+        static uint64_t hashSource(std::string_view source);
+        // False when the file cannot be written, or when a function body was skipped by the parser (see
+        // Parser::setLazyBodies): its tokens point into a lexer the cache would not have.
+        static bool write(const std::string& filepath, uint64_t sourceHash, NodeRoot* root);
+        // The file is mapped and the nodes created in the context in a single pass over it. Null when the file
+        // does not exist, is from another version or another source, or is damaged: its hash does not match, or a
+        // record lacks an operand or has one of a kind the parser would not have put there.
+        static NodeRoot* read(ASTContext& context, const std::string& filepath, uint64_t sourceHash);
+    };
+
+} /* Namespace Aryiele. */
+
+#endif /* ARYIELE_AST_ASTCACHE_H. */
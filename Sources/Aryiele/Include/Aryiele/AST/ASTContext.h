@@ -0,0 +1,86 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#ifndef ARYIELE_AST_ASTCONTEXT_H
+#define ARYIELE_AST_ASTCONTEXT_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Aryiele {
+    // Bump-pointer arena owning the nodes of one or more ASTs. Nodes are created in large blocks and are never freed
+    // one by one: the links between them are plain pointers, and everything goes away with the context (or clear).
+    class ASTContext {
+    public:
+        ASTContext() = default;
+        ASTContext(const ASTContext&) = delete;
+        ASTContext& operator=(const ASTContext&) = delete;
+        ~ASTContext();
+
+        template<typename T, typename... Args>
+        T* create(Args&&... args) {
+            auto object = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+
+            // Only the objects owning memory of their own (vectors, strings) are visited when the context is freed.
+            if constexpr (!std::is_trivially_destructible_v<T>)
+                m_destructors.push_back({ object, [](void* pointer) { static_cast<T*>(pointer)->~T(); } });
+
+            m_objectCount++;
+
+            return object;
+        }
+
+        void clear();
+        // Take over the objects of another context, which is left empty.
+        void merge(ASTContext& other);
+        size_t getObjectCount() const;
+        // Bytes of the blocks, used or not.
+        size_t getReservedSize() const;
+
+    private:
+        struct Destructor {
+            void* object;
+            void (*destroy)(void*);
+        };
+
+        void* allocate(size_t size, size_t alignment);
+
+        std::vector<std::unique_ptr<char[]>> m_blocks;
+        std::vector<Destructor> m_destructors;
+        char* m_current = nullptr;
+        char* m_end = nullptr;
+        size_t m_objectCount = 0;
+        size_t m_reservedSize = 0;
+    };
+
+} /* Namespace Aryiele. */
+
+#endif /* ARYIELE_AST_ASTCONTEXT_H. */
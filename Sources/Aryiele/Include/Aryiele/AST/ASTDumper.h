@@ -0,0 +1,71 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#ifndef ARYIELE_AST_ASTDUMPER_H
+#define ARYIELE_AST_ASTDUMPER_H
+
+#include <memory>
+#include <Aryiele/Common.h>
+#include <Aryiele/AST/ASTVisitor.h>
+#include <Aryiele/Parser/ParserInformation.h>
+
+namespace Aryiele {
+    // Describe a subtree as a ParserInformation tree, appended to the children of the given parent.
+    class ASTDumper : public ASTVisitor<ASTDumper, void, std::shared_ptr<ParserInformation>> {
+    public:
+        void visitLiteralArray(NodeLiteralArray* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitLiteralBoolean(NodeLiteralBoolean* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitLiteralCharacter(NodeLiteralCharacter* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitLiteralNumberFloating(NodeLiteralNumberFloating* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitLiteralNumberInteger(NodeLiteralNumberInteger* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitLiteralString(NodeLiteralString* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitOperationBinary(NodeOperationBinary* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitOperationTernary(NodeOperationTernary* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitOperationCast(NodeOperationCast* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitOperationUnary(NodeOperationUnary* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitRoot(NodeRoot* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitStatementArrayCall(NodeStatementArrayCall* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitStatementBlock(NodeStatementBlock* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitStatementBreak(NodeStatementBreak* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitStatementCase(NodeStatementCase* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitStatementContinue(NodeStatementContinue* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitStatementFor(NodeStatementFor* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitStatementFunctionCall(NodeStatementFunctionCall* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitStatementIf(NodeStatementIf* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitStatementReturn(NodeStatementReturn* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitStatementSwitch(NodeStatementSwitch* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitStatementVariable(NodeStatementVariable* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitStatementVariableDeclaration(NodeStatementVariableDeclaration* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitStatementWhile(NodeStatementWhile* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitTopFile(NodeTopFile* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitTopFunction(NodeTopFunction* node, std::shared_ptr<ParserInformation> parentNode);
+        void visitTopNamespace(NodeTopNamespace* node, std::shared_ptr<ParserInformation> parentNode);
+    };
+
+} /* Namespace Aryiele. */
+
+#endif /* ARYIELE_AST_ASTDUMPER_H. */
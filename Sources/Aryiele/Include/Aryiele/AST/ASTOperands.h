@@ -25,24 +25,20 @@
 //                                                                                  //
 //==================================================================================//
 
-#ifndef ARYIELE_CODEGENERATOR_BLOCK_H
-#define ARYIELE_CODEGENERATOR_BLOCK_H
+#ifndef ARYIELE_AST_ASTOPERANDS_H
+#define ARYIELE_AST_ASTOPERANDS_H
 
-#include <llvm/IR/Instructions.h>
+#include <vector>
 #include <Aryiele/Common.h>
-#include <Aryiele/CodeGenerator/BlockVariable.h>
+#include <Aryiele/AST/Nodes/Node.h>
 
 namespace Aryiele {
-    struct Block {
-        Block(std::shared_ptr<Block> parent = nullptr,
-              std::map<std::string, std::shared_ptr<BlockVariable>> variables = std::map<std::string, std::shared_ptr<BlockVariable>>(),
-              std::vector<std::shared_ptr<Block>> children = std::vector<std::shared_ptr<Block>>());
-
-        std::shared_ptr<Block> parent = nullptr;
-        std::map<std::string, std::shared_ptr<BlockVariable>> variables;
-        std::vector<std::shared_ptr<Block>> children;
-    };
+    // Append the nodes under this one, null ones included, in the order of its fields: the order in which the passes
+    // walking the tree without recursion visit them, and in which ASTCache writes them.
+    void getOperands(Node* node, std::vector<Node*>& operands);
+    // The same, with the addresses of the fields holding them, so that they can be replaced.
+    void getOperands(Node* node, std::vector<Node**>& operands);
 
 } /* Namespace Aryiele. */
 
-#endif /* ARYIELE_CODEGENERATOR_BLOCK_H. */
+#endif /* ARYIELE_AST_ASTOPERANDS_H. */
@@ -0,0 +1,249 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#ifndef ARYIELE_AST_ASTVISITOR_H
+#define ARYIELE_AST_ASTVISITOR_H
+
+#include <Aryiele/Common.h>
+#include <Aryiele/AST/Nodes/Node.h>
+#include <Aryiele/AST/Nodes/NodeLiteralArray.h>
+#include <Aryiele/AST/Nodes/NodeLiteralBoolean.h>
+#include <Aryiele/AST/Nodes/NodeLiteralCharacter.h>
+#include <Aryiele/AST/Nodes/NodeLiteralNumberFloating.h>
+#include <Aryiele/AST/Nodes/NodeLiteralNumberInteger.h>
+#include <Aryiele/AST/Nodes/NodeLiteralString.h>
+#include <Aryiele/AST/Nodes/NodeOperationBinary.h>
+#include <Aryiele/AST/Nodes/NodeOperationTernary.h>
+#include <Aryiele/AST/Nodes/NodeOperationCast.h>
+#include <Aryiele/AST/Nodes/NodeOperationUnary.h>
+#include <Aryiele/AST/Nodes/NodeRoot.h>
+#include <Aryiele/AST/Nodes/NodeStatementArrayCall.h>
+#include <Aryiele/AST/Nodes/NodeStatementBlock.h>
+#include <Aryiele/AST/Nodes/NodeStatementBreak.h>
+#include <Aryiele/AST/Nodes/NodeStatementCase.h>
+#include <Aryiele/AST/Nodes/NodeStatementContinue.h>
+#include <Aryiele/AST/Nodes/NodeStatementFor.h>
+#include <Aryiele/AST/Nodes/NodeStatementFunctionCall.h>
+#include <Aryiele/AST/Nodes/NodeStatementIf.h>
+#include <Aryiele/AST/Nodes/NodeStatementReturn.h>
+#include <Aryiele/AST/Nodes/NodeStatementSwitch.h>
+#include <Aryiele/AST/Nodes/NodeStatementVariable.h>
+#include <Aryiele/AST/Nodes/NodeStatementVariableDeclaration.h>
+#include <Aryiele/AST/Nodes/NodeStatementWhile.h>
+#include <Aryiele/AST/Nodes/NodeTopFile.h>
+#include <Aryiele/AST/Nodes/NodeTopFunction.h>
+#include <Aryiele/AST/Nodes/NodeTopNamespace.h>
+
+namespace Aryiele {
+    // Static dispatch over the node kinds: visit switches once on the kind and calls Derived::visitX with the node
+    // cast to its type, with no virtual call. The visitX that Derived does not define fall back on visitNode, which
+    // returns a default constructed Ret. Args are passed along to every visit.
+    template<typename Derived, typename Ret = void, typename... Args>
+    class ASTVisitor {
+    public:
+        Ret visit(Node* node, Args... args) {
+            switch (node->getType()) {
+                case Node_Root:
+                    return getDerived().visitRoot(static_cast<NodeRoot*>(node), args...);
+                case Node_TopFile:
+                    return getDerived().visitTopFile(static_cast<NodeTopFile*>(node), args...);
+                case Node_TopFunction:
+                    return getDerived().visitTopFunction(static_cast<NodeTopFunction*>(node), args...);
+                case Node_TopNamespace:
+                    return getDerived().visitTopNamespace(static_cast<NodeTopNamespace*>(node), args...);
+                case Node_LiteralArray:
+                    return getDerived().visitLiteralArray(static_cast<NodeLiteralArray*>(node), args...);
+                case Node_LiteralBoolean:
+                    return getDerived().visitLiteralBoolean(static_cast<NodeLiteralBoolean*>(node), args...);
+                case Node_LiteralCharacter:
+                    return getDerived().visitLiteralCharacter(static_cast<NodeLiteralCharacter*>(node), args...);
+                case Node_LiteralNumberFloating:
+                    return getDerived().visitLiteralNumberFloating(static_cast<NodeLiteralNumberFloating*>(node), args...);
+                case Node_LiteralNumberInteger:
+                    return getDerived().visitLiteralNumberInteger(static_cast<NodeLiteralNumberInteger*>(node), args...);
+                case Node_LiteralString:
+                    return getDerived().visitLiteralString(static_cast<NodeLiteralString*>(node), args...);
+                case Node_OperationUnary:
+                    return getDerived().visitOperationUnary(static_cast<NodeOperationUnary*>(node), args...);
+                case Node_OperationBinary:
+                    return getDerived().visitOperationBinary(static_cast<NodeOperationBinary*>(node), args...);
+                case Node_OperationTernary:
+                    return getDerived().visitOperationTernary(static_cast<NodeOperationTernary*>(node), args...);
+                case Node_OperationCast:
+                    return getDerived().visitOperationCast(static_cast<NodeOperationCast*>(node), args...);
+                case Node_StatementArrayCall:
+                    return getDerived().visitStatementArrayCall(static_cast<NodeStatementArrayCall*>(node), args...);
+                case Node_StatementBlock:
+                    return getDerived().visitStatementBlock(static_cast<NodeStatementBlock*>(node), args...);
+                case Node_StatementBreak:
+                    return getDerived().visitStatementBreak(static_cast<NodeStatementBreak*>(node), args...);
+                case Node_StatementCase:
+                    return getDerived().visitStatementCase(static_cast<NodeStatementCase*>(node), args...);
+                case Node_StatementContinue:
+                    return getDerived().visitStatementContinue(static_cast<NodeStatementContinue*>(node), args...);
+                case Node_StatementFor:
+                    return getDerived().visitStatementFor(static_cast<NodeStatementFor*>(node), args...);
+                case Node_StatementFunctionCall:
+                    return getDerived().visitStatementFunctionCall(static_cast<NodeStatementFunctionCall*>(node), args...);
+                case Node_StatementIf:
+                    return getDerived().visitStatementIf(static_cast<NodeStatementIf*>(node), args...);
+                case Node_StatementReturn:
+                    return getDerived().visitStatementReturn(static_cast<NodeStatementReturn*>(node), args...);
+                case Node_StatementSwitch:
+                    return getDerived().visitStatementSwitch(static_cast<NodeStatementSwitch*>(node), args...);
+                case Node_StatementVariable:
+                    return getDerived().visitStatementVariable(static_cast<NodeStatementVariable*>(node), args...);
+                case Node_StatementVariableDeclaration:
+                    return getDerived().visitStatementVariableDeclaration(static_cast<NodeStatementVariableDeclaration*>(node), args...);
+                case Node_StatementWhile:
+                    return getDerived().visitStatementWhile(static_cast<NodeStatementWhile*>(node), args...);
+                default:
+                    return getDerived().visitNode(node, args...);
+            }
+        }
+
+        Ret visitNode(Node* node, Args... args) {
+            return Ret();
+        }
+
+        Ret visitRoot(NodeRoot* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitTopFile(NodeTopFile* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitTopFunction(NodeTopFunction* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitTopNamespace(NodeTopNamespace* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitLiteralArray(NodeLiteralArray* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitLiteralBoolean(NodeLiteralBoolean* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitLiteralCharacter(NodeLiteralCharacter* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitLiteralNumberFloating(NodeLiteralNumberFloating* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitLiteralNumberInteger(NodeLiteralNumberInteger* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitLiteralString(NodeLiteralString* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitOperationUnary(NodeOperationUnary* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitOperationBinary(NodeOperationBinary* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitOperationTernary(NodeOperationTernary* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitOperationCast(NodeOperationCast* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitStatementArrayCall(NodeStatementArrayCall* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitStatementBlock(NodeStatementBlock* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitStatementBreak(NodeStatementBreak* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitStatementCase(NodeStatementCase* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitStatementContinue(NodeStatementContinue* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitStatementFor(NodeStatementFor* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitStatementFunctionCall(NodeStatementFunctionCall* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitStatementIf(NodeStatementIf* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitStatementReturn(NodeStatementReturn* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitStatementSwitch(NodeStatementSwitch* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitStatementVariable(NodeStatementVariable* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitStatementVariableDeclaration(NodeStatementVariableDeclaration* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+        Ret visitStatementWhile(NodeStatementWhile* node, Args... args) {
+            return getDerived().visitNode(node, args...);
+        }
+
+    private:
+        Derived& getDerived() {
+            return *static_cast<Derived*>(this);
+        }
+    };
+
+} /* Namespace Aryiele. */
+
+#endif /* ARYIELE_AST_ASTVISITOR_H. */
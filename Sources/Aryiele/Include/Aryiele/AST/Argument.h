@@ -29,13 +29,17 @@
 #define ARYIELE_AST_ARGUMENT_H
 
 #include <Aryiele/Common.h>
+#include <Aryiele/AST/Type.h>
+#include <Aryiele/Utility/SymbolTable.h>
 
 namespace Aryiele {
     struct Argument {
-        Argument(const std::string& identifier, const std::string& type);
+        Argument(Symbol identifier, Symbol type);
 
-        std::string identifier;
-        std::string type;
+        Symbol identifier;
+        Symbol type;
+        // The type named by type, set by TypeChecker.
+        const Type* valueType = nullptr;
     };
 
 } /* Namespace Aryiele. */
@@ -0,0 +1,85 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#ifndef ARYIELE_AST_ASSIGNMENTANALYSIS_H
+#define ARYIELE_AST_ASSIGNMENTANALYSIS_H
+
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+#include <Aryiele/Common.h>
+#include <Aryiele/AST/Variable.h>
+#include <Aryiele/AST/Nodes/Node.h>
+#include <Aryiele/AST/Nodes/NodeStatementVariable.h>
+#include <Aryiele/AST/Nodes/NodeTopFunction.h>
+
+namespace Aryiele {
+    // Finds the writes to the constants of a function that may not be their first one. The body is split into basic
+    // blocks the way CodeGenerator generates it, each constant declared in the function has the bit of its slot, and
+    // the bits possibly set when entering each block are propagated along the edges until nothing changes: the
+    // function is walked once whatever the number of constants. Writes to globals are not looked at, a constant global
+    // is always initialized.
+    class AssignmentAnalysis {
+    public:
+        // Replaces the results of the previous function, whose variables Resolver must have bound.
+        void analyze(NodeTopFunction* function);
+        // True when the assignment or increment writes a constant which may already be set.
+        bool isReassignment(Node* node) const;
+
+    private:
+        struct Event {
+            Slot slot;
+            bool isDeclaration;
+            bool isInitialized;
+            Node* node;
+        };
+
+        struct Block {
+            std::vector<Event> events;
+            std::vector<uint32_t> successors;
+        };
+
+        uint32_t createBlock();
+        void link(uint32_t from, uint32_t to);
+        void declare(Variable* variable);
+        void write(NodeStatementVariable* variable, Node* node);
+        void visitBody(const std::vector<Node*>& body);
+        void visit(Node* node);
+        void solve();
+
+        std::vector<Block> m_blocks;
+        uint32_t m_current = 0;
+        Slot m_slotCount = 0;
+        std::vector<bool> m_isConstant;
+        std::vector<uint32_t> m_continueTargets;
+        std::vector<uint32_t> m_breakTargets;
+        std::unordered_set<Node*> m_reassignments;
+    };
+
+} /* Namespace Aryiele. */
+
+#endif /* ARYIELE_AST_ASSIGNMENTANALYSIS_H. */
@@ -0,0 +1,65 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#ifndef ARYIELE_AST_CONSTANTFOLDER_H
+#define ARYIELE_AST_CONSTANTFOLDER_H
+
+#include <cstddef>
+#include <Aryiele/Common.h>
+#include <Aryiele/AST/ASTContext.h>
+#include <Aryiele/AST/Nodes/Node.h>
+#include <Aryiele/AST/Nodes/NodeOperationBinary.h>
+#include <Aryiele/AST/Nodes/NodeOperationCast.h>
+#include <Aryiele/AST/Nodes/NodeOperationTernary.h>
+#include <Aryiele/AST/Nodes/NodeOperationUnary.h>
+#include <Aryiele/AST/Nodes/NodeStatementIf.h>
+
+namespace Aryiele {
+    // Replaces the operations on literals by their result, and the ternaries and ifs on a boolean literal by the
+    // branch taken, before the code generator sees them. The tree must have been checked by TypeChecker: a literal
+    // takes the type it was given, the casts it inserted are folded like the other operations, and an operation is
+    // computed in its own type, which both operands have once cast. An operation is left alone when its result would
+    // be undefined or is not finite.
+    class ConstantFolder {
+    public:
+        // The number of nodes eliminated from the subtree, the new nodes are created in the context.
+        size_t fold(ASTContext& context, Node* node);
+
+    private:
+        Node* foldOperationBinary(NodeOperationBinary* node);
+        Node* foldOperationUnary(NodeOperationUnary* node);
+        Node* foldOperationTernary(NodeOperationTernary* node);
+        Node* foldOperationCast(NodeOperationCast* node);
+        Node* foldStatementIf(NodeStatementIf* node);
+
+        ASTContext* m_context = nullptr;
+        size_t m_eliminatedCount = 0;
+    };
+
+} /* Namespace Aryiele. */
+
+#endif /* ARYIELE_AST_CONSTANTFOLDER_H. */
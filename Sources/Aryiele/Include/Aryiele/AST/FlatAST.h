@@ -0,0 +1,120 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#ifndef ARYIELE_AST_FLATAST_H
+#define ARYIELE_AST_FLATAST_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <Aryiele/Common.h>
+#include <Aryiele/AST/Argument.h>
+#include <Aryiele/AST/Nodes/Node.h>
+#include <Aryiele/Parser/ParserToken.h>
+#include <Aryiele/Utility/SymbolTable.h>
+
+namespace Aryiele {
+    // Index of a node in a FlatAST.
+    typedef uint32_t FlatNode;
+
+    const FlatNode FlatNode_None = UINT32_MAX;
+
+    struct FlatOperation {
+        ParserTokenEnum type;
+        // Unary operations only, the operator is written before its operand.
+        bool left;
+    };
+
+    struct FlatFunction {
+        Symbol identifier;
+        Symbol type;
+        uint32_t firstArgument;
+        uint32_t argumentCount;
+    };
+
+    struct FlatVariable {
+        Symbol identifier;
+        Symbol type;
+        bool isConstant;
+    };
+
+    // Struct-of-arrays copy of a node tree. Nodes are stored in preorder, so a subtree is the range
+    // [node, getEnd(node)) and a full walk is a linear scan of the kinds. Each node keeps one list of children, in
+    // the order of Node::children (a missing child is a Node_Error node), except for a variable declaration whose
+    // children are the initial values of its variables. The fields of each kind live in payload tables:
+    //  - LiteralBoolean, StatementWhile (do-while): the flag itself;
+    //  - LiteralCharacter, LiteralString, TopFile (path): getString;
+    //  - LiteralNumberInteger: getInteger, LiteralNumberFloating: getDecimal;
+    //  - OperationUnary, OperationBinary: getOperation;
+    //  - StatementFunctionCall, StatementVariable, TopNamespace: the identifier symbol itself;
+    //  - StatementIf: the number of children of the if body, after the condition;
+    //  - StatementVariableDeclaration: getVariable, one per child;
+    //  - TopFunction: getFunction and getArgument.
+    class FlatAST {
+    public:
+        void build(Node* root);
+        void clear();
+        size_t getSize() const;
+        NodeEnum getKind(FlatNode node) const;
+        const std::vector<uint8_t>& getKinds() const;
+        FlatNode getParent(FlatNode node) const;
+        FlatNode getFirstChild(FlatNode node) const;
+        FlatNode getNextSibling(FlatNode node) const;
+        // Index following the last node of the subtree.
+        FlatNode getEnd(FlatNode node) const;
+        bool contains(FlatNode node, FlatNode element) const;
+        uint32_t getPayload(FlatNode node) const;
+        int64_t getInteger(FlatNode node) const;
+        double getDecimal(FlatNode node) const;
+        const std::string& getString(FlatNode node) const;
+        const FlatOperation& getOperation(FlatNode node) const;
+        const FlatFunction& getFunction(FlatNode node) const;
+        const Argument& getArgument(const FlatFunction& function, uint32_t index) const;
+        const FlatVariable& getVariable(FlatNode node, uint32_t index) const;
+
+    private:
+        FlatNode append(Node* node, FlatNode parent);
+        uint32_t appendPayload(Node* node);
+
+        std::vector<uint8_t> m_kinds;
+        std::vector<FlatNode> m_parents;
+        std::vector<FlatNode> m_firstChildren;
+        std::vector<FlatNode> m_nextSiblings;
+        std::vector<FlatNode> m_ends;
+        std::vector<uint32_t> m_payloads;
+        std::vector<int64_t> m_integers;
+        std::vector<double> m_decimals;
+        std::vector<std::string> m_strings;
+        std::vector<FlatOperation> m_operations;
+        std::vector<FlatFunction> m_functions;
+        std::vector<Argument> m_arguments;
+        std::vector<FlatVariable> m_variables;
+    };
+
+} /* Namespace Aryiele. */
+
+#endif /* ARYIELE_AST_FLATAST_H. */
@@ -28,10 +28,13 @@
 #ifndef ARYIELE_AST_NODES_NODE_H
 #define ARYIELE_AST_NODES_NODE_H
 
+#include <cassert>
 #include <Aryiele/Common.h>
 #include <Aryiele/Parser/ParserInformation.h>
 
 namespace Aryiele {
+    struct Type;
+    
     enum NodeEnum {
         Node_Error,
         
@@ -51,6 +54,7 @@ namespace Aryiele {
         Node_OperationUnary,
         Node_OperationBinary,
         Node_OperationTernary,
+        Node_OperationCast,
     
         Node_StatementArrayCall,
         Node_StatementBlock,
@@ -67,25 +71,53 @@ namespace Aryiele {
         Node_StatementWhile
     };
     
+    // Nodes are owned by the ASTContext they are created in, the links between them do not own anything.
+    // Each node type has a static Kind, passed to the Node constructor: the kind is all that isa, cast, dyn_cast and
+    // ASTVisitor look at, nodes have no virtual functions.
     struct Node {
-        explicit Node(std::vector<std::shared_ptr<Node>> children = std::vector<std::shared_ptr<Node>>(),
-            std::shared_ptr<Node> parent = nullptr);
+        explicit Node(NodeEnum kind, std::vector<Node*> children = std::vector<Node*>(),
+            Node* parent = nullptr);
+        
+        void dumpAST(std::shared_ptr<ParserInformation> parentNode);
+        std::string getTypeName();
+        int getPositionInParent();
+        bool contains(Node* element);
         
-        virtual void dumpAST(std::shared_ptr<ParserInformation> parentNode) = 0;
-        virtual NodeEnum getType() = 0;
-        virtual std::string getTypeName();
-        virtual int getPositionInParent();
-        virtual bool contains(Node* element);
+        NodeEnum getType() const {
+            return kind;
+        }
         
         static std::string getTypeName(NodeEnum nodeType);
         static int getPositionInParent(Node* node);
-        static int getPositionInParent(std::shared_ptr<Node> node);
         static bool contains(Node* element, Node* parent);
         
-        std::vector<std::shared_ptr<Node>> children;
-        std::shared_ptr<Node> parent;
+        const NodeEnum kind;
+        // Every path through the node ends in a return, set by ReturnAnalysis.
+        bool isReturning = false;
+        // Type of the value of an expression, set by TypeChecker. Null for the statements.
+        const Type* valueType = nullptr;
+        std::vector<Node*> children;
+        Node* parent;
     };
     
+    template<typename T>
+    bool isa(const Node* node) {
+        return node->getType() == T::Kind;
+    }
+    
+    template<typename T>
+    T* cast(Node* node) {
+        assert(isa<T>(node));
+        
+        return static_cast<T*>(node);
+    }
+    
+    // Null when the node is null or of another type.
+    template<typename T>
+    T* dyn_cast(Node* node) {
+        return node && isa<T>(node) ? static_cast<T*>(node) : nullptr;
+    }
+    
 } /* Namespace Aryiele. */
 
 #endif /* ARYIELE_AST_NODES_NODE_H. */
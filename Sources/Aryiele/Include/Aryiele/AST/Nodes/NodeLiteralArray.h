@@ -33,12 +33,11 @@
 
 namespace Aryiele {
     struct NodeLiteralArray : public Node {
-        explicit NodeLiteralArray(std::vector<std::shared_ptr<Node>> elements = std::vector<std::shared_ptr<Node>>());
-        
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
+        static constexpr NodeEnum Kind = Node_LiteralArray;
+
+        explicit NodeLiteralArray(std::vector<Node*> elements = std::vector<Node*>());
         
-        std::vector<std::shared_ptr<Node>> elements;
+        std::vector<Node*> elements;
     };
     
 } /* Namespace Aryiele. */
@@ -33,11 +33,10 @@
 
 namespace Aryiele {
     struct NodeLiteralBoolean : public Node {
+        static constexpr NodeEnum Kind = Node_LiteralBoolean;
+
         explicit NodeLiteralBoolean(bool value = false);
         
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
-        
         bool value;
     };
     
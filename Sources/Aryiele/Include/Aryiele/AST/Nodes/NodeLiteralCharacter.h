@@ -33,11 +33,10 @@
 
 namespace Aryiele {
     struct NodeLiteralCharacter : public Node {
+        static constexpr NodeEnum Kind = Node_LiteralCharacter;
+
         explicit NodeLiteralCharacter(const std::string& value = " ");
         
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
-        
         std::string value;
     };
     
@@ -33,10 +33,9 @@
 
 namespace Aryiele {
     struct NodeLiteralNumberFloating : public Node {
-        explicit NodeLiteralNumberFloating(double value = 0.0);
+        static constexpr NodeEnum Kind = Node_LiteralNumberFloating;
 
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
+        explicit NodeLiteralNumberFloating(double value = 0.0);
 
         double value;
     };
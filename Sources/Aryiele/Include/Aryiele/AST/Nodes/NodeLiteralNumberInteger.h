@@ -28,17 +28,19 @@
 #ifndef ARYIELE_AST_NODES_NODELITERALNUMBERINTEGER_H
 #define ARYIELE_AST_NODES_NODELITERALNUMBERINTEGER_H
 
+#include <cstdint>
 #include <Aryiele/Common.h>
 #include <Aryiele/AST/Nodes/Node.h>
 
 namespace Aryiele {
     struct NodeLiteralNumberInteger : public Node {
-        explicit NodeLiteralNumberInteger(long value = 0);
+        static constexpr NodeEnum Kind = Node_LiteralNumberInteger;
 
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
+        explicit NodeLiteralNumberInteger(int64_t value = 0, bool isUnsigned = false);
 
-        long value;
+        int64_t value;
+        // The literal is above the range of an Int64, value holds the bits of a UInt64.
+        bool isUnsigned;
     };
 
 } /* Namespace Aryiele. */
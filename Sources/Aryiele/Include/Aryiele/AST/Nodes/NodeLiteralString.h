@@ -33,11 +33,10 @@
 
 namespace Aryiele {
     struct NodeLiteralString : public Node {
+        static constexpr NodeEnum Kind = Node_LiteralString;
+
         explicit NodeLiteralString(std::string value = "");
         
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
-        
         std::string value;
     };
     
@@ -35,14 +35,13 @@
 
 namespace Aryiele {
     struct NodeOperationBinary : public Node {
-        NodeOperationBinary(ParserTokenEnum operationType, std::shared_ptr<Node> lhs, std::shared_ptr<Node> rhs);
+        static constexpr NodeEnum Kind = Node_OperationBinary;
 
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
+        NodeOperationBinary(ParserTokenEnum operationType, Node* lhs, Node* rhs);
 
         ParserTokenEnum operationType;
-        std::shared_ptr<Node> lhs;
-        std::shared_ptr<Node> rhs;
+        Node* lhs;
+        Node* rhs;
     };
 
 } /* Namespace Aryiele. */
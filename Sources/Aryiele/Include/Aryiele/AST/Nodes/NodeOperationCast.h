@@ -25,22 +25,23 @@
 //                                                                                  //
 //==================================================================================//
 
-#ifndef ARYIELE_BLOCKVARIABLE_H
-#define ARYIELE_BLOCKVARIABLE_H
+#ifndef ARYIELE_AST_NODES_NODEOPERATIONCAST_H
+#define ARYIELE_AST_NODES_NODEOPERATIONCAST_H
 
 #include <Aryiele/Common.h>
+#include <Aryiele/AST/Type.h>
 #include <Aryiele/AST/Nodes/Node.h>
-#include <llvm/IR/Instructions.h>
 
 namespace Aryiele {
-    struct BlockVariable {
-        explicit BlockVariable(llvm::AllocaInst* instance, Node* initializationNode, bool isConstant = false);
+    // Converts the value of the expression to the valueType of the node. Only created by TypeChecker.
+    struct NodeOperationCast : public Node {
+        static constexpr NodeEnum Kind = Node_OperationCast;
+
+        NodeOperationCast(Node* expression, const Type* type);
         
-        llvm::AllocaInst* instance;
-        Node* initializationNode;
-        bool isConstant;
+        Node* expression;
     };
     
 } /* Namespace Aryiele. */
 
-#endif /* ARYIELE_BLOCKVARIABLE_H. */
+#endif /* ARYIELE_AST_NODES_NODEOPERATIONCAST_H. */
@@ -35,14 +35,13 @@
 
 namespace Aryiele {
     struct NodeOperationTernary : public Node {
-        NodeOperationTernary(std::shared_ptr<Node> condition, std::shared_ptr<Node> lhs, std::shared_ptr<Node> rhs);
-        
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
+        static constexpr NodeEnum Kind = Node_OperationTernary;
+
+        NodeOperationTernary(Node* condition, Node* lhs, Node* rhs);
     
-        std::shared_ptr<Node> condition;
-        std::shared_ptr<Node> lhs;
-        std::shared_ptr<Node> rhs;
+        Node* condition;
+        Node* lhs;
+        Node* rhs;
     };
     
 } /* Namespace Aryiele. */
@@ -35,13 +35,12 @@
 
 namespace Aryiele {
     struct NodeOperationUnary : public Node {
-        NodeOperationUnary(ParserTokenEnum operationType, std::shared_ptr<Node> expression, bool left = true);
-        
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
+        static constexpr NodeEnum Kind = Node_OperationUnary;
+
+        NodeOperationUnary(ParserTokenEnum operationType, Node* expression, bool left = true);
         
         ParserTokenEnum operationType;
-        std::shared_ptr<Node> expression;
+        Node* expression;
         bool left;
     };
     
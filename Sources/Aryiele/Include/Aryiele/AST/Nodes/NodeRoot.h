@@ -33,13 +33,15 @@
 
 namespace Aryiele {
     struct NodeRoot : public Node {
-        NodeRoot(std::vector<std::shared_ptr<Node>> body);
-        
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
+        static constexpr NodeEnum Kind = Node_Root;
+
+        NodeRoot(std::vector<Node*> body);
         
-        std::vector<std::shared_ptr<Node>> body;
+        std::vector<Node*> body;
     };
+
+    // The declarations of every file of the tree in source order, the ones of a namespace in place of it.
+    std::vector<Node*> getDeclarations(NodeRoot* nodeRoot);
     
 } /* Namespace Aryiele. */
 
@@ -33,14 +33,13 @@
 
 namespace Aryiele {
     struct NodeStatementArrayCall : public Node {
-        explicit NodeStatementArrayCall(std::shared_ptr<Node> expression,
-            std::shared_ptr<Node> subExpression = nullptr);
-        
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
+        static constexpr NodeEnum Kind = Node_StatementArrayCall;
+
+        explicit NodeStatementArrayCall(Node* expression,
+            Node* subExpression = nullptr);
     
-        std::shared_ptr<Node> expression;
-        std::shared_ptr<Node> subExpression;
+        Node* expression;
+        Node* subExpression;
     };
     
 } /* Namespace Aryiele. */
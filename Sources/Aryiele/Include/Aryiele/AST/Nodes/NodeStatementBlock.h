@@ -33,12 +33,11 @@
 
 namespace Aryiele {
     struct NodeStatementBlock : public Node {
-        explicit NodeStatementBlock(std::vector<std::shared_ptr<Node>> body = std::vector<std::shared_ptr<Node>>());
+        static constexpr NodeEnum Kind = Node_StatementBlock;
 
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
+        explicit NodeStatementBlock(std::vector<Node*> body = std::vector<Node*>());
 
-        std::vector<std::shared_ptr<Node>> body;
+        std::vector<Node*> body;
     };
 
 } /* Namespace Aryiele. */
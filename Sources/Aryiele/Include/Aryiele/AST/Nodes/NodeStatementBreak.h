@@ -33,8 +33,9 @@
 
 namespace Aryiele {
     struct NodeStatementBreak : public Node {
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
+        static constexpr NodeEnum Kind = Node_StatementBreak;
+
+        NodeStatementBreak();
     };
     
 } /* Namespace Aryiele. */
@@ -33,14 +33,13 @@
 
 namespace Aryiele {
     struct NodeStatementCase : public Node {
-        NodeStatementCase(std::shared_ptr<Node> expression = nullptr,
-            std::vector<std::shared_ptr<Node>> body = std::vector<std::shared_ptr<Node>>());
-        
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
+        static constexpr NodeEnum Kind = Node_StatementCase;
+
+        NodeStatementCase(Node* expression = nullptr,
+            std::vector<Node*> body = std::vector<Node*>());
         
-        std::shared_ptr<Node> expression;
-        std::vector<std::shared_ptr<Node>> body;
+        Node* expression;
+        std::vector<Node*> body;
     };
     
 } /* Namespace Aryiele. */
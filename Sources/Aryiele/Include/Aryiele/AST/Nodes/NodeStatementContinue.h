@@ -33,8 +33,9 @@
 
 namespace Aryiele {
     struct NodeStatementContinue : public Node {
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
+        static constexpr NodeEnum Kind = Node_StatementContinue;
+
+        NodeStatementContinue();
     };
     
 } /* Namespace Aryiele. */
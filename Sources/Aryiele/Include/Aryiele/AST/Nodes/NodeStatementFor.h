@@ -35,16 +35,15 @@
 
 namespace Aryiele {
     struct NodeStatementFor : public Node {
-        NodeStatementFor(std::shared_ptr<Node> variable, std::shared_ptr<Node> condition,
-            std::shared_ptr<Node> incrementalValue, std::vector<std::shared_ptr<Node>> body);
-    
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
+        static constexpr NodeEnum Kind = Node_StatementFor;
+
+        NodeStatementFor(Node* variable, Node* condition,
+            Node* incrementalValue, std::vector<Node*> body);
     
-        std::shared_ptr<Node> condition;
-        std::shared_ptr<Node> incrementalValue;
-        std::vector<std::shared_ptr<Node>> body;
-        std::shared_ptr<Node> variable;
+        Node* condition;
+        Node* incrementalValue;
+        std::vector<Node*> body;
+        Node* variable;
     };
     
 } /* Namespace Aryiele. */
@@ -32,19 +32,19 @@
 #include <vector>
 #include <Aryiele/Common.h>
 #include <Aryiele/AST/Nodes/Node.h>
+#include <Aryiele/Utility/SymbolTable.h>
 
 namespace Aryiele {
     struct NodeStatementFunctionCall : public Node {
-        NodeStatementFunctionCall(const std::string& identifier,
-            std::vector<std::shared_ptr<Node>> arguments = std::vector<std::shared_ptr<Node>>(),
-            std::shared_ptr<Node> subExpression = nullptr);
+        static constexpr NodeEnum Kind = Node_StatementFunctionCall;
 
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
+        NodeStatementFunctionCall(Symbol identifier,
+            std::vector<Node*> arguments = std::vector<Node*>(),
+            Node* subExpression = nullptr);
         
-        std::string identifier;
-        std::vector<std::shared_ptr<Node>> arguments;
-        std::shared_ptr<Node> subExpression;
+        Symbol identifier;
+        std::vector<Node*> arguments;
+        Node* subExpression;
     };
 
 } /* Namespace Aryiele. */
@@ -33,15 +33,14 @@
 
 namespace Aryiele {
     struct NodeStatementIf : public Node {
-        NodeStatementIf(std::shared_ptr<Node> condition, std::vector<std::shared_ptr<Node>> ifBody,
-            std::vector<std::shared_ptr<Node>> elseBody = std::vector<std::shared_ptr<Node>>());
+        static constexpr NodeEnum Kind = Node_StatementIf;
 
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
+        NodeStatementIf(Node* condition, std::vector<Node*> ifBody,
+            std::vector<Node*> elseBody = std::vector<Node*>());
 
-        std::shared_ptr<Node> condition;
-        std::vector<std::shared_ptr<Node>> ifBody;
-        std::vector<std::shared_ptr<Node>> elseBody;
+        Node* condition;
+        std::vector<Node*> ifBody;
+        std::vector<Node*> elseBody;
     };
 
 } /* Namespace Aryiele. */
@@ -33,12 +33,11 @@
 
 namespace Aryiele {
     struct NodeStatementReturn : public Node {
-        NodeStatementReturn(std::shared_ptr<Node> expression = nullptr);
+        static constexpr NodeEnum Kind = Node_StatementReturn;
 
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
+        NodeStatementReturn(Node* expression = nullptr);
 
-        std::shared_ptr<Node> expression;
+        Node* expression;
     };
 
 } /* Namespace Aryiele. */
@@ -33,14 +33,13 @@
 
 namespace Aryiele {
     struct NodeStatementSwitch : public Node {
-        NodeStatementSwitch(std::shared_ptr<Node> expression, std::vector<std::shared_ptr<Node>> cases);
-        
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
+        static constexpr NodeEnum Kind = Node_StatementSwitch;
+
+        NodeStatementSwitch(Node* expression, std::vector<Node*> cases);
         bool hasDefault();
         
-        std::shared_ptr<Node> expression;
-        std::vector<std::shared_ptr<Node>> cases;
+        Node* expression;
+        std::vector<Node*> cases;
     };
     
 } /* Namespace Aryiele. */
@@ -29,17 +29,21 @@
 #define ARYIELE_AST_NODES_NODESTATEMENTVARIABLE_H
 
 #include <Aryiele/Common.h>
+#include <Aryiele/AST/Variable.h>
 #include <Aryiele/AST/Nodes/Node.h>
+#include <Aryiele/Utility/SymbolTable.h>
 
 namespace Aryiele {
     struct NodeStatementVariable : public Node {
-        explicit NodeStatementVariable(const std::string& identifier, std::shared_ptr<Node> subExpression = nullptr);
+        static constexpr NodeEnum Kind = Node_StatementVariable;
 
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
+        explicit NodeStatementVariable(Symbol identifier, Node* subExpression = nullptr);
     
-        std::string identifier;
-        std::shared_ptr<Node> subExpression;
+        Symbol identifier;
+        Node* subExpression;
+        // The declaration the identifier refers to, Slot_Unresolved when there is none in scope.
+        Slot slot = Slot_Unresolved;
+        bool isGlobal = false;
     };
 
 } /* Namespace Aryiele. */
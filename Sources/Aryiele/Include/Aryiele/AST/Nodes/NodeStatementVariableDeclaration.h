@@ -34,13 +34,12 @@
 
 namespace Aryiele {
     struct NodeStatementVariableDeclaration : public Node {
-        NodeStatementVariableDeclaration(
-                std::vector<std::shared_ptr<Variable>> variables = std::vector<std::shared_ptr<Variable>>());
+        static constexpr NodeEnum Kind = Node_StatementVariableDeclaration;
 
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
+        NodeStatementVariableDeclaration(
+                std::vector<Variable*> variables = std::vector<Variable*>());
 
-        std::vector<std::shared_ptr<Variable>> variables;
+        std::vector<Variable*> variables;
     };
 
 } /* Namespace Aryiele. */
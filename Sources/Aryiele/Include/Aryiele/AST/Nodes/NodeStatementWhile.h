@@ -34,14 +34,13 @@
 
 namespace Aryiele {
     struct NodeStatementWhile : public Node {
-        NodeStatementWhile(bool doOnce, std::shared_ptr<Node> condition, std::vector<std::shared_ptr<Node>> body);
-        
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
+        static constexpr NodeEnum Kind = Node_StatementWhile;
+
+        NodeStatementWhile(bool doOnce, Node* condition, std::vector<Node*> body);
         
         bool doOnce;
-        std::shared_ptr<Node> condition;
-        std::vector<std::shared_ptr<Node>> body;
+        Node* condition;
+        std::vector<Node*> body;
     };
     
 } /* Namespace Aryiele. */
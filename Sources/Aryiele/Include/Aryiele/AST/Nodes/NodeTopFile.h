@@ -34,13 +34,12 @@
 
 namespace Aryiele {
     struct NodeTopFile : public Node {
-        NodeTopFile(const std::string& path, std::vector<std::shared_ptr<Node>> body);
-        
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
+        static constexpr NodeEnum Kind = Node_TopFile;
+
+        NodeTopFile(const std::string& path, std::vector<Node*> body);
         
         std::string path;
-        std::vector<std::shared_ptr<Node>> body;
+        std::vector<Node*> body;
     };
     
 } /* Namespace Aryiele. */
@@ -31,19 +31,27 @@
 #include <Aryiele/Common.h>
 #include <Aryiele/AST/Nodes/Node.h>
 #include <Aryiele/AST/Argument.h>
+#include <Aryiele/AST/Variable.h>
+#include <Aryiele/Parser/ParserToken.h>
 
 namespace Aryiele {
     struct NodeTopFunction : public Node {
-        NodeTopFunction(const std::string& identifier, const std::string& type, std::vector<Argument> argumentsName,
-            std::vector<std::shared_ptr<Node>> body);
+        static constexpr NodeEnum Kind = Node_TopFunction;
 
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
+        NodeTopFunction(Symbol identifier, Symbol type, std::vector<Argument> argumentsName,
+            std::vector<Node*> body);
 
-        std::string identifier;
-        std::string type;
+        Symbol identifier;
+        Symbol type;
         std::vector<Argument> arguments;
-        std::vector<std::shared_ptr<Node>> body;
+        std::vector<Node*> body;
+        // Tokens of a body the parser skipped (see Parser::setLazyBodies), up to its closing curly bracket. The body
+        // stays empty until Parser::parseLazyBody parses them.
+        std::vector<ParserToken> lazyBody;
+        // Number of slots of the arguments and variables, once resolved.
+        Slot slotCount = 0;
+        // The type named by type, set by TypeChecker with the ones of the arguments.
+        const Type* returnType = nullptr;
     };
 
 } /* Namespace Aryiele. */
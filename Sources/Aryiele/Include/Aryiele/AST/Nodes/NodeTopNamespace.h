@@ -34,13 +34,12 @@
 
 namespace Aryiele {
     struct NodeTopNamespace : public Node {
-        NodeTopNamespace(const std::string& identifier, std::vector<std::shared_ptr<Node>> body);
-        
-        void dumpAST(std::shared_ptr<ParserInformation> parentNode) override;
-        NodeEnum getType() override;
+        static constexpr NodeEnum Kind = Node_TopNamespace;
+
+        NodeTopNamespace(Symbol identifier, std::vector<Node*> body);
         
-        std::string identifier;
-        std::vector<std::shared_ptr<Node>> body;
+        Symbol identifier;
+        std::vector<Node*> body;
     };
     
 } /* Namespace Aryiele. */
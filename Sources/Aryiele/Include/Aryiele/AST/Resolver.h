@@ -0,0 +1,71 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#ifndef ARYIELE_AST_RESOLVER_H
+#define ARYIELE_AST_RESOLVER_H
+
+#include <unordered_map>
+#include <vector>
+#include <Aryiele/Common.h>
+#include <Aryiele/AST/Variable.h>
+#include <Aryiele/AST/Nodes/Node.h>
+#include <Aryiele/AST/Nodes/NodeRoot.h>
+#include <Aryiele/AST/Nodes/NodeTopFunction.h>
+#include <Aryiele/Utility/SymbolTable.h>
+
+namespace Aryiele {
+    // Binds every variable to the declaration it refers to ahead of the code generator, with the scopes the code
+    // generator had: the function, each block, each body of an if, loop or case. The arguments and variables of a
+    // function are numbered in the order they are declared, a declaration shadowing the ones before it; the globals
+    // are numbered across the whole tree, a function seeing all of them and a global the ones declared before it.
+    class Resolver {
+    public:
+        // The functions whose body was skipped are left for the overload below.
+        void resolve(NodeRoot* nodeRoot);
+        // A function parsed after the rest of the tree, every global being visible.
+        void resolve(NodeTopFunction* function);
+        Slot getGlobalCount() const;
+
+    private:
+        void pushScope();
+        void popScope();
+        Slot declare(Symbol identifier);
+        void visitBody(const std::vector<Node*>& body);
+        void visit(Node* node);
+
+        std::unordered_map<Symbol, Slot> m_globals;
+        Slot m_globalCount = 0;
+        std::unordered_map<Symbol, Slot> m_variables;
+        // Slot each scope hides, Slot_Unresolved when the identifier was not declared before.
+        std::vector<std::pair<Symbol, Slot>> m_shadowedVariables;
+        std::vector<size_t> m_scopes;
+        Slot m_slotCount = 0;
+    };
+
+} /* Namespace Aryiele. */
+
+#endif /* ARYIELE_AST_RESOLVER_H. */
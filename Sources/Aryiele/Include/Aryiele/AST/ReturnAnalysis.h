@@ -0,0 +1,52 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#ifndef ARYIELE_AST_RETURNANALYSIS_H
+#define ARYIELE_AST_RETURNANALYSIS_H
+
+#include <vector>
+#include <Aryiele/Common.h>
+#include <Aryiele/AST/Nodes/Node.h>
+
+namespace Aryiele {
+    // Whether every path through a node ends in a return: a return, an if whose both bodies return, a loop whose
+    // body returns, a switch with a default whose every case returns, a ternary whose both sides return, or a
+    // function returning void or whose body returns. A body returns when one of its statements does.
+    class ReturnAnalysis {
+    public:
+        // Sets Node::isReturning on every node of the subtree, from the leaves up, each node being looked at once.
+        static void analyze(Node* node);
+        // From the bits set by analyze.
+        static bool isReturning(const std::vector<Node*>& body);
+        // The answer of analyze for the node alone, walking its subtree instead of reading the bits.
+        static bool walk(Node* node);
+        static bool walk(const std::vector<Node*>& body);
+    };
+
+} /* Namespace Aryiele. */
+
+#endif /* ARYIELE_AST_RETURNANALYSIS_H. */
@@ -0,0 +1,84 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#ifndef ARYIELE_AST_TYPE_H
+#define ARYIELE_AST_TYPE_H
+
+#include <cstdint>
+#include <string>
+#include <Aryiele/Common.h>
+#include <Aryiele/Utility/SymbolTable.h>
+
+namespace Aryiele {
+    enum TypeEnum {
+        Type_Integer,
+        Type_Float,
+        Type_Double,
+        Type_Boolean,
+        Type_String,
+        Type_Character,
+        Type_Void
+    };
+
+    // Types are interned: each one exists once, as a static member below, so two types are the same when their
+    // pointers are. Int and UInt are the 64 bits integers under another name.
+    struct Type {
+        bool isInteger() const;
+        bool isFloating() const;
+        // Integers and floating values, on which the arithmetic and comparison operators work.
+        bool isArithmetic() const;
+        std::string getName() const;
+
+        // Null when the name is not the one of a type.
+        static const Type* get(Symbol name);
+        static const Type* getInteger(uint32_t width, bool isSigned);
+
+        const TypeEnum kind;
+        // Bits of an integer or floating value, zero for the other types.
+        const uint32_t width;
+        const bool isSigned;
+        const Symbol name;
+
+        static const Type Int8;
+        static const Type Int16;
+        static const Type Int32;
+        static const Type Int64;
+        static const Type UInt8;
+        static const Type UInt16;
+        static const Type UInt32;
+        static const Type UInt64;
+        static const Type Float;
+        static const Type Double;
+        static const Type Boolean;
+        static const Type String;
+        static const Type Character;
+        static const Type Void;
+    };
+
+} /* Namespace Aryiele. */
+
+#endif /* ARYIELE_AST_TYPE_H. */
@@ -0,0 +1,112 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#ifndef ARYIELE_AST_TYPECHECKER_H
+#define ARYIELE_AST_TYPECHECKER_H
+
+#include <unordered_map>
+#include <vector>
+#include <Aryiele/Common.h>
+#include <Aryiele/AST/ASTContext.h>
+#include <Aryiele/AST/ASTVisitor.h>
+#include <Aryiele/AST/Type.h>
+#include <Aryiele/AST/Variable.h>
+#include <Aryiele/Utility/SymbolTable.h>
+
+namespace Aryiele {
+    // Gives its Type to every expression, from the types the variables, arguments and functions are declared with,
+    // and makes the conversions explicit: a NodeOperationCast is inserted wherever a value is used as another type
+    // than its own, so that CodeGenerator and ConstantFolder only see operations on operands of the same type.
+    // Integer literals are an Int32, or an Int64 or a UInt64 when their value needs it, unless used as an integer type
+    // holding their value, and floating literals are a Double unless used as a Float. The operands of a binary
+    // operation or a ternary are widened to a common type, and conditions are converted to Boolean. A variable
+    // declared without a type has the one of its value.
+    // Variables must have been bound by Resolver.
+    class TypeChecker : private ASTVisitor<TypeChecker, const Type*> {
+        friend class ASTVisitor<TypeChecker, const Type*>;
+
+    public:
+        // Resolves the signatures of all the functions, then checks the globals and the bodies which were parsed.
+        // False when an error was logged.
+        bool check(ASTContext& context, NodeRoot* nodeRoot);
+        // A body parsed after the rest of the tree.
+        bool check(ASTContext& context, NodeTopFunction* function);
+        // A function called without being declared in the tree, as the ones of the code generator.
+        void declareFunction(Symbol identifier, const Type* returnType, std::vector<const Type*> argumentTypes);
+
+    private:
+        struct Signature {
+            const Type* returnType;
+            std::vector<const Type*> argumentTypes;
+        };
+
+        // Null when the name is not the one of a type, after logging it.
+        const Type* resolveType(Symbol name);
+        void declareFunction(NodeTopFunction* function);
+        void checkFunction(NodeTopFunction* function);
+        void checkBody(const std::vector<Node*>& body);
+        void checkVariable(Variable* variable, bool isGlobal);
+        // Void for the nodes without a value, null when an error was logged.
+        const Type* check(Node* node);
+        // Type of the expression once converted to the given one, null when it cannot be.
+        const Type* convert(Node*& expression, const Type* type);
+        bool insertCast(Node*& expression, const Type* expressionType, const Type* type);
+
+        const Type* visitNode(Node* node);
+        const Type* visitLiteralArray(NodeLiteralArray* node);
+        const Type* visitLiteralBoolean(NodeLiteralBoolean* node);
+        const Type* visitLiteralCharacter(NodeLiteralCharacter* node);
+        const Type* visitLiteralNumberFloating(NodeLiteralNumberFloating* node);
+        const Type* visitLiteralNumberInteger(NodeLiteralNumberInteger* node);
+        const Type* visitLiteralString(NodeLiteralString* node);
+        const Type* visitOperationUnary(NodeOperationUnary* node);
+        const Type* visitOperationBinary(NodeOperationBinary* node);
+        const Type* visitOperationTernary(NodeOperationTernary* node);
+        const Type* visitOperationCast(NodeOperationCast* node);
+        const Type* visitStatementArrayCall(NodeStatementArrayCall* node);
+        const Type* visitStatementBlock(NodeStatementBlock* node);
+        const Type* visitStatementFor(NodeStatementFor* node);
+        const Type* visitStatementFunctionCall(NodeStatementFunctionCall* node);
+        const Type* visitStatementIf(NodeStatementIf* node);
+        const Type* visitStatementReturn(NodeStatementReturn* node);
+        const Type* visitStatementSwitch(NodeStatementSwitch* node);
+        const Type* visitStatementVariable(NodeStatementVariable* node);
+        const Type* visitStatementVariableDeclaration(NodeStatementVariableDeclaration* node);
+        const Type* visitStatementWhile(NodeStatementWhile* node);
+
+        ASTContext* m_context = nullptr;
+        std::unordered_map<Symbol, Signature> m_signatures;
+        // Types of the variables of the function being checked and of the globals, by slot.
+        std::vector<const Type*> m_variableTypes;
+        std::vector<const Type*> m_globalTypes;
+        const Type* m_returnType = nullptr;
+        bool m_isInFunction = false;
+    };
+
+} /* Namespace Aryiele. */
+
+#endif /* ARYIELE_AST_TYPECHECKER_H. */
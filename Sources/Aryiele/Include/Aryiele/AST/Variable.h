@@ -28,18 +28,29 @@
 #ifndef ARYIELE_AST_VARIABLE_H
 #define ARYIELE_AST_VARIABLE_H
 
+#include <cstdint>
 #include <Aryiele/Common.h>
+#include <Aryiele/AST/Type.h>
 #include <Aryiele/AST/Nodes/Node.h>
+#include <Aryiele/Utility/SymbolTable.h>
 
 namespace Aryiele {
+    // Index of a variable among those of its function, its arguments first, or among the globals. Given by Resolver.
+    typedef uint32_t Slot;
+
+    constexpr Slot Slot_Unresolved = UINT32_MAX;
+
     struct Variable {
-        Variable(const std::string &identifier, const std::string &type, bool isConstant,
-                 std::shared_ptr<Node> expression = nullptr);
+        Variable(Symbol identifier, Symbol type, bool isConstant,
+                 Node* expression = nullptr);
 
-        std::string identifier;
-        std::string type;
+        Symbol identifier;
+        Symbol type;
         bool isConstant;
-        std::shared_ptr<Node> expression;
+        Node* expression;
+        Slot slot = Slot_Unresolved;
+        // The type named by type, or the one of the expression when there is none. Set by TypeChecker.
+        const Type* valueType = nullptr;
     };
 
 } /* Namespace Aryiele. */
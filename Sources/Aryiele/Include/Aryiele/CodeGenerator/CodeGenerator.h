@@ -28,6 +28,7 @@
 #ifndef ARYIELE_CODEGENERATOR_CODEGENERATOR_H
 #define ARYIELE_CODEGENERATOR_CODEGENERATOR_H
 
+#include <unordered_map>
 #include <llvm/ADT/APFloat.h>
 #include <llvm/ADT/STLExtras.h>
 #include <llvm/IR/BasicBlock.h>
@@ -47,6 +48,12 @@
 #include <llvm/IR/LegacyPassManager.h>
 #include <Vanir/Module/Module.h>
 #include <Aryiele/Common.h>
+#include <Aryiele/AST/ASTContext.h>
+#include <Aryiele/AST/AssignmentAnalysis.h>
+#include <Aryiele/AST/Resolver.h>
+#include <Aryiele/AST/Type.h>
+#include <Aryiele/AST/TypeChecker.h>
+#include <Aryiele/AST/Nodes/NodeLiteralBoolean.h>
 #include <Aryiele/AST/Nodes/NodeLiteralNumberFloating.h>
 #include <Aryiele/AST/Nodes/NodeLiteralNumberInteger.h>
 #include <Aryiele/AST/Nodes/NodeTopFunction.h>
@@ -63,69 +70,96 @@
 #include <Aryiele/AST/Nodes/NodeStatementReturn.h>
 #include <Aryiele/AST/Nodes/NodeStatementVariableDeclaration.h>
 #include <Aryiele/AST/Nodes/NodeStatementVariable.h>
+#include <Aryiele/AST/ASTVisitor.h>
 #include <Aryiele/AST/Nodes/NodeRoot.h>
-#include <Aryiele/CodeGenerator/BlockStack.h>
 #include <Aryiele/CodeGenerator/GenerationError.h>
 #include <Aryiele/CodeGenerator/Function.h>
 #include <Aryiele/AST/Nodes/NodeStatementBreak.h>
 #include <Aryiele/AST/Nodes/NodeStatementContinue.h>
 #include <Aryiele/AST/Nodes/NodeRoot.h>
+#include <Aryiele/Utility/SymbolTable.h>
 
 namespace Aryiele {
     class Node;
 
-    class CodeGenerator : public Vanir::Module<CodeGenerator> {
+    class CodeGenerator : public Vanir::Module<CodeGenerator>, private ASTVisitor<CodeGenerator, GenerationError> {
+        friend class ASTVisitor<CodeGenerator, GenerationError>;
+        
     public:
         CodeGenerator(const std::string& filename);
         
-        void generateCode(std::shared_ptr<NodeRoot> nodeRoot);
+        // Function bodies the parser skipped are parsed in the context once called, starting from main, functions
+        // never called are not generated.
+        void generateCode(ASTContext& context, NodeRoot* nodeRoot);
         std::shared_ptr<llvm::Module> getModule();
+        // Nodes ConstantFolder eliminated from the checked tree and the lazy bodies generated so far.
+        size_t getEliminatedNodeCount() const;
         
     private:
-        llvm::Type* getType(const std::string& type);
-        llvm::Value* getTypeDefaultValue(llvm::Type* type);
-        llvm::Value* getTypeDefaultValue(const std::string& type);
-        llvm::Value* getTypeDefaultStep(llvm::Type* type);
-        llvm::Value* getTypeDefaultStep(const std::string& type);
-        llvm::Value* castType(llvm::Value *value, llvm::Type *returnType, bool isSigned = true);
+        // Once the returns of the function are analyzed, on the tree as written.
+        void checkReturns(NodeTopFunction* node);
+        // Once the node is checked, its returns analyzed and their errors logged.
+        void foldConstants(ASTContext& context, Node* node);
+        llvm::Type* getType(const Type* type);
+        llvm::Value* getTypeDefaultValue(const Type* type);
+        llvm::Value* getTypeDefaultStep(const Type* type);
+        // The arithmetic or comparison operation on two values of the type, null for the other operators.
+        llvm::Value* createOperation(ParserTokenEnum operation, llvm::Value* lhs, llvm::Value* rhs, const Type* type);
+        // Declares the function on its first reference when its body was skipped, and queues it for generateCode.
+        llvm::Function* findFunction(Symbol identifier);
+        llvm::Function* declareFunction(NodeTopFunction* node);
+        // The storage Resolver bound the variable to, nullptr when it is unknown or of the other kind.
+        llvm::AllocaInst* findVariable(NodeStatementVariable* node);
+        llvm::GlobalVariable* findGlobal(NodeStatementVariable* node);
         llvm::AllocaInst *createEntryBlockAllocation(
             llvm::Function *function, const std::string &identifier, llvm::Type *type = nullptr);
-        GenerationError generateCode(std::shared_ptr<Node> node);
-        GenerationError generateCode(std::vector<std::shared_ptr<Node>> node);
+        GenerationError generateCode(Node* node);
+        GenerationError generateCode(std::vector<Node*> node);
         
-        GenerationError generateCode(NodeTopFunction* node);
-        GenerationError generateCode(NodeLiteralNumberFloating* node);
-        GenerationError generateCode(NodeLiteralNumberInteger* node);
-        GenerationError generateCode(NodeOperationUnary* node);
-        GenerationError generateCode(NodeOperationBinary* node);
-        GenerationError generateCode(NodeOperationTernary* node);
-        GenerationError generateCode(NodeStatementBlock* node);
-        GenerationError generateCode(NodeStatementBreak* node);
-        GenerationError generateCode(NodeStatementContinue* node);
-        GenerationError generateCode(NodeStatementFor* node);
-        GenerationError generateCode(NodeStatementFunctionCall* node);
-        GenerationError generateCode(NodeStatementIf* node);
-        GenerationError generateCode(NodeStatementReturn* node);
-        GenerationError generateCode(NodeStatementSwitch* node);
-        GenerationError generateCode(NodeStatementVariable* node);
-        GenerationError generateCode(NodeStatementVariableDeclaration* node);
-        GenerationError generateCode(NodeStatementWhile* node);
+        GenerationError visitTopFunction(NodeTopFunction* node);
+        GenerationError visitLiteralBoolean(NodeLiteralBoolean* node);
+        GenerationError visitLiteralNumberFloating(NodeLiteralNumberFloating* node);
+        GenerationError visitLiteralNumberInteger(NodeLiteralNumberInteger* node);
+        GenerationError visitOperationUnary(NodeOperationUnary* node);
+        GenerationError visitOperationBinary(NodeOperationBinary* node);
+        GenerationError visitOperationTernary(NodeOperationTernary* node);
+        GenerationError visitOperationCast(NodeOperationCast* node);
+        GenerationError visitStatementBlock(NodeStatementBlock* node);
+        GenerationError visitStatementBreak(NodeStatementBreak* node);
+        GenerationError visitStatementContinue(NodeStatementContinue* node);
+        GenerationError visitStatementFor(NodeStatementFor* node);
+        GenerationError visitStatementFunctionCall(NodeStatementFunctionCall* node);
+        GenerationError visitStatementIf(NodeStatementIf* node);
+        GenerationError visitStatementReturn(NodeStatementReturn* node);
+        GenerationError visitStatementSwitch(NodeStatementSwitch* node);
+        GenerationError visitStatementVariable(NodeStatementVariable* node);
+        GenerationError visitStatementVariableDeclaration(NodeStatementVariableDeclaration* node);
+        GenerationError visitStatementWhile(NodeStatementWhile* node);
     
-        bool isVariableSet(const std::string& identifier, Node* startPosition, Node* breakPosition, bool global);
-        
+        // Read the bits ReturnAnalysis set, once per function, before its generation.
         static bool allPathsReturn(Node* node);
-        static bool allPathsReturn(std::shared_ptr<Node> node);
-        static bool allPathsReturn(std::vector<std::shared_ptr<Node>> node);
+        static bool allPathsReturn(const std::vector<Node*>& nodes);
         
         llvm::LLVMContext m_context;
         llvm::IRBuilder<> m_builder = llvm::IRBuilder<>(m_context);
         std::shared_ptr<llvm::DataLayout> m_dataLayout;
         std::shared_ptr<llvm::Module> m_module;
-        std::shared_ptr<BlockStack> m_blockStack;
+        Resolver m_resolver;
+        TypeChecker m_typeChecker;
+        // Allocations of the arguments and variables of the function being generated, by slot.
+        std::vector<llvm::AllocaInst*> m_variables;
+        // Writes to the constants of the function being generated which may not be their first one.
+        AssignmentAnalysis m_assignmentAnalysis;
+        // Functions of m_module by identifier, so lookups don't go through their names, and globals by slot.
+        std::unordered_map<Symbol, llvm::Function*> m_functions;
+        std::vector<llvm::GlobalVariable*> m_globals;
+        // Functions with a skipped body that nothing called yet, and the called ones waiting for their body.
+        std::unordered_map<Symbol, NodeTopFunction*> m_lazyFunctions;
+        std::vector<NodeTopFunction*> m_pendingFunctions;
         std::vector<llvm::BasicBlock*> m_continueList;
         std::vector<llvm::BasicBlock*> m_breakList;
-        std::shared_ptr<NodeRoot> m_root;
-        bool m_isInFunction;
+        size_t m_eliminatedNodeCount = 0;
+        bool m_isInFunction = false;
     };
     
     CodeGenerator &getCodeGenerator();
@@ -31,18 +31,16 @@
 #include <llvm/IR/Type.h>
 #include <Aryiele/Common.h>
 #include <Aryiele/CodeGenerator/FunctionArgument.h>
-#include <Aryiele/CodeGenerator/BlockStack.h>
+#include <Aryiele/Utility/SymbolTable.h>
 
 namespace Aryiele {
     struct Function {
-        Function(const std::string &identifier, llvm::Type *returnType,
-                 std::vector<std::shared_ptr<FunctionArgument>> arguments,
-                 std::shared_ptr<BlockStack> blocks);
+        Function(Symbol identifier, llvm::Type *returnType,
+                 std::vector<std::shared_ptr<FunctionArgument>> arguments);
 
-        std::string identifier;
+        Symbol identifier;
         llvm::Type *returnType;
         std::vector<std::shared_ptr<FunctionArgument>> arguments;
-        std::shared_ptr<BlockStack> blocks;
     };
 
 } /* Namespace Aryiele. */
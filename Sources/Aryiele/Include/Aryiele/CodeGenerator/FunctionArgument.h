@@ -30,12 +30,13 @@
 
 #include <llvm/IR/Type.h>
 #include <Aryiele/Common.h>
+#include <Aryiele/Utility/SymbolTable.h>
 
 namespace Aryiele {
     struct FunctionArgument {
-        FunctionArgument(const std::string& identifier, llvm::Type *type);
+        FunctionArgument(Symbol identifier, llvm::Type *type);
 
-        std::string identifier;
+        Symbol identifier;
         llvm::Type *type;
     };
 
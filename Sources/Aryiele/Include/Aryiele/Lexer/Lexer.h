@@ -28,19 +28,75 @@
 #ifndef ARYIELE_LEXER_LEXER_H
 #define ARYIELE_LEXER_LEXER_H
 
+#include <deque>
+#include <memory>
+#include <string_view>
 #include <vector>
 #include <Vanir/Module/Module.h>
 #include <Aryiele/Common.h>
 #include <Aryiele/Lexer/LexerToken.h>
+#include <Aryiele/Lexer/LexerTrivia.h>
+#include <Aryiele/Lexer/LexerLiteral.h>
+#include <Aryiele/Lexer/LexerMode.h>
+#include <Aryiele/Lexer/SourceBuffer.h>
+#include <Aryiele/Parser/ParserToken.h>
+#include <Aryiele/Utility/SymbolTable.h>
 
 namespace Aryiele {
+    // State of the lexer at the start of a line, recorded on the newline token ending the previous line. A line
+    // never starts inside a string: no newline token is emitted while a string is open.
+    enum LexerLineState {
+        LexerLineState_CommentMultiLine = 1,
+        // A '+' or '-' starting the line is unary.
+        LexerLineState_OperandExpected = 2
+    };
+
 class Lexer : public Vanir::Module<Lexer> {
     public:
-        std::vector<LexerToken> lex(const std::string& filepath);
+        // Contents and trivia of the returned tokens stay valid until the next lex or open.
+        std::vector<ParserToken> lex(const std::string& filepath, LexerMode mode = LexerMode_SinglePass);
+        // Start lexing a file line by line with lexLine (single-pass only), see TokenStream.
+        bool open(const std::string& filepath, bool isTriviaKept = true);
+        // Lex the next line of the opened file, false once the whole file is lexed.
+        bool lexLine();
+        // Hand the tokens lexed since the last call over, replacing the content of the vector.
+        void takeTokens(std::vector<ParserToken>& tokens);
+        // Apply an edit to the source of the tokens returned by the last single-pass lex, lexing again from the
+        // line of the edit until a newline lines up with the previous tokens again. Contents of the tokens and the
+        // trivia table are kept valid (previous literals and rewritten contents stay allocated).
+        SourceEditDamage relex(std::vector<ParserToken>& tokens, const SourceEdit& edit);
+        // Number of threads used by LexerMode_Parallel, 0 uses every hardware thread.
+        void setThreadCount(size_t threadCount);
+        std::string_view getContent(const ParserToken& token) const;
+        // Decoded value of a ParserToken_LiteralValueInteger or ParserToken_LiteralValueDecimal token.
+        int64_t getInteger(const ParserToken& token) const;
+        // Whether the integer of the token is above the range of an Int64, getInteger then returning its bits.
+        bool isUnsignedInteger(const ParserToken& token) const;
+        double getDecimal(const ParserToken& token) const;
+        const std::vector<LexerTrivia>& getTrivia() const;
+        std::shared_ptr<SourceBuffer> getSource();
         
     private:
+        // Emit a token and remember if it allows a following '-' to start a negative number.
+        void addToken(size_t offset, std::string_view content, LexerTokenEnum type, bool allowUnary);
+        // Record spaces or a comment in the trivia table.
+        void addTrivia(size_t offset, size_t length);
+        // Classify a token for the parser (keywords, unary '+' and '-'), unknown operators and separators are dropped.
+        void classifyToken(size_t offset, std::string_view content, LexerTokenEnum type);
+        // Lex the file as newline-aligned chunks on several threads, merged in order into a single-pass result.
+        void lexParallel();
+        // Prepare this Lexer to lex the lines in [begin, end) of the parent source from a clean state.
+        void openChunk(const Lexer& parent, size_t begin, size_t end);
+        // Append the tokens of a chunk lexed from a clean state, the current state being the real one at its start.
+        void mergeChunk(Lexer& chunk);
+        // Decode the value of a number token ('12', '-0x1F', '0b101', '1_000', '1.5') into the literal table.
+        void decodeNumber(ParserToken& token, size_t offset, std::string_view content);
+        // Chunk lexers defer their errors to mergeChunk, which reports them in source order.
+        void reportError(size_t offset, std::string message);
+        // Keep a rewritten token content alive as long as the tokens (escaped strings, merged tokens).
+        std::string_view keepContent(std::string content);
         // First pass of the Lexer (separate all characters by expression with a finite-state machine).
-        void stateMachine(std::string expression);
+        void stateMachine(std::string_view expression);
         // Second pass of the Lexer (remove all comments as their ain't useful).
         void stateComments();
         // Third pass of the Lexer (define literal strings).
@@ -53,9 +109,49 @@ class Lexer : public Vanir::Module<Lexer> {
         void stateOperators();
         // Seventh pass of the Lexer (identifier).
         void stateIdentifiers();
+        // Last pass of the Lexer (classify the tokens, spaces become trivia).
+        void stateClassify(std::string_view source);
+        bool isSourceRange(std::string_view content) const;
         static LexerTokenEnum getTransitionTableColumn(char currentCharacter);
 
-        std::vector<LexerToken> m_tokens;
+        std::vector<ParserToken> m_tokens;
+        // Number of tokens already handed over by takeTokens.
+        size_t m_tokenBase = 0;
+        std::vector<LexerTrivia> m_trivia;
+        bool m_isTriviaKept = true;
+        // Tokens of the multi-pass Lexer.
+        std::vector<LexerToken> m_lexerTokens;
+        std::shared_ptr<SourceBuffer> m_source;
+        std::deque<std::string> m_storage;
+        // Contents of the tokens that are not a source range, indexed by ParserToken::storage - 1.
+        std::vector<std::string_view> m_rewrittenContents;
+        // Values of the number tokens, indexed by ParserToken::literal.
+        std::vector<LexerLiteral> m_literals;
+        // End of the range lexed by lexLine.
+        size_t m_end = 0;
+        size_t m_threadCount = 0;
+        // Chunk lexers intern in a private table and leave the diagnostics to mergeChunk.
+        std::unique_ptr<SymbolTable> m_chunkSymbols;
+        std::vector<std::pair<size_t, std::string>> m_chunkErrors;
+        // Whether m_isOperandExpected was set by a token of this chunk, the index of that token, and the unary '+'
+        // or '-' that read it first if any (it depends on the last token of the previous chunk, like the
+        // LexerLineState_OperandExpected flag of the newlines before it).
+        bool m_hasOperandState = true;
+        size_t m_operandStateToken = 0;
+        size_t m_firstOperandToken = std::string_view::npos;
+        // Single-pass state carried from one line to the next (comments, strings, numbers, '...' and dotted
+        // identifiers are handled while scanning).
+        size_t m_position = 0;
+        size_t m_textStart = 0;
+        size_t m_commentStart = 0;
+        std::string m_text;
+        char m_textQuote = 0;
+        bool m_isInText = false;
+        bool m_isTextCopied = false;
+        bool m_isInCommentMultiLine = false;
+        bool m_lastTokenAllowUnary = true;
+        // A following '+' or '-' is a unary operator.
+        bool m_isOperandExpected = true;
     };
 
     Lexer &getLexer();
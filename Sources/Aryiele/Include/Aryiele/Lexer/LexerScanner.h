@@ -25,25 +25,26 @@
 //                                                                                  //
 //==================================================================================//
 
-#ifndef ARYIELE_CODEGENERATOR_BLOCKSTACK_H
-#define ARYIELE_CODEGENERATOR_BLOCKSTACK_H
+#ifndef ARYIELE_LEXER_LEXERSCANNER_H
+#define ARYIELE_LEXER_LEXERSCANNER_H
 
-#include <Aryiele/Common.h>
-#include <Aryiele/CodeGenerator/Block.h>
+#include <string_view>
 
 namespace Aryiele {
-    struct BlockStack {
-        BlockStack() = default;
-
-        std::shared_ptr<Block> create(bool setAsCurrent = true);
-        std::shared_ptr<Block> escape();
-        std::shared_ptr<BlockVariable> findVariable(const std::string& identifier);
-        void addVariable(const std::string& identifier, llvm::AllocaInst* instance, Node* initializationNode, bool isConstant = false);
-        void addVariable(const std::string& identifier, std::shared_ptr<BlockVariable> variable);
-
-        std::shared_ptr<Block> current = nullptr;
+    // Skip runs of characters 16 or 32 at a time (SSE2, AVX2 when the CPU has it, scalar otherwise).
+    // Each function returns the first position at or after 'position' which is not part of the run.
+    class LexerScanner {
+    public:
+        // Spaces, tabulations and other blanks, except line breaks.
+        static size_t skipSpaces(std::string_view source, size_t position);
+        // Letters, digits and underscores.
+        static size_t skipWordCharacters(std::string_view source, size_t position);
+        // Text which can't close a multi-line comment: word characters, blanks and non-ASCII bytes.
+        static size_t skipCommentText(std::string_view source, size_t position);
+        // Everything up to the next line break.
+        static size_t skipLine(std::string_view source, size_t position);
     };
 
 } /* Namespace Aryiele. */
 
-#endif /* ARYIELE_CODEGENERATOR_BLOCKSTACK_H. */
+#endif /* ARYIELE_LEXER_LEXERSCANNER_H. */
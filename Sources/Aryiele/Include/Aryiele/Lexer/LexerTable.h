@@ -28,11 +28,46 @@
 #ifndef ARYIELE_LEXER_TOKENTABLE_H
 #define ARYIELE_LEXER_TOKENTABLE_H
 
+#include <array>
+#include <initializer_list>
 #include <Aryiele/Lexer/LexerToken.h>
 
 namespace Aryiele
 {
-    int LexerTable[][12] =
+    // Class of every byte (column of LexerTable), the "C" locale isspace/isdigit/isalpha/ispunct split.
+    constexpr std::array<LexerTokenEnum, 256> makeLexerCharacterTable() {
+        std::array<LexerTokenEnum, 256> table {};
+
+        for (auto& column : table)
+            column = LexerToken_Unknown;
+
+        for (auto character = '!'; character <= '~'; character++)
+            table[character] = LexerToken_Operator;
+
+        for (auto character = '0'; character <= '9'; character++)
+            table[character] = LexerToken_Number;
+
+        for (auto character = 'a'; character <= 'z'; character++) {
+            table[character] = LexerToken_Identifier;
+            table[character - 'a' + 'A'] = LexerToken_Identifier;
+        }
+
+        for (auto character : { ' ', '\t', '\n', '\v', '\f', '\r' })
+            table[static_cast<unsigned char>(character)] = LexerToken_Space;
+
+        for (auto character : { '{', '}', '[', ']', '(', ')', ';', ',', ':', '.' })
+            table[static_cast<unsigned char>(character)] = LexerToken_Separator;
+
+        table['_'] = LexerToken_Identifier;
+        table['"'] = LexerToken_StringQuote;
+        table['\''] = LexerToken_StringQuote;
+
+        return table;
+    }
+
+    constexpr std::array<LexerTokenEnum, 256> LexerCharacterTable = makeLexerCharacterTable();
+
+    constexpr int LexerTable[][12] =
         {{ 0,                      LexerToken_Number,     LexerToken_String, LexerToken_Character, LexerToken_Operator, LexerToken_Separator, LexerToken_Identifier, LexerToken_StringQuote, LexerToken_Space,  LexerToken_Newline, LexerToken_Unknown },
          { LexerToken_Number,      LexerToken_Number,     LexerToken_Reject, LexerToken_Reject,    LexerToken_Reject,   LexerToken_Reject,    LexerToken_Number, LexerToken_Reject,      LexerToken_Reject, LexerToken_Reject,  LexerToken_Reject  },
          { LexerToken_String,      LexerToken_Reject,     LexerToken_Reject, LexerToken_Reject,    LexerToken_Reject,   LexerToken_Reject,    LexerToken_Reject,     LexerToken_Reject,      LexerToken_Reject, LexerToken_Reject,  LexerToken_Reject  },
@@ -29,6 +29,7 @@
 #define ARYIELE_LEXER_LEXERTOKEN_H
 
 #include <string>
+#include <string_view>
 
 namespace Aryiele {
     enum LexerTokenEnum {
@@ -46,11 +47,12 @@ namespace Aryiele {
     };
     
     struct LexerToken {
-        explicit LexerToken(const std::string& content = std::string(), LexerTokenEnum type = LexerToken_Unknown);
+        explicit LexerToken(std::string_view content = std::string_view(), LexerTokenEnum type = LexerToken_Unknown);
     
         static std::string getTypeName(LexerTokenEnum type);
         
-        std::string content;
+        // Points into the lexer's SourceBuffer (or its storage for rewritten literals).
+        std::string_view content;
         LexerTokenEnum type;
     };
 
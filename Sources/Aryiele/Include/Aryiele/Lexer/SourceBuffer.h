@@ -0,0 +1,68 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#ifndef ARYIELE_LEXER_SOURCEBUFFER_H
+#define ARYIELE_LEXER_SOURCEBUFFER_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <Aryiele/Lexer/SourceEdit.h>
+#include <Aryiele/Lexer/SourcePosition.h>
+
+namespace Aryiele {
+    // Read-only view of a whole source file, memory-mapped once when the platform allows it.
+    // Tokens reference it by std::string_view, so it must outlive every token produced from it.
+    class SourceBuffer {
+    public:
+        SourceBuffer() = default;
+        SourceBuffer(const SourceBuffer&) = delete;
+        SourceBuffer& operator=(const SourceBuffer&) = delete;
+        ~SourceBuffer();
+
+        bool open(const std::string& filepath);
+        void close();
+        // Apply a text edit, a mapped file is copied to memory the first time.
+        void edit(const SourceEdit& edit);
+        std::string_view getView() const;
+        const char* getData() const;
+        size_t getSize() const;
+        // Only meant for diagnostics, the line index is built on the first call.
+        SourcePosition getPosition(size_t offset) const;
+
+    private:
+        const char* m_data = nullptr;
+        size_t m_size = 0;
+        bool m_isMapped = false;
+        std::string m_content;
+        // Offset of the first byte of every line.
+        mutable std::vector<uint32_t> m_lineStarts;
+    };
+
+} /* Namespace Aryiele. */
+
+#endif /* ARYIELE_LEXER_SOURCEBUFFER_H. */
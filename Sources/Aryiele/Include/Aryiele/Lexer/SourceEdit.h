@@ -0,0 +1,51 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#ifndef ARYIELE_LEXER_SOURCEEDIT_H
+#define ARYIELE_LEXER_SOURCEEDIT_H
+
+#include <string>
+
+namespace Aryiele {
+    // Text edit of a source: the removedLength bytes at offset are replaced by insertedText.
+    struct SourceEdit {
+        size_t offset;
+        size_t removedLength;
+        std::string insertedText;
+    };
+
+    // Tokens touched by an edit: removedCount tokens from first were replaced by insertedCount tokens, the tokens
+    // after them are the same, moved by the length difference of the edit.
+    struct SourceEditDamage {
+        size_t first;
+        size_t removedCount;
+        size_t insertedCount;
+    };
+
+} /* Namespace Aryiele. */
+
+#endif /* ARYIELE_LEXER_SOURCEEDIT_H. */
@@ -25,13 +25,18 @@
 //                                                                                  //
 //==================================================================================//
 
-#include <Aryiele/CodeGenerator/Block.h>
+#ifndef ARYIELE_LEXER_SOURCEPOSITION_H
+#define ARYIELE_LEXER_SOURCEPOSITION_H
+
+#include <cstdint>
 
 namespace Aryiele {
-    Block::Block(std::shared_ptr<Block> parent, std::map<std::string, std::shared_ptr<BlockVariable>> variables,
-                 std::vector<std::shared_ptr<Block>> children) :
-        parent(parent), variables(variables), children(children) {
+    // Line and column of a byte offset, both starting at 1.
+    struct SourcePosition {
+        uint32_t line;
+        uint32_t column;
+    };
 
-    }
+} /* Namespace Aryiele. */
 
-} /* Namespace Aryiele. */
\ No newline at end of file
+#endif /* ARYIELE_LEXER_SOURCEPOSITION_H. */
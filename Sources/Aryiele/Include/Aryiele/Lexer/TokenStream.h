@@ -0,0 +1,84 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#ifndef ARYIELE_LEXER_TOKENSTREAM_H
+#define ARYIELE_LEXER_TOKENSTREAM_H
+
+#include <array>
+#include <vector>
+#include <Aryiele/Lexer/Lexer.h>
+#include <Aryiele/Parser/ParserToken.h>
+
+namespace Aryiele {
+    // Pull-based token source for the parser. Bound to a Lexer opened with Lexer::open, tokens are lexed a line at
+    // a time when the parser asks for them and dropped once consumed. It can also replay an already lexed stream,
+    // owned or borrowed: next and peek then return the tokens in place, nothing is copied.
+    // Once the tokens are exhausted, an EOF token is returned forever.
+    class TokenStream {
+    public:
+        // Size of the lookahead ring of a lexer bound stream, peek looks at most Capacity - 2 tokens ahead (the
+        // slot of the token next returned last is kept).
+        static constexpr size_t Capacity = 16;
+
+        explicit TokenStream(Lexer& lexer);
+        explicit TokenStream(std::vector<ParserToken> tokens);
+        // The tokens must outlive the stream, the EOF token is placed at endOffset.
+        TokenStream(const ParserToken* begin, const ParserToken* end, uint32_t endOffset);
+
+        // Token n positions ahead (0 is the token next returns), valid until the next call to next.
+        const ParserToken& peek(size_t n = 0);
+        // Move to the next token, valid until the following call to next.
+        const ParserToken& next();
+        // Number of tokens returned by next so far.
+        size_t getPosition() const;
+        // A stream replaying lexed tokens gives access to the ones next has not returned yet (see
+        // Parser::parseParallel), a stream bound to a lexer has none.
+        bool isBoundToLexer() const;
+        const ParserToken* getPendingBegin() const;
+        const ParserToken* getPendingEnd() const;
+        uint32_t getEndOffset() const;
+
+    private:
+        void fill(size_t count);
+        bool pull();
+
+        Lexer* m_lexer = nullptr;
+        // Tokens not yet moved into the ring buffer: the last lexed line, or the whole replayed stream.
+        std::vector<ParserToken> m_pending;
+        const ParserToken* m_pendingBegin = nullptr;
+        const ParserToken* m_pendingEnd = nullptr;
+        size_t m_position = 0;
+        // Returned once the tokens are exhausted.
+        ParserToken m_endToken {};
+        std::array<ParserToken, Capacity> m_buffer {};
+        size_t m_head = 0;
+        size_t m_size = 0;
+    };
+
+} /* Namespace Aryiele. */
+
+#endif /* ARYIELE_LEXER_TOKENSTREAM_H. */
@@ -28,80 +28,147 @@
 #ifndef ARYIELE_PARSER_PARSER_H
 #define ARYIELE_PARSER_PARSER_H
 
+#include <sstream>
+#include <string>
+#include <utility>
 #include <vector>
 #include <Vanir/Module/Module.h>
 #include <Aryiele/Common.h>
-#include <Aryiele/Lexer/LexerToken.h>
+#include <Aryiele/AST/ASTContext.h>
 #include <Aryiele/AST/Nodes/Node.h>
 #include <Aryiele/AST/Nodes/NodeTopFunction.h>
 #include <Aryiele/AST/Nodes/NodeRoot.h>
+#include <Aryiele/Lexer/SourcePosition.h>
+#include <Aryiele/Lexer/TokenStream.h>
 #include <Aryiele/Parser/ParserToken.h>
 #include <Aryiele/Parser/ParserInformation.h>
 
 namespace Aryiele {
+    // Operation parseExpression has started and that waits for the expression on its right.
+    enum ParserPendingEnum {
+        ParserPending_Unary, // -a
+        ParserPending_Parenthese, // (a)
+        ParserPending_Binary, // a + b
+        ParserPending_TernaryThen, // a ? b : c, waiting for b
+        ParserPending_TernaryElse // a ? b : c, waiting for c
+    };
+
+    struct ParserPending {
+        ParserPendingEnum type;
+        ParserTokenEnum operation;
+        // Power of the expression the operation is part of, parsing goes on with it once the operation is complete.
+        uint8_t power;
+        Node* condition;
+        Node* lhs;
+    };
+
 class Parser : public Vanir::Module<Parser> {
     public:
         Parser();
     
-        std::shared_ptr<NodeRoot> parse(const std::string& path, std::vector<ParserToken> tokens);
-        static std::vector<ParserToken> convertTokens(const std::vector<LexerToken>& tokenizerTokens);
-        ParserToken getCurrentToken();
+        // The nodes are created in the context, and live as long as it does.
+        // A stream replaying lexed tokens is parsed on several threads when the thread count is not 1 (see
+        // parseParallel), the result and the diagnostics are the ones of a parse on the calling thread.
+        NodeRoot* parse(ASTContext& context, const std::string& path, std::vector<ParserToken> tokens);
+        NodeRoot* parse(ASTContext& context, const std::string& path, TokenStream& tokens);
+        // Parse the next top-level declaration of the stream (tokens before it are skipped), false once the end of
+        // the stream is reached. The node is null after a syntax error.
+        bool parseTopLevel(ASTContext& context, TokenStream& tokens, Node*& node);
+        const ParserToken& getCurrentToken();
+        // 1 (the default) parses on the calling thread only, 0 uses every hardware thread.
+        void setThreadCount(size_t threadCount);
+        // Function bodies are only matched brace to brace and their tokens kept in the function node, syntax errors
+        // in them are reported once parseLazyBody is called.
+        void setLazyBodies(bool lazyBodies);
+        // Parse the body the parser skipped, in the context holding the function. Nothing is done when the body
+        // was already parsed.
+        void parseLazyBody(ASTContext& context, NodeTopFunction* node);
+        static void setParent(Node* node);
 
     private:
-        ParserToken getNextToken(bool incrementCounter = true);
-        int getOperatorPrecedence(ParserTokenEnum binaryOperator);
-        std::shared_ptr<NodeTopFunction> parseFunction();
-        std::shared_ptr<Node> parseNamespace();
-        std::shared_ptr<Node> parsePrimary();
-        std::shared_ptr<Node> parseExpression();
-        std::shared_ptr<Node> parseTernaryOperation(std::shared_ptr<Node> condition);
-        std::shared_ptr<Node> parseBinaryOperation(int expressionPrecedence, std::shared_ptr<Node> leftExpression);
-        std::shared_ptr<Node> parseUnaryOperation();
-        std::vector<std::shared_ptr<Node>> parseBody();
-        std::vector<std::shared_ptr<Node>> parseCase();
-        std::shared_ptr<Node> parseInteger();
-        std::shared_ptr<Node> parseDouble();
-        std::shared_ptr<Node> parseString();
-        std::shared_ptr<Node> parseCharacter();
-        std::shared_ptr<Node> parseBoolean();
-        std::shared_ptr<Node> parseArray();
-        std::shared_ptr<Node> parseArrayCall();
-        std::shared_ptr<Node> parseIdentifier();
-        std::shared_ptr<Node> parseParenthese();
-        std::shared_ptr<Node> parseReturn();
-        std::shared_ptr<Node> parseIf();
-        std::shared_ptr<Node> parseFor();
-        std::shared_ptr<Node> parseWhile(bool doOnce);
-        std::shared_ptr<Node> parseBlock();
-        std::shared_ptr<Node> parseBreak();
-        std::shared_ptr<Node> parseContinue();
-        std::shared_ptr<Node> parseSwitch();
-        std::shared_ptr<Node> parseVariableDeclaration(bool constant = false, bool passVar = true, bool multiple = true);
+        // The current token is the one the stream returned last, valid until the next call to getNextToken.
+        const ParserToken& getNextToken();
+        // Token n + 1 positions after the current one (0 is the token getNextToken returns next).
+        const ParserToken& peekToken(size_t n = 0);
+        std::string_view getCurrentTokenContent();
+        // Skim the top-level declarations by matching braces, parse them on a pool of threads, each in a context of
+        // its own, then take them in source order the way parseTopLevel would have found them. A declaration that
+        // did not start where the previous one left off (syntax errors), or that needed a new symbol, is parsed
+        // again here.
+        void parseParallel(ASTContext& context, TokenStream& tokens);
+        void reportError(size_t offset, std::string message);
+        // Chunks only look symbols up, they cannot intern them concurrently.
+        Symbol internSymbol(std::string_view name);
+        NodeTopFunction* parseFunction();
+        Node* parseNamespace();
+        Node* parsePrimary();
+        // Pratt parser over ParserPrecedences. Operations waiting for their right operand are kept in
+        // m_pendingOperations instead of the call stack, nesting is only bound by memory.
+        Node* parseExpression();
+        std::vector<Node*> parseBody();
+        // A function without a return type returns once its last statement is reached.
+        void addImplicitReturn(Symbol type, std::vector<Node*>& body);
+        std::vector<Node*> parseCase();
+        Node* parseInteger();
+        Node* parseDouble();
+        Node* parseString();
+        Node* parseCharacter();
+        Node* parseBoolean();
+        Node* parseArray();
+        Node* parseArrayCall();
+        Node* parseIdentifier();
+        Node* parseParenthese();
+        Node* parseReturn();
+        Node* parseIf();
+        Node* parseFor();
+        Node* parseWhile(bool doOnce);
+        Node* parseBlock();
+        Node* parseBreak();
+        Node* parseContinue();
+        Node* parseSwitch();
+        Node* parseVariableDeclaration(bool constant = false, bool passVar = true, bool multiple = true);
         bool isLiteral(ParserTokenEnum type);
         bool isLiteralOrIdentifier(ParserTokenEnum type);
-        static bool setParent(std::shared_ptr<Node> node);
+        static bool isTopLevelKeyword(ParserTokenEnum type);
+
+        template<typename... Args>
+        static std::string makeMessage(const Args&... args) {
+            std::ostringstream stream;
+
+            (stream << ... << args);
+
+            return stream.str();
+        }
     
-        std::map<ParserTokenEnum, int> m_binaryOperatorPrecedence;
-        std::vector<std::shared_ptr<Node>> m_nodes;
-        std::vector<ParserToken> m_tokens;
-        ParserToken m_currentToken;
-        int m_currentTokenIndex = -1;
-        int m_currentLine = 1;
-        int m_currentColumn = 1;
+        std::vector<Node*> m_nodes;
+        std::vector<ParserPending> m_pendingOperations;
+        ASTContext* m_context = nullptr;
+        TokenStream* m_tokens = nullptr;
+        const ParserToken* m_currentToken = nullptr;
+        size_t m_threadCount = 1;
+        bool m_isLazyBodies = false;
+        // Parsers of parseParallel keep their diagnostics for the main parser to report in order.
+        bool m_isChunk = false;
+        bool m_isChunkIncomplete = false;
+        std::vector<std::pair<size_t, std::string>> m_chunkErrors;
     };
     
     Parser &getParser();
 
 } /* Namespace Aryiele. */
 
+#define PARSER_REPORT(...) { \
+    reportError(m_currentToken->offset, makeMessage(__VA_ARGS__)); \
+}
+
 #define PARSER_ERROR(...) { \
-    LOG_ERROR(m_currentLine, ":", m_currentColumn, " ", __VA_ARGS__) \
+    PARSER_REPORT(__VA_ARGS__) \
     return nullptr; \
 }
 
 #define PARSER_CHECKTOKEN(EXPECTEDTOKENTYPE) \
-if (getParser().getCurrentToken().type != EXPECTEDTOKENTYPE) { \
-    PARSER_ERROR("wrong token, got '", ParserToken::getTypeName(m_currentToken.type), "' but expected '", ParserToken::getTypeName(EXPECTEDTOKENTYPE), "'"); \
+if (m_currentToken->type != EXPECTEDTOKENTYPE) { \
+    PARSER_ERROR("wrong token, got '", ParserToken::getTypeName(m_currentToken->type), "' but expected '", ParserToken::getTypeName(EXPECTEDTOKENTYPE), "'"); \
 }
 
 #define PARSER_CHECKNEXTTOKEN(EXPECTEDTOKENTYPE) { \
@@ -0,0 +1,74 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#ifndef ARYIELE_PARSER_PARSERDOCUMENT_H
+#define ARYIELE_PARSER_PARSERDOCUMENT_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <Aryiele/Common.h>
+#include <Aryiele/AST/ASTContext.h>
+#include <Aryiele/AST/Nodes/NodeRoot.h>
+#include <Aryiele/AST/Nodes/NodeTopFile.h>
+#include <Aryiele/Lexer/SourceEdit.h>
+#include <Aryiele/Parser/ParserToken.h>
+
+namespace Aryiele {
+    // Tokens and AST of a file kept up to date through text edits, for editors and watch modes. An edit is lexed
+    // again from its line (see Lexer::relex), and only the top-level declarations whose tokens changed are parsed
+    // again, the other nodes are reused as they are. It uses the Lexer and Parser modules, which must not lex or
+    // parse anything else while the document is edited. The nodes replaced by an edit stay in the document context
+    // until it is opened again.
+    class ParserDocument {
+    public:
+        bool open(const std::string& filepath);
+        SourceEditDamage edit(const SourceEdit& edit);
+        NodeRoot* getRoot() const;
+        const std::vector<ParserToken>& getTokens() const;
+        // Number of top-level declarations parsed again by the last edit.
+        size_t getReparsedCount() const;
+
+    private:
+        struct Declaration {
+            // Index of the token following the declaration, it starts where the previous one ends.
+            size_t end;
+            Node* node;
+        };
+
+        std::string m_path;
+        std::vector<ParserToken> m_tokens;
+        std::vector<Declaration> m_declarations;
+        ASTContext m_context;
+        NodeRoot* m_root = nullptr;
+        NodeTopFile* m_file = nullptr;
+        size_t m_reparsedCount = 0;
+    };
+
+} /* Namespace Aryiele. */
+
+#endif /* ARYIELE_PARSER_PARSERDOCUMENT_H. */
@@ -38,7 +38,8 @@ namespace Aryiele {
                 std::string name = "Unnamed",
                 std::vector<std::shared_ptr<ParserInformation>> children = std::vector<std::shared_ptr<ParserInformation>>());
 
-        std::shared_ptr<ParserInformation> parent;
+        // The children own the tree, the parent is only a link back.
+        ParserInformation* parent;
         std::string name;
         std::vector<std::shared_ptr<ParserInformation>> children;
     };
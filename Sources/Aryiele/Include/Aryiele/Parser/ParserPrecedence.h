@@ -0,0 +1,103 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#ifndef ARYIELE_PARSER_PARSERPRECEDENCE_H
+#define ARYIELE_PARSER_PARSERPRECEDENCE_H
+
+#include <array>
+#include <cstdint>
+#include <Aryiele/Parser/ParserToken.h>
+
+namespace Aryiele {
+    // Binding powers of an operator token, 0 where the token does not play the role. An infix operator takes the
+    // expression on its left when its left power is at least the power of the expression being parsed, and parses
+    // the one on its right with its right power: left + 1 makes it left associative, left right associative.
+    struct ParserPrecedence {
+        // Power of a prefix operator over its operand.
+        uint8_t prefix = 0;
+        // Power of an infix or postfix operator over the expression on its left.
+        uint8_t left = 0;
+        // Power of an infix operator over the expression on its right, 0 for a postfix operator.
+        uint8_t right = 0;
+    };
+
+    constexpr uint8_t ParserPrecedence_Assignment = 10;
+    constexpr uint8_t ParserPrecedence_Ternary = 15;
+    constexpr uint8_t ParserPrecedence_Logical = 20;
+    constexpr uint8_t ParserPrecedence_Comparison = 30;
+    constexpr uint8_t ParserPrecedence_Additive = 40;
+    constexpr uint8_t ParserPrecedence_Multiplicative = 50;
+    constexpr uint8_t ParserPrecedence_Prefix = 60;
+    constexpr uint8_t ParserPrecedence_Postfix = 70;
+
+    constexpr std::array<ParserPrecedence, ParserToken_Unknown + 1> makeParserPrecedences() {
+        std::array<ParserPrecedence, ParserToken_Unknown + 1> precedences {};
+
+        const auto infix = [&precedences](ParserTokenEnum type, uint8_t power, bool rightAssociative = false) {
+            precedences[type].left = power;
+            precedences[type].right = rightAssociative ? power : power + 1;
+        };
+
+        infix(ParserToken_OperatorEqual, ParserPrecedence_Assignment, true);
+        infix(ParserToken_OperatorArithmeticPlusEqual, ParserPrecedence_Assignment, true);
+        infix(ParserToken_OperatorArithmeticMinusEqual, ParserPrecedence_Assignment, true);
+        infix(ParserToken_OperatorArithmeticMultiplyEqual, ParserPrecedence_Assignment, true);
+        infix(ParserToken_OperatorArithmeticDivideEqual, ParserPrecedence_Assignment, true);
+        infix(ParserToken_OperatorArithmeticRemainderEqual, ParserPrecedence_Assignment, true);
+        // The right power of '?' is the one of the expression after ':', the one between '?' and ':' is parsed whole.
+        infix(ParserToken_OperatorQuestionMark, ParserPrecedence_Ternary, true);
+        infix(ParserToken_OperatorLogicalAnd, ParserPrecedence_Logical);
+        infix(ParserToken_OperatorLogicalOr, ParserPrecedence_Logical);
+        infix(ParserToken_OperatorComparisonEqual, ParserPrecedence_Comparison);
+        infix(ParserToken_OperatorComparisonNotEqual, ParserPrecedence_Comparison);
+        infix(ParserToken_OperatorComparisonLessThan, ParserPrecedence_Comparison);
+        infix(ParserToken_OperatorComparisonGreaterThan, ParserPrecedence_Comparison);
+        infix(ParserToken_OperatorComparisonLessThanOrEqual, ParserPrecedence_Comparison);
+        infix(ParserToken_OperatorComparisonGreaterThanOrEqual, ParserPrecedence_Comparison);
+        infix(ParserToken_OperatorArithmeticPlus, ParserPrecedence_Additive);
+        infix(ParserToken_OperatorArithmeticMinus, ParserPrecedence_Additive);
+        infix(ParserToken_OperatorArithmeticMultiply, ParserPrecedence_Multiplicative);
+        infix(ParserToken_OperatorArithmeticDivide, ParserPrecedence_Multiplicative);
+        infix(ParserToken_OperatorArithmeticRemainder, ParserPrecedence_Multiplicative);
+
+        precedences[ParserToken_OperatorUnaryArithmeticPlus].prefix = ParserPrecedence_Prefix;
+        precedences[ParserToken_OperatorUnaryArithmeticMinus].prefix = ParserPrecedence_Prefix;
+        precedences[ParserToken_OperatorUnaryLogicalNot].prefix = ParserPrecedence_Prefix;
+        precedences[ParserToken_OperatorUnaryArithmeticIncrement].prefix = ParserPrecedence_Prefix;
+        precedences[ParserToken_OperatorUnaryArithmeticDecrement].prefix = ParserPrecedence_Prefix;
+        precedences[ParserToken_OperatorUnaryArithmeticIncrement].left = ParserPrecedence_Postfix;
+        precedences[ParserToken_OperatorUnaryArithmeticDecrement].left = ParserPrecedence_Postfix;
+
+        return precedences;
+    }
+
+    // Indexed by ParserTokenEnum.
+    constexpr std::array<ParserPrecedence, ParserToken_Unknown + 1> ParserPrecedences = makeParserPrecedences();
+
+} /* Namespace Aryiele. */
+
+#endif /* ARYIELE_PARSER_PARSERPRECEDENCE_H. */
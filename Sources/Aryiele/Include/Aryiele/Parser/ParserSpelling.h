@@ -0,0 +1,183 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#ifndef ARYIELE_PARSER_PARSERSPELLING_H
+#define ARYIELE_PARSER_PARSERSPELLING_H
+
+#include <array>
+#include <iterator>
+#include <cstdint>
+#include <string_view>
+#include <Aryiele/Parser/ParserToken.h>
+
+namespace Aryiele {
+    struct ParserSpelling {
+        std::string_view spelling;
+        ParserTokenEnum type = ParserToken_Unknown;
+    };
+
+    // Every fixed spelling of the language, the lexer and the parser both recognize lexemes from this list only.
+    // + and - are the binary operators here, Lexer::classifyToken turns them unary when an operand is expected.
+    constexpr ParserSpelling ParserSpellings[] = {
+        // Operators.
+        { "=", ParserToken_OperatorEqual },
+        { "+", ParserToken_OperatorArithmeticPlus },
+        { "-", ParserToken_OperatorArithmeticMinus },
+        { "*", ParserToken_OperatorArithmeticMultiply },
+        { "/", ParserToken_OperatorArithmeticDivide },
+        { "%", ParserToken_OperatorArithmeticRemainder },
+        { "+=", ParserToken_OperatorArithmeticPlusEqual },
+        { "-=", ParserToken_OperatorArithmeticMinusEqual },
+        { "*=", ParserToken_OperatorArithmeticMultiplyEqual },
+        { "/=", ParserToken_OperatorArithmeticDivideEqual },
+        { "%=", ParserToken_OperatorArithmeticRemainderEqual },
+        { "++", ParserToken_OperatorUnaryArithmeticIncrement },
+        { "--", ParserToken_OperatorUnaryArithmeticDecrement },
+        { "==", ParserToken_OperatorComparisonEqual },
+        { "!=", ParserToken_OperatorComparisonNotEqual },
+        { "<", ParserToken_OperatorComparisonLessThan },
+        { ">", ParserToken_OperatorComparisonGreaterThan },
+        { "<=", ParserToken_OperatorComparisonLessThanOrEqual },
+        { ">=", ParserToken_OperatorComparisonGreaterThanOrEqual },
+        { "&&", ParserToken_OperatorLogicalAnd },
+        { "||", ParserToken_OperatorLogicalOr },
+        { "!", ParserToken_OperatorUnaryLogicalNot },
+        { "?", ParserToken_OperatorQuestionMark },
+        // Separators.
+        { "(", ParserToken_SeparatorRoundBracketOpen },
+        { ")", ParserToken_SeparatorRoundBracketClosed },
+        { "[", ParserToken_SeparatorSquareBracketOpen },
+        { "]", ParserToken_SeparatorSquareBracketClosed },
+        { "{", ParserToken_SeparatorCurlyBracketOpen },
+        { "}", ParserToken_SeparatorCurlyBracketClosed },
+        { ":", ParserToken_SeparatorColon },
+        { ";", ParserToken_SeparatorSemicolon },
+        { ",", ParserToken_SeparatorComma },
+        { ".", ParserToken_SeparatorDot },
+        { "...", ParserToken_SeparatorTripleDot },
+        // Keywords.
+        { "true", ParserToken_LiteralValueBoolean },
+        { "false", ParserToken_LiteralValueBoolean },
+        { "func", ParserToken_KeywordFunction },
+        { "namespace", ParserToken_KeywordNamespace },
+        { "var", ParserToken_KeywordVar },
+        { "let", ParserToken_KeywordLet },
+        { "return", ParserToken_KeywordReturn },
+        { "if", ParserToken_KeywordIf },
+        { "else", ParserToken_KeywordElse },
+        { "for", ParserToken_KeywordFor },
+        { "do", ParserToken_KeywordDo },
+        { "by", ParserToken_KeywordBy },
+        { "continue", ParserToken_KeywordContinue },
+        { "break", ParserToken_KeywordBreak },
+        { "while", ParserToken_KeywordWhile },
+        { "default", ParserToken_KeywordDefault },
+        { "switch", ParserToken_KeywordSwitch },
+        { "case", ParserToken_KeywordCase },
+        { "_", ParserToken_KeywordEmpty }
+    };
+
+    static_assert(std::size(ParserSpellings) < 0xFF, "ParserSpellingTable indexes ParserSpellings with a byte");
+
+    // Perfect hash over ParserSpellings, keyed on the length, first and last character of a lexeme: a lookup is one
+    // hash and at most one string comparison.
+    class ParserSpellingTable {
+    public:
+        static constexpr uint32_t Bits = 8;
+        static constexpr uint32_t Size = 1u << Bits;
+
+        static constexpr uint8_t EmptySlot = 0xFF;
+
+        constexpr ParserSpellingTable() : m_seed(findSeed()), m_slots() {
+            for (auto& slot : m_slots)
+                slot = EmptySlot;
+
+            for (uint8_t index = 0; index < std::size(ParserSpellings); index++)
+                m_slots[hash(ParserSpellings[index].spelling, m_seed)] = index;
+        }
+
+        // ParserToken_Unknown when the lexeme is not a spelling of the language.
+        constexpr ParserTokenEnum find(std::string_view lexeme) const {
+            if (lexeme.empty())
+                return ParserToken_Unknown;
+
+            const auto slot = m_slots[hash(lexeme, m_seed)];
+
+            if (slot == EmptySlot || ParserSpellings[slot].spelling != lexeme)
+                return ParserToken_Unknown;
+
+            return ParserSpellings[slot].type;
+        }
+
+    private:
+        // Multiplicative hash of the (length, first, last) key, the seed being the odd multiplier.
+        static constexpr uint32_t hash(std::string_view lexeme, uint32_t seed) {
+            const auto key = static_cast<uint32_t>(lexeme.size() & 0xFF) |
+                static_cast<uint32_t>(static_cast<unsigned char>(lexeme.front())) << 8 |
+                static_cast<uint32_t>(static_cast<unsigned char>(lexeme.back())) << 16;
+
+            return (key * seed) >> (32 - Bits);
+        }
+
+        static constexpr bool isPerfect(uint32_t seed) {
+            std::array<bool, Size> used {};
+
+            for (const auto& spelling : ParserSpellings) {
+                auto& slot = used[hash(spelling.spelling, seed)];
+
+                if (slot)
+                    return false;
+
+                slot = true;
+            }
+
+            return true;
+        }
+
+        // Fails to compile if no seed separates the spellings, e.g. two of them share length, first and last character.
+        static constexpr uint32_t findSeed() {
+            for (uint32_t seed = 0x9E3779B1u; seed < 0x9E3779B1u + 0x20000; seed += 2)
+                if (isPerfect(seed))
+                    return seed;
+
+            throw "no perfect hash seed for ParserSpellings";
+        }
+
+        uint32_t m_seed;
+        // Index into ParserSpellings, EmptySlot where no spelling hashes.
+        std::array<uint8_t, Size> m_slots;
+    };
+
+    constexpr ParserSpellingTable ParserSpellingHash = ParserSpellingTable();
+
+    constexpr ParserTokenEnum findParserSpelling(std::string_view lexeme) {
+        return ParserSpellingHash.find(lexeme);
+    }
+
+} /* Namespace Aryiele. */
+
+#endif /* ARYIELE_PARSER_PARSERSPELLING_H. */
@@ -28,7 +28,10 @@
 #ifndef ARYIELE_PARSER_PARSERTOKEN_H
 #define ARYIELE_PARSER_PARSERTOKEN_H
 
+#include <cstdint>
+#include <string>
 #include <Aryiele/Common.h>
+#include <Aryiele/Utility/SymbolTable.h>
 
 namespace Aryiele {
     enum ParserTokenEnum {
@@ -100,21 +103,35 @@ namespace Aryiele {
         
         ParserToken_Identifier, // Any characters sequence other than a keyword.
         ParserToken_EOF, // EOF
-        ParserToken_Space, // A space
         ParserToken_Newline, // A newline
         
         ParserToken_Unknown
     };
     
+    // Classified token emitted by the lexer, its content is read back through Lexer::getContent.
+    // Spaces and comments are not tokens, the lexer keeps them in its trivia table.
     struct ParserToken {
-        explicit ParserToken(const std::string& content = std::string(), ParserTokenEnum type = ParserToken_Unknown);
-    
         static std::string getTypeName(ParserTokenEnum type);
-        
-        std::string content;
-        ParserTokenEnum type;
+
+        // Byte offset of the token in the source.
+        uint32_t offset;
+        uint32_t length : 24;
+        ParserTokenEnum type : 8;
+        union {
+            // Interned content of identifiers.
+            Symbol symbol;
+            // Numbers: index of the value decoded by the lexer (see Lexer::getInteger and Lexer::getDecimal).
+            uint32_t literal;
+            // Newlines: LexerLineState flags of the next line, where the lexer can restart (see Lexer::relex).
+            uint32_t lineState;
+            // Any other token: 1 + index of a content rewritten by the lexer (escaped literals), 0 when the
+            // content is the source range.
+            uint32_t storage;
+        };
     };
 
+    static_assert(sizeof(ParserToken) == 12, "ParserToken is expected to stay a 12 bytes POD");
+
 } /* Namespace Aryiele. */
 
 #endif /* ARYIELE_PARSER_PARSERTOKEN_H. */
@@ -0,0 +1,86 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#ifndef ARYIELE_UTILITY_SYMBOLTABLE_H
+#define ARYIELE_UTILITY_SYMBOLTABLE_H
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <Vanir/Module/Module.h>
+
+namespace Aryiele {
+    // Dense id of an interned identifier, two symbols are equal only if their names are.
+    typedef uint32_t Symbol;
+
+    // Symbols interned when the table starts, in this order, so they can be compared against directly.
+    enum SymbolEnum : Symbol {
+        Symbol_Empty,
+        // Builtin types.
+        Symbol_Int8,
+        Symbol_Int16,
+        Symbol_Int32,
+        Symbol_Int64,
+        Symbol_Int,
+        Symbol_UInt8,
+        Symbol_UInt16,
+        Symbol_UInt32,
+        Symbol_UInt64,
+        Symbol_UInt,
+        Symbol_Float,
+        Symbol_Double,
+        Symbol_String,
+        Symbol_Character,
+        Symbol_Void,
+        Symbol_Boolean,
+        Symbol_Predefined
+    };
+
+    class SymbolTable : public Vanir::Module<SymbolTable> {
+    public:
+        SymbolTable();
+
+        Symbol intern(std::string_view name);
+        // Symbol_Empty when the name is not interned. Unlike intern, safe to call from several threads at once as
+        // long as no other thread interns.
+        Symbol find(std::string_view name) const;
+        const std::string& getName(Symbol symbol) const;
+        size_t getSize() const;
+
+    private:
+        // Names never move once interned, the keys of m_symbols point into them.
+        std::deque<std::string> m_names;
+        std::unordered_map<std::string_view, Symbol> m_symbols;
+    };
+
+    SymbolTable &getSymbolTable();
+
+} /* Namespace Aryiele. */
+
+#endif /* ARYIELE_UTILITY_SYMBOLTABLE_H. */
@@ -0,0 +1,799 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <unordered_map>
+#include <vector>
+#include <Aryiele/AST/ASTCache.h>
+#include <Aryiele/AST/ASTOperands.h>
+#include <Aryiele/AST/Variable.h>
+#include <Aryiele/AST/Nodes/NodeLiteralArray.h>
+#include <Aryiele/AST/Nodes/NodeLiteralBoolean.h>
+#include <Aryiele/AST/Nodes/NodeLiteralCharacter.h>
+#include <Aryiele/AST/Nodes/NodeLiteralNumberFloating.h>
+#include <Aryiele/AST/Nodes/NodeLiteralNumberInteger.h>
+#include <Aryiele/AST/Nodes/NodeLiteralString.h>
+#include <Aryiele/AST/Nodes/NodeOperationBinary.h>
+#include <Aryiele/AST/Nodes/NodeOperationTernary.h>
+#include <Aryiele/AST/Nodes/NodeOperationUnary.h>
+#include <Aryiele/AST/Nodes/NodeStatementArrayCall.h>
+#include <Aryiele/AST/Nodes/NodeStatementBlock.h>
+#include <Aryiele/AST/Nodes/NodeStatementBreak.h>
+#include <Aryiele/AST/Nodes/NodeStatementCase.h>
+#include <Aryiele/AST/Nodes/NodeStatementContinue.h>
+#include <Aryiele/AST/Nodes/NodeStatementFor.h>
+#include <Aryiele/AST/Nodes/NodeStatementFunctionCall.h>
+#include <Aryiele/AST/Nodes/NodeStatementIf.h>
+#include <Aryiele/AST/Nodes/NodeStatementReturn.h>
+#include <Aryiele/AST/Nodes/NodeStatementSwitch.h>
+#include <Aryiele/AST/Nodes/NodeStatementVariable.h>
+#include <Aryiele/AST/Nodes/NodeStatementVariableDeclaration.h>
+#include <Aryiele/AST/Nodes/NodeStatementWhile.h>
+#include <Aryiele/AST/Nodes/NodeTopFile.h>
+#include <Aryiele/AST/Nodes/NodeTopFunction.h>
+#include <Aryiele/AST/Nodes/NodeTopNamespace.h>
+#include <Aryiele/Lexer/SourceBuffer.h>
+#include <Aryiele/Utility/SymbolTable.h>
+
+namespace Aryiele {
+    namespace {
+        const char Magic[4] = { 'A', 'R', 'Y', 'A' };
+
+        struct Header {
+            char magic[4];
+            uint32_t version;
+            uint64_t sourceHash;
+            // Of everything after the header, so that a damaged symbol or record is a miss.
+            uint64_t payloadHash;
+            uint32_t symbolCount;
+            uint32_t recordCount;
+        };
+
+        class Writer {
+        public:
+            template<typename T>
+            void write(const T& value) {
+                m_records.append(reinterpret_cast<const char*>(&value), sizeof(T));
+            }
+
+            void writeString(std::string_view value) {
+                write(static_cast<uint32_t>(value.size()));
+                m_records.append(value);
+            }
+
+            void writeSymbol(Symbol symbol) {
+                auto index = m_symbols.emplace(symbol, static_cast<uint32_t>(m_symbolNames.size()));
+
+                if (index.second)
+                    m_symbolNames.push_back(symbol);
+
+                write(index.first->second);
+            }
+
+            // Fields of the node, the count of each list of operands included.
+            void writeRecord(Node* node) {
+                write(static_cast<uint8_t>(node ? node->getType() : Node_Error));
+
+                if (!node)
+                    return;
+
+                switch (node->getType()) {
+                    case Node_Root:
+                        write(static_cast<uint32_t>(cast<NodeRoot>(node)->body.size()));
+                        break;
+                    case Node_TopFile:
+                        writeString(cast<NodeTopFile>(node)->path);
+                        write(static_cast<uint32_t>(cast<NodeTopFile>(node)->body.size()));
+                        break;
+                    case Node_TopFunction: {
+                        auto function = cast<NodeTopFunction>(node);
+
+                        writeSymbol(function->identifier);
+                        writeSymbol(function->type);
+                        write(static_cast<uint32_t>(function->arguments.size()));
+
+                        for (auto& argument : function->arguments) {
+                            writeSymbol(argument.identifier);
+                            writeSymbol(argument.type);
+                        }
+
+                        write(static_cast<uint32_t>(function->body.size()));
+                        break;
+                    }
+                    case Node_TopNamespace:
+                        writeSymbol(cast<NodeTopNamespace>(node)->identifier);
+                        write(static_cast<uint32_t>(cast<NodeTopNamespace>(node)->body.size()));
+                        break;
+                    case Node_LiteralArray:
+                        write(static_cast<uint32_t>(cast<NodeLiteralArray>(node)->elements.size()));
+                        break;
+                    case Node_LiteralBoolean:
+                        write(static_cast<uint8_t>(cast<NodeLiteralBoolean>(node)->value));
+                        break;
+                    case Node_LiteralCharacter:
+                        writeString(cast<NodeLiteralCharacter>(node)->value);
+                        break;
+                    case Node_LiteralNumberFloating:
+                        write(cast<NodeLiteralNumberFloating>(node)->value);
+                        break;
+                    case Node_LiteralNumberInteger:
+                        write(cast<NodeLiteralNumberInteger>(node)->value);
+                        write(static_cast<uint8_t>(cast<NodeLiteralNumberInteger>(node)->isUnsigned));
+                        break;
+                    case Node_LiteralString:
+                        writeString(cast<NodeLiteralString>(node)->value);
+                        break;
+                    case Node_OperationUnary:
+                        write(static_cast<uint8_t>(cast<NodeOperationUnary>(node)->operationType));
+                        write(static_cast<uint8_t>(cast<NodeOperationUnary>(node)->left));
+                        break;
+                    case Node_OperationBinary:
+                        write(static_cast<uint8_t>(cast<NodeOperationBinary>(node)->operationType));
+                        break;
+                    case Node_StatementBlock:
+                        write(static_cast<uint32_t>(cast<NodeStatementBlock>(node)->body.size()));
+                        break;
+                    case Node_StatementCase:
+                        write(static_cast<uint32_t>(cast<NodeStatementCase>(node)->body.size()));
+                        break;
+                    case Node_StatementFor:
+                        write(static_cast<uint32_t>(cast<NodeStatementFor>(node)->body.size()));
+                        break;
+                    case Node_StatementFunctionCall:
+                        writeSymbol(cast<NodeStatementFunctionCall>(node)->identifier);
+                        write(static_cast<uint32_t>(cast<NodeStatementFunctionCall>(node)->arguments.size()));
+                        break;
+                    case Node_StatementIf:
+                        write(static_cast<uint32_t>(cast<NodeStatementIf>(node)->ifBody.size()));
+                        write(static_cast<uint32_t>(cast<NodeStatementIf>(node)->elseBody.size()));
+                        break;
+                    case Node_StatementSwitch:
+                        write(static_cast<uint32_t>(cast<NodeStatementSwitch>(node)->cases.size()));
+                        break;
+                    case Node_StatementVariable:
+                        writeSymbol(cast<NodeStatementVariable>(node)->identifier);
+                        break;
+                    case Node_StatementVariableDeclaration: {
+                        auto& variables = cast<NodeStatementVariableDeclaration>(node)->variables;
+
+                        write(static_cast<uint32_t>(variables.size()));
+
+                        for (auto& variable : variables) {
+                            writeSymbol(variable->identifier);
+                            writeSymbol(variable->type);
+                            write(static_cast<uint8_t>(variable->isConstant));
+                        }
+
+                        break;
+                    }
+                    case Node_StatementWhile:
+                        write(static_cast<uint8_t>(cast<NodeStatementWhile>(node)->doOnce));
+                        write(static_cast<uint32_t>(cast<NodeStatementWhile>(node)->body.size()));
+                        break;
+                    default:
+                        break;
+                }
+            }
+
+            const std::string& getRecords() const {
+                return m_records;
+            }
+
+            const std::vector<Symbol>& getSymbols() const {
+                return m_symbolNames;
+            }
+
+        private:
+            std::string m_records;
+            std::unordered_map<Symbol, uint32_t> m_symbols;
+            // Symbols in the order of their index in the file.
+            std::vector<Symbol> m_symbolNames;
+        };
+
+        // Anything that can be a statement of a body, the parser taking the operands of an operation from the same
+        // rule. The declarations and cases only appear where the node holding them expects them.
+        bool isStatement(Node* node) {
+            if (!node)
+                return false;
+
+            switch (node->getType()) {
+                case Node_Error:
+                case Node_Root:
+                case Node_TopFile:
+                case Node_TopFunction:
+                case Node_TopNamespace:
+                case Node_OperationCast:
+                case Node_StatementCase:
+                    return false;
+                default:
+                    return true;
+            }
+        }
+
+        bool isOptionalStatement(Node* node) {
+            return !node || isStatement(node);
+        }
+
+        bool isBody(const std::vector<Node*>& body) {
+            return std::all_of(body.begin(), body.end(), isStatement);
+        }
+
+        bool isDeclaration(Node* node) {
+            return node && (isa<NodeTopFunction>(node) || isa<NodeTopNamespace>(node) ||
+                isa<NodeStatementVariableDeclaration>(node));
+        }
+
+        // Whether the operands of a node read from the file are of the kinds the parser gives the node, and present
+        // where the passes after it expect them.
+        bool isWellFormed(Node* node) {
+            switch (node->getType()) {
+                case Node_Root: {
+                    const auto& body = cast<NodeRoot>(node)->body;
+
+                    return std::all_of(body.begin(), body.end(), [](Node* file) {
+                        return file && isa<NodeTopFile>(file);
+                    });
+                }
+                case Node_TopFile: {
+                    const auto& body = cast<NodeTopFile>(node)->body;
+
+                    return std::all_of(body.begin(), body.end(), isDeclaration);
+                }
+                case Node_TopNamespace: {
+                    const auto& body = cast<NodeTopNamespace>(node)->body;
+
+                    return std::all_of(body.begin(), body.end(), isDeclaration);
+                }
+                case Node_TopFunction:
+                    return isBody(cast<NodeTopFunction>(node)->body);
+                case Node_LiteralArray:
+                    return isBody(cast<NodeLiteralArray>(node)->elements);
+                case Node_OperationUnary:
+                    return isStatement(cast<NodeOperationUnary>(node)->expression);
+                case Node_OperationBinary:
+                    return isStatement(cast<NodeOperationBinary>(node)->lhs) &&
+                        isStatement(cast<NodeOperationBinary>(node)->rhs);
+                case Node_OperationTernary:
+                    return isStatement(cast<NodeOperationTernary>(node)->condition) &&
+                        isStatement(cast<NodeOperationTernary>(node)->lhs) &&
+                        isStatement(cast<NodeOperationTernary>(node)->rhs);
+                case Node_StatementArrayCall:
+                    return isStatement(cast<NodeStatementArrayCall>(node)->expression) &&
+                        isOptionalStatement(cast<NodeStatementArrayCall>(node)->subExpression);
+                case Node_StatementBlock:
+                    return isBody(cast<NodeStatementBlock>(node)->body);
+                case Node_StatementCase:
+                    return isOptionalStatement(cast<NodeStatementCase>(node)->expression) &&
+                        isBody(cast<NodeStatementCase>(node)->body);
+                case Node_StatementFor: {
+                    auto statement = cast<NodeStatementFor>(node);
+                    auto declaration = dyn_cast<NodeStatementVariableDeclaration>(statement->variable);
+
+                    // The variable declared by a loop is the only one of its declaration.
+                    if (statement->variable && !isa<NodeStatementVariable>(statement->variable) &&
+                        (!declaration || declaration->variables.size() != 1))
+                        return false;
+
+                    return isStatement(statement->condition) && isOptionalStatement(statement->incrementalValue) &&
+                        isBody(statement->body);
+                }
+                case Node_StatementFunctionCall:
+                    return isBody(cast<NodeStatementFunctionCall>(node)->arguments) &&
+                        isOptionalStatement(cast<NodeStatementFunctionCall>(node)->subExpression);
+                case Node_StatementIf:
+                    return isStatement(cast<NodeStatementIf>(node)->condition) &&
+                        isBody(cast<NodeStatementIf>(node)->ifBody) && isBody(cast<NodeStatementIf>(node)->elseBody);
+                case Node_StatementReturn:
+                    return isOptionalStatement(cast<NodeStatementReturn>(node)->expression);
+                case Node_StatementSwitch: {
+                    const auto& cases = cast<NodeStatementSwitch>(node)->cases;
+
+                    return isStatement(cast<NodeStatementSwitch>(node)->expression) &&
+                        std::all_of(cases.begin(), cases.end(), [](Node* statementCase) {
+                            return statementCase && isa<NodeStatementCase>(statementCase);
+                        });
+                }
+                case Node_StatementVariable: {
+                    auto subExpression = cast<NodeStatementVariable>(node)->subExpression;
+
+                    return !subExpression || isa<NodeStatementArrayCall>(subExpression);
+                }
+                case Node_StatementVariableDeclaration: {
+                    const auto& variables = cast<NodeStatementVariableDeclaration>(node)->variables;
+
+                    return std::all_of(variables.begin(), variables.end(), [](Variable* variable) {
+                        return isOptionalStatement(variable->expression);
+                    });
+                }
+                case Node_StatementWhile:
+                    return isStatement(cast<NodeStatementWhile>(node)->condition) &&
+                        isBody(cast<NodeStatementWhile>(node)->body);
+                default:
+                    return true;
+            }
+        }
+
+        // Reads are bound to the file, past its end the reader is invalid and returns zeros.
+        class Reader {
+        public:
+            Reader(const char* data, size_t size) : m_current(data), m_end(data + size) {
+
+            }
+
+            template<typename T>
+            T read() {
+                T value {};
+
+                if (static_cast<size_t>(m_end - m_current) < sizeof(T)) {
+                    m_isValid = false;
+
+                    return value;
+                }
+
+                std::memcpy(&value, m_current, sizeof(T));
+                m_current += sizeof(T);
+
+                return value;
+            }
+
+            std::string_view readString() {
+                const auto size = read<uint32_t>();
+
+                if (static_cast<size_t>(m_end - m_current) < size) {
+                    m_isValid = false;
+
+                    return std::string_view();
+                }
+
+                std::string_view value(m_current, size);
+
+                m_current += size;
+
+                return value;
+            }
+
+            ParserTokenEnum readOperation() {
+                const auto operation = read<uint8_t>();
+
+                if (operation >= ParserToken_Unknown)
+                    m_isValid = false;
+
+                return static_cast<ParserTokenEnum>(operation);
+            }
+
+            Symbol readSymbol(const std::vector<Symbol>& symbols) {
+                const auto index = read<uint32_t>();
+
+                if (index >= symbols.size()) {
+                    m_isValid = false;
+
+                    return Symbol_Empty;
+                }
+
+                return symbols[index];
+            }
+
+            size_t getRemainingSize() const {
+                return static_cast<size_t>(m_end - m_current);
+            }
+
+            bool isValid() const {
+                return m_isValid;
+            }
+
+            void invalidate() {
+                m_isValid = false;
+            }
+
+        private:
+            const char* m_current;
+            const char* m_end;
+            bool m_isValid = true;
+        };
+    }
+
+    uint64_t ASTCache::hashSource(std::string_view source) {
+        uint64_t hash = 14695981039346656037ull;
+
+        for (auto character : source) {
+            hash ^= static_cast<uint8_t>(character);
+            hash *= 1099511628211ull;
+        }
+
+        return hash;
+    }
+
+    bool ASTCache::write(const std::string& filepath, uint64_t sourceHash, NodeRoot* root) {
+        Writer writer;
+        uint32_t recordCount = 0;
+        // Postorder without recursion, the second member tells whether the operands are already written.
+        std::vector<std::pair<Node*, bool>> nodes { { root, false } };
+        std::vector<Node*> operands;
+
+        while (!nodes.empty()) {
+            auto [node, isExpanded] = nodes.back();
+
+            nodes.pop_back();
+
+            if (node && !isExpanded) {
+                if (node->getType() == Node_TopFunction && !cast<NodeTopFunction>(node)->lazyBody.empty())
+                    return false;
+
+                nodes.emplace_back(node, true);
+
+                operands.clear();
+                getOperands(node, operands);
+
+                for (auto operand = operands.rbegin(); operand != operands.rend(); ++operand)
+                    nodes.emplace_back(*operand, false);
+
+                continue;
+            }
+
+            writer.writeRecord(node);
+            recordCount++;
+        }
+
+        std::string payload;
+
+        for (auto symbol : writer.getSymbols()) {
+            const auto& name = getSymbolTable().getName(symbol);
+            const auto size = static_cast<uint32_t>(name.size());
+
+            payload.append(reinterpret_cast<const char*>(&size), sizeof(size));
+            payload.append(name);
+        }
+
+        payload.append(writer.getRecords());
+
+        Header header {};
+
+        std::memcpy(header.magic, Magic, sizeof(Magic));
+        header.version = Version;
+        header.sourceHash = sourceHash;
+        header.payloadHash = hashSource(payload);
+        header.symbolCount = static_cast<uint32_t>(writer.getSymbols().size());
+        header.recordCount = recordCount;
+
+        // Written aside then renamed, a cache is never seen half written.
+        const auto temporaryFilepath = filepath + ".tmp";
+
+        {
+            std::ofstream file(temporaryFilepath, std::ios::out | std::ios::binary | std::ios::trunc);
+
+            if (file.fail())
+                return false;
+
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            file.write(payload.data(), payload.size());
+
+            if (file.fail())
+                return false;
+        }
+
+        std::error_code error;
+
+        std::filesystem::rename(temporaryFilepath, filepath, error);
+
+        if (error) {
+            std::filesystem::remove(temporaryFilepath, error);
+
+            return false;
+        }
+
+        return true;
+    }
+
+    NodeRoot* ASTCache::read(ASTContext& context, const std::string& filepath, uint64_t sourceHash) {
+        SourceBuffer file;
+
+        if (!file.open(filepath))
+            return nullptr;
+
+        Reader reader(file.getData(), file.getSize());
+        const auto header = reader.read<Header>();
+
+        if (!reader.isValid() || std::memcmp(header.magic, Magic, sizeof(Magic)) != 0 ||
+            header.version != Version || header.sourceHash != sourceHash ||
+            header.symbolCount > reader.getRemainingSize() / sizeof(uint32_t) ||
+            hashSource(std::string_view(file.getData() + sizeof(Header), reader.getRemainingSize())) !=
+            header.payloadHash) {
+            return nullptr;
+        }
+
+        std::vector<Symbol> symbols(header.symbolCount);
+
+        for (auto& symbol : symbols)
+            symbol = getSymbolTable().intern(reader.readString());
+
+        // Nodes waiting for the record that takes them.
+        std::vector<Node*> nodes;
+        std::vector<Node*> operands;
+
+        // Move the last count nodes to operands, in the order they were written. Fails once the record is damaged,
+        // so no node is created from it.
+        const auto take = [&](size_t count) {
+            operands.clear();
+
+            if (!reader.isValid() || count > nodes.size()) {
+                reader.invalidate();
+
+                return false;
+            }
+
+            operands.assign(nodes.end() - count, nodes.end());
+            nodes.resize(nodes.size() - count);
+
+            return true;
+        };
+        const auto list = [&](size_t begin, size_t count) {
+            return std::vector<Node*>(operands.begin() + begin, operands.begin() + begin + count);
+        };
+
+        for (uint32_t i = 0; i < header.recordCount && reader.isValid(); i++) {
+            const auto kind = reader.read<uint8_t>();
+            Node* node = nullptr;
+
+            switch (kind) {
+                case Node_Error:
+                    break;
+                case Node_Root: {
+                    const auto count = reader.read<uint32_t>();
+
+                    if (take(count))
+                        node = context.create<NodeRoot>(list(0, count));
+
+                    break;
+                }
+                case Node_TopFile: {
+                    std::string path(reader.readString());
+                    const auto count = reader.read<uint32_t>();
+
+                    if (take(count))
+                        node = context.create<NodeTopFile>(path, list(0, count));
+
+                    break;
+                }
+                case Node_TopFunction: {
+                    const auto identifier = reader.readSymbol(symbols);
+                    const auto type = reader.readSymbol(symbols);
+                    const auto argumentCount = reader.read<uint32_t>();
+                    std::vector<Argument> arguments;
+
+                    if (argumentCount > reader.getRemainingSize() / (2 * sizeof(uint32_t))) {
+                        reader.invalidate();
+
+                        break;
+                    }
+
+                    arguments.reserve(argumentCount);
+
+                    for (uint32_t j = 0; j < argumentCount; j++) {
+                        const auto argumentIdentifier = reader.readSymbol(symbols);
+
+                        arguments.emplace_back(argumentIdentifier, reader.readSymbol(symbols));
+                    }
+
+                    const auto count = reader.read<uint32_t>();
+
+                    if (take(count))
+                        node = context.create<NodeTopFunction>(identifier, type, arguments, list(0, count));
+
+                    break;
+                }
+                case Node_TopNamespace: {
+                    const auto identifier = reader.readSymbol(symbols);
+                    const auto count = reader.read<uint32_t>();
+
+                    if (take(count))
+                        node = context.create<NodeTopNamespace>(identifier, list(0, count));
+
+                    break;
+                }
+                case Node_LiteralArray: {
+                    const auto count = reader.read<uint32_t>();
+
+                    if (take(count))
+                        node = context.create<NodeLiteralArray>(list(0, count));
+
+                    break;
+                }
+                case Node_LiteralBoolean:
+                    node = context.create<NodeLiteralBoolean>(reader.read<uint8_t>() != 0);
+                    break;
+                case Node_LiteralCharacter:
+                    node = context.create<NodeLiteralCharacter>(std::string(reader.readString()));
+                    break;
+                case Node_LiteralNumberFloating:
+                    node = context.create<NodeLiteralNumberFloating>(reader.read<double>());
+                    break;
+                case Node_LiteralNumberInteger: {
+                    const auto value = reader.read<int64_t>();
+                    const auto isUnsigned = reader.read<uint8_t>() != 0;
+
+                    node = context.create<NodeLiteralNumberInteger>(value, isUnsigned);
+                    break;
+                }
+                case Node_LiteralString:
+                    node = context.create<NodeLiteralString>(std::string(reader.readString()));
+                    break;
+                case Node_OperationUnary: {
+                    const auto operation = reader.readOperation();
+                    const auto left = reader.read<uint8_t>() != 0;
+
+                    if (take(1))
+                        node = context.create<NodeOperationUnary>(operation, operands[0], left);
+
+                    break;
+                }
+                case Node_OperationBinary: {
+                    const auto operation = reader.readOperation();
+
+                    if (take(2))
+                        node = context.create<NodeOperationBinary>(operation, operands[0], operands[1]);
+
+                    break;
+                }
+                case Node_OperationTernary:
+                    if (take(3))
+                        node = context.create<NodeOperationTernary>(operands[0], operands[1], operands[2]);
+
+                    break;
+                case Node_StatementArrayCall:
+                    if (take(2))
+                        node = context.create<NodeStatementArrayCall>(operands[0], operands[1]);
+
+                    break;
+                case Node_StatementBlock: {
+                    const auto count = reader.read<uint32_t>();
+
+                    if (take(count))
+                        node = context.create<NodeStatementBlock>(list(0, count));
+
+                    break;
+                }
+                case Node_StatementBreak:
+                    node = context.create<NodeStatementBreak>();
+                    break;
+                case Node_StatementCase: {
+                    const auto count = reader.read<uint32_t>();
+
+                    if (take(size_t(1) + count))
+                        node = context.create<NodeStatementCase>(operands[0], list(1, count));
+
+                    break;
+                }
+                case Node_StatementContinue:
+                    node = context.create<NodeStatementContinue>();
+                    break;
+                case Node_StatementFor: {
+                    const auto count = reader.read<uint32_t>();
+
+                    if (take(size_t(3) + count))
+                        node = context.create<NodeStatementFor>(operands[0], operands[1], operands[2], list(3, count));
+
+                    break;
+                }
+                case Node_StatementFunctionCall: {
+                    const auto identifier = reader.readSymbol(symbols);
+                    const auto count = reader.read<uint32_t>();
+
+                    if (take(size_t(count) + 1))
+                        node = context.create<NodeStatementFunctionCall>(identifier, list(0, count), operands[count]);
+
+                    break;
+                }
+                case Node_StatementIf: {
+                    const auto ifCount = reader.read<uint32_t>();
+                    const auto elseCount = reader.read<uint32_t>();
+
+                    if (take(size_t(1) + ifCount + elseCount))
+                        node = context.create<NodeStatementIf>(operands[0], list(1, ifCount), list(1 + ifCount, elseCount));
+
+                    break;
+                }
+                case Node_StatementReturn:
+                    if (take(1))
+                        node = context.create<NodeStatementReturn>(operands[0]);
+
+                    break;
+                case Node_StatementSwitch: {
+                    const auto count = reader.read<uint32_t>();
+
+                    if (take(size_t(1) + count))
+                        node = context.create<NodeStatementSwitch>(operands[0], list(1, count));
+
+                    break;
+                }
+                case Node_StatementVariable: {
+                    const auto identifier = reader.readSymbol(symbols);
+
+                    if (take(1))
+                        node = context.create<NodeStatementVariable>(identifier, operands[0]);
+
+                    break;
+                }
+                case Node_StatementVariableDeclaration: {
+                    const auto count = reader.read<uint32_t>();
+                    std::vector<Variable*> variables;
+
+                    if (!take(count))
+                        break;
+
+                    variables.reserve(count);
+
+                    for (uint32_t j = 0; j < count; j++) {
+                        const auto identifier = reader.readSymbol(symbols);
+                        const auto type = reader.readSymbol(symbols);
+                        const auto isConstant = reader.read<uint8_t>() != 0;
+
+                        variables.emplace_back(context.create<Variable>(identifier, type, isConstant, operands[j]));
+                    }
+
+                    node = context.create<NodeStatementVariableDeclaration>(variables);
+                    break;
+                }
+                case Node_StatementWhile: {
+                    const auto doOnce = reader.read<uint8_t>() != 0;
+                    const auto count = reader.read<uint32_t>();
+
+                    if (take(size_t(1) + count))
+                        node = context.create<NodeStatementWhile>(doOnce, operands[0], list(1, count));
+
+                    break;
+                }
+                default:
+                    reader.invalidate();
+                    break;
+            }
+
+            if (node && !isWellFormed(node))
+                reader.invalidate();
+
+            if (node && reader.isValid()) {
+                for (auto& child : node->children) {
+                    if (child)
+                        child->parent = node;
+                }
+            }
+
+            nodes.push_back(node);
+        }
+
+        // Nodes created before a damaged record stay in the context until it is cleared.
+        if (!reader.isValid() || reader.getRemainingSize() != 0 || nodes.size() != 1 || !nodes[0] ||
+            nodes[0]->getType() != Node_Root) {
+            return nullptr;
+        }
+
+        return cast<NodeRoot>(nodes[0]);
+    }
+
+} /* Namespace Aryiele. */
@@ -0,0 +1,101 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#include <algorithm>
+#include <cstdint>
+#include <Aryiele/AST/ASTContext.h>
+
+namespace Aryiele {
+    namespace {
+        const size_t BlockSize = 64 * 1024;
+    }
+
+    ASTContext::~ASTContext() {
+        clear();
+    }
+
+    void ASTContext::clear() {
+        // Destroyed in reverse, the way scoped objects would be.
+        for (auto destructor = m_destructors.rbegin(); destructor != m_destructors.rend(); ++destructor)
+            destructor->destroy(destructor->object);
+
+        m_destructors.clear();
+        m_blocks.clear();
+        m_current = nullptr;
+        m_end = nullptr;
+        m_objectCount = 0;
+        m_reservedSize = 0;
+    }
+
+    void ASTContext::merge(ASTContext& other) {
+        // The blocks are only added: new objects keep going to the current block.
+        for (auto& block : other.m_blocks)
+            m_blocks.push_back(std::move(block));
+
+        m_destructors.insert(m_destructors.end(), other.m_destructors.begin(), other.m_destructors.end());
+        m_objectCount += other.m_objectCount;
+        m_reservedSize += other.m_reservedSize;
+
+        other.m_destructors.clear();
+        other.m_blocks.clear();
+        other.m_current = nullptr;
+        other.m_end = nullptr;
+        other.m_objectCount = 0;
+        other.m_reservedSize = 0;
+    }
+
+    size_t ASTContext::getObjectCount() const {
+        return m_objectCount;
+    }
+
+    size_t ASTContext::getReservedSize() const {
+        return m_reservedSize;
+    }
+
+    void* ASTContext::allocate(size_t size, size_t alignment) {
+        auto address = reinterpret_cast<uintptr_t>(m_current);
+        auto aligned = (address + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+
+        if (!m_current || aligned + size > reinterpret_cast<uintptr_t>(m_end)) {
+            // Objects larger than a block get a block of their own.
+            const auto blockSize = std::max(BlockSize, size + alignment);
+
+            m_blocks.emplace_back(new char[blockSize]);
+            m_current = m_blocks.back().get();
+            m_end = m_current + blockSize;
+            m_reservedSize += blockSize;
+
+            address = reinterpret_cast<uintptr_t>(m_current);
+            aligned = (address + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+        }
+
+        m_current = reinterpret_cast<char*>(aligned + size);
+
+        return reinterpret_cast<void*>(aligned);
+    }
+
+} /* Namespace Aryiele. */
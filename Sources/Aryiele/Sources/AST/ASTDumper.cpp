@@ -0,0 +1,499 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#include <Vanir/FileSystem/FileSystem.h>
+#include <Aryiele/AST/ASTDumper.h>
+#include <Aryiele/AST/Variable.h>
+#include <Aryiele/Utility/SymbolTable.h>
+
+namespace Aryiele {
+    void ASTDumper::visitLiteralArray(NodeLiteralArray* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "Array");
+        auto elementsNode = std::make_shared<ParserInformation>(information, "Elements:");
+        
+        for (int i = 0; i < node->elements.size(); i++) {
+            auto elementNode = std::make_shared<ParserInformation>(elementsNode, std::to_string(i) + ": ");
+            auto elementExpressionNode = std::make_shared<ParserInformation>(elementNode, "Expression:");
+    
+            visit(node->elements.at(i), elementExpressionNode);
+    
+            elementNode->children.emplace_back(elementExpressionNode);
+    
+            elementsNode->children.emplace_back(elementNode);
+        }
+    
+        information->children.emplace_back(elementsNode);
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitLiteralBoolean(NodeLiteralBoolean* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "Boolean");
+        auto bodyNode = std::make_shared<ParserInformation>(information, "Value: " + std::to_string(node->value));
+        
+        information->children.emplace_back(bodyNode);
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitLiteralCharacter(NodeLiteralCharacter* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "Character");
+        auto bodyNode = std::make_shared<ParserInformation>(information, "Value: " + node->value);
+        
+        information->children.emplace_back(bodyNode);
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitLiteralNumberFloating(NodeLiteralNumberFloating* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "Double");
+        auto bodyNode = std::make_shared<ParserInformation>(information, "Value: " + std::to_string(node->value));
+
+        information->children.emplace_back(bodyNode);
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitLiteralNumberInteger(NodeLiteralNumberInteger* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "Integer");
+        auto value = node->isUnsigned ? std::to_string(static_cast<uint64_t>(node->value)) : std::to_string(node->value);
+        auto bodyNode = std::make_shared<ParserInformation>(information, "Value: " + value);
+
+        information->children.emplace_back(bodyNode);
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitLiteralString(NodeLiteralString* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "String");
+        auto bodyNode = std::make_shared<ParserInformation>(information, "Value: " + node->value);
+        
+        information->children.emplace_back(bodyNode);
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitOperationBinary(NodeOperationBinary* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "Binary Operation");
+        auto operationTypeNode = std::make_shared<ParserInformation>(
+            information, "Type: " + ParserToken::getTypeName(node->operationType));
+        auto lhsNode = std::make_shared<ParserInformation>(information, "LHS:");
+        auto rhsNode = std::make_shared<ParserInformation>(information, "RHS:");
+    
+        visit(node->lhs, lhsNode);
+        visit(node->rhs, rhsNode);
+
+        information->children.emplace_back(operationTypeNode);
+        information->children.emplace_back(lhsNode);
+        information->children.emplace_back(rhsNode);
+
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitOperationTernary(NodeOperationTernary* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "Ternary Operation");
+        auto conditionNode = std::make_shared<ParserInformation>(information, "Condition:");
+        auto lhsNode = std::make_shared<ParserInformation>(information, "LHS:");
+        auto rhsNode = std::make_shared<ParserInformation>(information, "RHS:");
+        
+        visit(node->condition, conditionNode);
+        visit(node->lhs, lhsNode);
+        visit(node->rhs, rhsNode);
+        
+        information->children.emplace_back(conditionNode);
+        information->children.emplace_back(lhsNode);
+        information->children.emplace_back(rhsNode);
+        
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitOperationCast(NodeOperationCast* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "Cast Operation");
+        auto typeNode = std::make_shared<ParserInformation>(information, "Type: " + node->valueType->getName());
+        auto expressionNode = std::make_shared<ParserInformation>(information, "Expression:");
+        
+        visit(node->expression, expressionNode);
+        
+        information->children.emplace_back(typeNode);
+        information->children.emplace_back(expressionNode);
+        
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitOperationUnary(NodeOperationUnary* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "Unary Operation");
+        auto sideNode = std::make_shared<ParserInformation>(information, std::string("Side: ") + std::string(node->left ? "Left" : "Right"));
+        auto operationTypeNode = std::make_shared<ParserInformation>(
+            information, "Type: " + ParserToken::getTypeName(node->operationType));
+        auto expressionNode = std::make_shared<ParserInformation>(information, "Operand:");
+    
+        visit(node->expression, expressionNode);
+    
+        information->children.emplace_back(sideNode);
+        information->children.emplace_back(operationTypeNode);
+        information->children.emplace_back(expressionNode);
+    
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitRoot(NodeRoot* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "Root");
+    
+        for (auto& childNode : node->body) {
+            visit(childNode, information);
+        }
+    
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitStatementArrayCall(NodeStatementArrayCall* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "Array Call");
+        auto elementsNode = std::make_shared<ParserInformation>(information, "Element:");
+        auto subExpressionNode = std::make_shared<ParserInformation>(information, "Subexpression:");
+    
+        visit(node->expression, elementsNode);
+        
+        information->children.emplace_back(elementsNode);
+    
+        if (node->subExpression) {
+            visit(node->subExpression, subExpressionNode);
+            information->children.emplace_back(subExpressionNode);
+        }
+        
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitStatementBlock(NodeStatementBlock* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "Block");
+        auto bodyNode = std::make_shared<ParserInformation>(information, "Body:");
+
+        for (auto& statement : node->body)
+            visit(statement, bodyNode);
+
+        information->children.emplace_back(bodyNode);
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitStatementBreak(NodeStatementBreak* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "Break");
+        
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitStatementCase(NodeStatementCase* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, node->expression ? "Case" : "Default");
+        std::shared_ptr<ParserInformation> expressionNode = nullptr;
+        auto bodyNode = std::make_shared<ParserInformation>(information, "Body:");
+        
+        if (node->expression) {
+            expressionNode = std::make_shared<ParserInformation>(information, "Expression:");
+    
+            visit(node->expression, expressionNode);
+    
+            information->children.emplace_back(expressionNode);
+        }
+    
+        for (auto& j : node->body) {
+            visit(j, bodyNode);
+        }
+    
+        information->children.emplace_back(bodyNode);
+    
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitStatementContinue(NodeStatementContinue* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "Continue");
+    
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitStatementFor(NodeStatementFor* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "For");
+        auto variableNode = std::make_shared<ParserInformation>(information, "Variable:");
+        auto conditionNode = std::make_shared<ParserInformation>(information, "Condition:");
+        auto incrementalValueNode = std::make_shared<ParserInformation>(information, "Incremental Value:");
+        auto bodyNode = std::make_shared<ParserInformation>(information, "Body:");
+    
+        if (node->variable) {
+            visit(node->variable, variableNode);
+        }
+        visit(node->condition, conditionNode);
+        
+        for (auto& i : node->body) {
+            visit(i, bodyNode);
+        }
+        
+        if (node->incrementalValue) {
+            visit(node->incrementalValue, incrementalValueNode);
+        }
+    
+        if (node->variable) {
+            information->children.emplace_back(variableNode);
+        }
+        information->children.emplace_back(conditionNode);
+    
+        if (node->incrementalValue != nullptr) {
+            information->children.emplace_back(incrementalValueNode);
+        }
+        
+        information->children.emplace_back(bodyNode);
+    
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitStatementFunctionCall(NodeStatementFunctionCall* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "Function Call");
+        auto identifierNode = std::make_shared<ParserInformation>(information, "Identifier: " + getSymbolTable().getName(node->identifier));
+        auto argumentsNode = std::make_shared<ParserInformation>(information, "Arguments:");
+        auto subExpressionNode = std::make_shared<ParserInformation>(information, "Subexpression:");
+
+        auto i = 0;
+
+        for(auto& argument : node->arguments) {
+            auto argumentNode = std::make_shared<ParserInformation>(argumentsNode, std::to_string(i));
+            auto body = std::make_shared<ParserInformation>(argumentNode, "Body:");
+
+            visit(argument, body);
+
+            argumentNode->children.emplace_back(body);
+            argumentsNode->children.emplace_back(argumentNode);
+
+            i++;
+        }
+
+        information->children.emplace_back(identifierNode);
+        
+        if (!node->arguments.empty()) {
+            information->children.emplace_back(argumentsNode);
+        }
+        
+        if (node->subExpression) {
+            visit(node->subExpression, subExpressionNode);
+            information->children.emplace_back(subExpressionNode);
+        }
+        
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitStatementIf(NodeStatementIf* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "If/Else");
+        auto ifNode = std::make_shared<ParserInformation>(information, "If");
+        auto ifConditionNode = std::make_shared<ParserInformation>(ifNode, "Condition:");
+        auto ifBodyNode = std::make_shared<ParserInformation>(ifNode, "Body:");
+
+        visit(node->condition, ifConditionNode);
+
+        for (auto& i : node->ifBody)
+            visit(i, ifBodyNode);
+
+        ifNode->children.emplace_back(ifConditionNode);
+        ifNode->children.emplace_back(ifBodyNode);
+        information->children.emplace_back(ifNode);
+
+        if (!node->elseBody.empty()) {
+            auto elseNode = std::make_shared<ParserInformation>(information, "Else");
+            auto elseBodyNode = std::make_shared<ParserInformation>(elseNode, "Body:");
+
+            for (auto& i : node->elseBody)
+                visit(i, elseBodyNode);
+
+            elseNode->children.emplace_back(elseBodyNode);
+            information->children.emplace_back(elseNode);
+        }
+
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitStatementReturn(NodeStatementReturn* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "Return");
+        
+        if (node->expression) {
+            auto bodyNode = std::make_shared<ParserInformation>(information, "Body:");
+    
+            visit(node->expression, bodyNode);
+            information->children.emplace_back(bodyNode);
+        }
+
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitStatementSwitch(NodeStatementSwitch* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "Switch");
+        auto expressionNode = std::make_shared<ParserInformation>(information, "Expression:");
+        std::shared_ptr<ParserInformation> casesNode = nullptr;
+        
+        if (!node->cases.empty()) {
+            casesNode = std::make_shared<ParserInformation>(information, "Cases:");
+        }
+    
+        visit(node->expression, expressionNode);
+        
+        for (auto& caseNode : node->cases) {
+            visit(caseNode, casesNode);
+        }
+    
+        information->children.emplace_back(expressionNode);
+        
+        if (!node->cases.empty()) {
+            information->children.emplace_back(casesNode);
+        }
+        
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitStatementVariable(NodeStatementVariable* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "Variable");
+        auto bodyNode = std::make_shared<ParserInformation>(information, "Identifier: " + getSymbolTable().getName(node->identifier));
+        auto subExpressionNode = std::make_shared<ParserInformation>(information, "Subexpression:");
+
+        information->children.emplace_back(bodyNode);
+        
+        if (node->subExpression) {
+            visit(node->subExpression, subExpressionNode);
+            information->children.emplace_back(subExpressionNode);
+        }
+        
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitStatementVariableDeclaration(NodeStatementVariableDeclaration* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "Variable Declaration");
+        auto constantNode = std::make_shared<ParserInformation>(parentNode,
+            std::string("Constant") + std::string(node->variables.size() > 1 ? "s" : "") +
+            std::string(": ") + std::string(node->variables.at(0)->isConstant ? "true" : "false"));
+    
+        information->children.emplace_back(constantNode);
+        
+        auto i = 0;
+
+        for (auto &variable : node->variables) {
+            auto variableNode = std::make_shared<ParserInformation>(information, std::to_string(i));
+
+            variableNode->children.emplace_back(std::make_shared<ParserInformation>(
+                    variableNode, "Identifier: " + getSymbolTable().getName(variable->identifier)));
+            
+            if (variable->type != Symbol_Empty) {
+                variableNode->children.emplace_back(std::make_shared<ParserInformation>(variableNode,
+                    "Type: " + getSymbolTable().getName(variable->type)));
+            }
+
+            if (variable->expression) {
+                auto valueNode = std::make_shared<ParserInformation>(variableNode, "Expression:");
+                visit(variable->expression, valueNode);
+                variableNode->children.emplace_back(valueNode);
+            }
+
+            information->children.emplace_back(variableNode);
+
+            i++;
+        }
+
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitStatementWhile(NodeStatementWhile* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "While");
+        auto doOnceNode = std::make_shared<ParserInformation>(information,
+            std::string("Do: ") + std::string((node->doOnce ? "true" : "false")));
+        auto conditionNode = std::make_shared<ParserInformation>(information, "Condition:");
+        auto bodyNode = std::make_shared<ParserInformation>(information, "Body:");
+    
+        visit(node->condition, conditionNode);
+    
+        for (auto& i : node->body) {
+            visit(i, bodyNode);
+        }
+    
+        information->children.emplace_back(doOnceNode);
+        information->children.emplace_back(conditionNode);
+        information->children.emplace_back(bodyNode);
+    
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitTopFile(NodeTopFile* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "File");
+        auto identifierNode = std::make_shared<ParserInformation>(information,
+            "Identifier: " + Vanir::FileSystem::getFilePath(node->path));
+        auto bodyNode = std::make_shared<ParserInformation>(information, "Body:");
+    
+        for (auto& childNode : node->body) {
+            visit(childNode, bodyNode);
+        }
+    
+        information->children.emplace_back(identifierNode);
+        information->children.emplace_back(bodyNode);
+    
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitTopFunction(NodeTopFunction* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "Function");
+        auto argumentsNode = std::make_shared<ParserInformation>(information, "Arguments:");
+        auto valueNode = std::make_shared<ParserInformation>(information, "Body:");
+
+        for (auto& childNode : node->body)
+            visit(childNode, valueNode);
+
+        int i = 0;
+
+        for(auto& argument : node->arguments) {
+            auto argumentNode = std::make_shared<ParserInformation>(argumentsNode, std::to_string(i));
+
+            argumentNode->children.emplace_back(std::make_shared<ParserInformation>(
+                argumentNode, "Identifier: " + getSymbolTable().getName(argument.identifier)));
+            argumentNode->children.emplace_back(std::make_shared<ParserInformation>(
+                argumentNode, "Type: " + getSymbolTable().getName(argument.type)));
+
+            argumentsNode->children.emplace_back(argumentNode);
+
+            i++;
+        }
+
+        information->children.emplace_back(std::make_shared<ParserInformation>(information, "Identifier: " + getSymbolTable().getName(node->identifier)));
+        information->children.emplace_back(std::make_shared<ParserInformation>(information, "Type: " + getSymbolTable().getName(node->type)));
+        
+        if (!node->arguments.empty()) {
+            information->children.emplace_back(argumentsNode);
+        }
+        
+        information->children.emplace_back(valueNode);
+
+        parentNode->children.emplace_back(information);
+    }
+    
+    void ASTDumper::visitTopNamespace(NodeTopNamespace* node, std::shared_ptr<ParserInformation> parentNode) {
+        auto information = std::make_shared<ParserInformation>(parentNode, "Namespace");
+        auto identifierNode = std::make_shared<ParserInformation>(information, "Identifier: " + getSymbolTable().getName(node->identifier));
+        auto bodyNode = std::make_shared<ParserInformation>(information, "Body:");
+    
+        for (auto& statement : node->body) {
+            visit(statement, bodyNode);
+        }
+    
+        information->children.emplace_back(identifierNode);
+        information->children.emplace_back(bodyNode);
+        
+        parentNode->children.emplace_back(information);
+    }
+    
+} /* Namespace Aryiele. */
@@ -0,0 +1,157 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#include <Aryiele/AST/ASTOperands.h>
+#include <Aryiele/AST/Variable.h>
+#include <Aryiele/AST/Nodes/NodeLiteralArray.h>
+#include <Aryiele/AST/Nodes/NodeOperationBinary.h>
+#include <Aryiele/AST/Nodes/NodeOperationCast.h>
+#include <Aryiele/AST/Nodes/NodeOperationTernary.h>
+#include <Aryiele/AST/Nodes/NodeOperationUnary.h>
+#include <Aryiele/AST/Nodes/NodeRoot.h>
+#include <Aryiele/AST/Nodes/NodeStatementArrayCall.h>
+#include <Aryiele/AST/Nodes/NodeStatementBlock.h>
+#include <Aryiele/AST/Nodes/NodeStatementCase.h>
+#include <Aryiele/AST/Nodes/NodeStatementFor.h>
+#include <Aryiele/AST/Nodes/NodeStatementFunctionCall.h>
+#include <Aryiele/AST/Nodes/NodeStatementIf.h>
+#include <Aryiele/AST/Nodes/NodeStatementReturn.h>
+#include <Aryiele/AST/Nodes/NodeStatementSwitch.h>
+#include <Aryiele/AST/Nodes/NodeStatementVariable.h>
+#include <Aryiele/AST/Nodes/NodeStatementVariableDeclaration.h>
+#include <Aryiele/AST/Nodes/NodeStatementWhile.h>
+#include <Aryiele/AST/Nodes/NodeTopFile.h>
+#include <Aryiele/AST/Nodes/NodeTopFunction.h>
+#include <Aryiele/AST/Nodes/NodeTopNamespace.h>
+
+namespace Aryiele {
+    namespace {
+        // Calls the function on each field holding a node under this one, in order.
+        template<typename Function>
+        void forEachOperand(Node* node, Function function) {
+            const auto forEach = [&](std::vector<Node*>& nodes) {
+                for (auto& element : nodes)
+                    function(element);
+            };
+
+            switch (node->getType()) {
+                case Node_Root:
+                    forEach(cast<NodeRoot>(node)->body);
+                    break;
+                case Node_TopFile:
+                    forEach(cast<NodeTopFile>(node)->body);
+                    break;
+                case Node_TopFunction:
+                    forEach(cast<NodeTopFunction>(node)->body);
+                    break;
+                case Node_TopNamespace:
+                    forEach(cast<NodeTopNamespace>(node)->body);
+                    break;
+                case Node_LiteralArray:
+                    forEach(cast<NodeLiteralArray>(node)->elements);
+                    break;
+                case Node_OperationUnary:
+                    function(cast<NodeOperationUnary>(node)->expression);
+                    break;
+                case Node_OperationBinary:
+                    function(cast<NodeOperationBinary>(node)->lhs);
+                    function(cast<NodeOperationBinary>(node)->rhs);
+                    break;
+                case Node_OperationTernary:
+                    function(cast<NodeOperationTernary>(node)->condition);
+                    function(cast<NodeOperationTernary>(node)->lhs);
+                    function(cast<NodeOperationTernary>(node)->rhs);
+                    break;
+                case Node_OperationCast:
+                    function(cast<NodeOperationCast>(node)->expression);
+                    break;
+                case Node_StatementArrayCall:
+                    function(cast<NodeStatementArrayCall>(node)->expression);
+                    function(cast<NodeStatementArrayCall>(node)->subExpression);
+                    break;
+                case Node_StatementBlock:
+                    forEach(cast<NodeStatementBlock>(node)->body);
+                    break;
+                case Node_StatementCase:
+                    function(cast<NodeStatementCase>(node)->expression);
+                    forEach(cast<NodeStatementCase>(node)->body);
+                    break;
+                case Node_StatementFor: {
+                    auto statement = cast<NodeStatementFor>(node);
+
+                    function(statement->variable);
+                    function(statement->condition);
+                    function(statement->incrementalValue);
+                    forEach(statement->body);
+                    break;
+                }
+                case Node_StatementFunctionCall:
+                    forEach(cast<NodeStatementFunctionCall>(node)->arguments);
+                    function(cast<NodeStatementFunctionCall>(node)->subExpression);
+                    break;
+                case Node_StatementIf:
+                    function(cast<NodeStatementIf>(node)->condition);
+                    forEach(cast<NodeStatementIf>(node)->ifBody);
+                    forEach(cast<NodeStatementIf>(node)->elseBody);
+                    break;
+                case Node_StatementReturn:
+                    function(cast<NodeStatementReturn>(node)->expression);
+                    break;
+                case Node_StatementSwitch:
+                    function(cast<NodeStatementSwitch>(node)->expression);
+                    forEach(cast<NodeStatementSwitch>(node)->cases);
+                    break;
+                case Node_StatementVariable:
+                    function(cast<NodeStatementVariable>(node)->subExpression);
+                    break;
+                case Node_StatementVariableDeclaration:
+                    for (auto& variable : cast<NodeStatementVariableDeclaration>(node)->variables)
+                        function(variable->expression);
+                    break;
+                case Node_StatementWhile:
+                    function(cast<NodeStatementWhile>(node)->condition);
+                    forEach(cast<NodeStatementWhile>(node)->body);
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    void getOperands(Node* node, std::vector<Node*>& operands) {
+        forEachOperand(node, [&](Node*& operand) {
+            operands.push_back(operand);
+        });
+    }
+
+    void getOperands(Node* node, std::vector<Node**>& operands) {
+        forEachOperand(node, [&](Node*& operand) {
+            operands.push_back(&operand);
+        });
+    }
+
+} /* Namespace Aryiele. */
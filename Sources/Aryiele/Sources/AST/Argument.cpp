@@ -28,7 +28,7 @@
 #include <Aryiele/AST/Argument.h>
 
 namespace Aryiele {
-    Argument::Argument(const std::string& identifier, const std::string& type) :
+    Argument::Argument(Symbol identifier, Symbol type) :
         identifier(identifier), type(type) {
 
     }
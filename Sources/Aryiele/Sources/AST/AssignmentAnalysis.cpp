@@ -0,0 +1,394 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#include <algorithm>
+#include <Aryiele/AST/AssignmentAnalysis.h>
+#include <Aryiele/AST/Nodes/NodeLiteralArray.h>
+#include <Aryiele/AST/Nodes/NodeOperationBinary.h>
+#include <Aryiele/AST/Nodes/NodeOperationCast.h>
+#include <Aryiele/AST/Nodes/NodeOperationTernary.h>
+#include <Aryiele/AST/Nodes/NodeOperationUnary.h>
+#include <Aryiele/AST/Nodes/NodeStatementArrayCall.h>
+#include <Aryiele/AST/Nodes/NodeStatementBlock.h>
+#include <Aryiele/AST/Nodes/NodeStatementCase.h>
+#include <Aryiele/AST/Nodes/NodeStatementFor.h>
+#include <Aryiele/AST/Nodes/NodeStatementFunctionCall.h>
+#include <Aryiele/AST/Nodes/NodeStatementIf.h>
+#include <Aryiele/AST/Nodes/NodeStatementReturn.h>
+#include <Aryiele/AST/Nodes/NodeStatementSwitch.h>
+#include <Aryiele/AST/Nodes/NodeStatementVariable.h>
+#include <Aryiele/AST/Nodes/NodeStatementVariableDeclaration.h>
+#include <Aryiele/AST/Nodes/NodeStatementWhile.h>
+
+namespace Aryiele {
+    namespace {
+        bool isAssignment(ParserTokenEnum operation) {
+            return operation == ParserToken_OperatorEqual ||
+                operation == ParserToken_OperatorArithmeticPlusEqual ||
+                operation == ParserToken_OperatorArithmeticMinusEqual ||
+                operation == ParserToken_OperatorArithmeticMultiplyEqual ||
+                operation == ParserToken_OperatorArithmeticDivideEqual ||
+                operation == ParserToken_OperatorArithmeticRemainderEqual;
+        }
+    }
+
+    void AssignmentAnalysis::analyze(NodeTopFunction* function) {
+        m_blocks.clear();
+        m_slotCount = function->slotCount;
+        m_isConstant.assign(m_slotCount, false);
+        m_continueTargets.clear();
+        m_breakTargets.clear();
+        m_reassignments.clear();
+
+        m_current = createBlock();
+
+        visitBody(function->body);
+        solve();
+    }
+
+    bool AssignmentAnalysis::isReassignment(Node* node) const {
+        return m_reassignments.count(node) != 0;
+    }
+
+    uint32_t AssignmentAnalysis::createBlock() {
+        m_blocks.emplace_back();
+
+        return static_cast<uint32_t>(m_blocks.size() - 1);
+    }
+
+    void AssignmentAnalysis::link(uint32_t from, uint32_t to) {
+        m_blocks[from].successors.push_back(to);
+    }
+
+    void AssignmentAnalysis::declare(Variable* variable) {
+        if (!variable->isConstant || variable->slot == Slot_Unresolved)
+            return;
+
+        m_isConstant[variable->slot] = true;
+        m_blocks[m_current].events.push_back({ variable->slot, true, variable->expression != nullptr, nullptr });
+    }
+
+    // A write always follows the declaration it was bound to.
+    void AssignmentAnalysis::write(NodeStatementVariable* variable, Node* node) {
+        if (variable->isGlobal || variable->slot == Slot_Unresolved || !m_isConstant[variable->slot])
+            return;
+
+        m_blocks[m_current].events.push_back({ variable->slot, false, true, node });
+    }
+
+    void AssignmentAnalysis::visitBody(const std::vector<Node*>& body) {
+        for (auto& statement : body)
+            visit(statement);
+    }
+
+    // Blocks are split where CodeGenerator splits them, and operands are visited in the order they are generated in.
+    void AssignmentAnalysis::visit(Node* node) {
+        if (!node)
+            return;
+
+        switch (node->getType()) {
+            case Node_LiteralArray:
+                visitBody(cast<NodeLiteralArray>(node)->elements);
+                break;
+            case Node_OperationUnary: {
+                auto operation = cast<NodeOperationUnary>(node);
+
+                visit(operation->expression);
+
+                if ((operation->operationType == ParserToken_OperatorUnaryArithmeticIncrement ||
+                     operation->operationType == ParserToken_OperatorUnaryArithmeticDecrement) &&
+                    isa<NodeStatementVariable>(operation->expression))
+                    write(cast<NodeStatementVariable>(operation->expression), node);
+                break;
+            }
+            case Node_OperationBinary: {
+                auto operation = cast<NodeOperationBinary>(node);
+
+                if (isAssignment(operation->operationType) && isa<NodeStatementVariable>(operation->lhs)) {
+                    visit(operation->rhs);
+                    write(cast<NodeStatementVariable>(operation->lhs), node);
+                } else {
+                    visit(operation->lhs);
+                    visit(operation->rhs);
+                }
+                break;
+            }
+            case Node_OperationTernary: {
+                auto operation = cast<NodeOperationTernary>(node);
+
+                visit(operation->condition);
+
+                const auto entry = m_current;
+                const auto end = createBlock();
+
+                for (auto& branch : { operation->lhs, operation->rhs }) {
+                    m_current = createBlock();
+                    link(entry, m_current);
+                    visit(branch);
+                    link(m_current, end);
+                }
+
+                m_current = end;
+                break;
+            }
+            case Node_OperationCast:
+                visit(cast<NodeOperationCast>(node)->expression);
+                break;
+            case Node_StatementArrayCall:
+                visit(cast<NodeStatementArrayCall>(node)->expression);
+                visit(cast<NodeStatementArrayCall>(node)->subExpression);
+                break;
+            case Node_StatementBlock:
+                visitBody(cast<NodeStatementBlock>(node)->body);
+                break;
+            case Node_StatementBreak:
+            case Node_StatementContinue: {
+                const auto& targets = node->getType() == Node_StatementBreak ? m_breakTargets : m_continueTargets;
+
+                if (!targets.empty())
+                    link(m_current, targets.back());
+
+                // What follows the jump is unreachable.
+                m_current = createBlock();
+                break;
+            }
+            case Node_StatementFor: {
+                auto statement = cast<NodeStatementFor>(node);
+
+                // The variable of the loop is never a constant.
+                if (auto declaration = dyn_cast<NodeStatementVariableDeclaration>(statement->variable))
+                    visit(declaration->variables[0]->expression);
+
+                const auto condition = createBlock();
+                const auto body = createBlock();
+                const auto step = createBlock();
+                const auto end = createBlock();
+
+                link(m_current, condition);
+                m_current = condition;
+                visit(statement->incrementalValue);
+                visit(statement->condition);
+                link(m_current, body);
+                link(m_current, end);
+
+                m_continueTargets.push_back(step);
+                m_breakTargets.push_back(end);
+                m_current = body;
+                visitBody(statement->body);
+                link(m_current, step);
+                link(step, condition);
+                m_continueTargets.pop_back();
+                m_breakTargets.pop_back();
+
+                m_current = end;
+                break;
+            }
+            case Node_StatementFunctionCall:
+                visitBody(cast<NodeStatementFunctionCall>(node)->arguments);
+                visit(cast<NodeStatementFunctionCall>(node)->subExpression);
+                break;
+            case Node_StatementIf: {
+                auto statement = cast<NodeStatementIf>(node);
+
+                visit(statement->condition);
+
+                const auto entry = m_current;
+                const auto end = createBlock();
+
+                for (auto body : { &statement->ifBody, &statement->elseBody }) {
+                    if (body->empty())
+                        continue;
+
+                    m_current = createBlock();
+                    link(entry, m_current);
+                    visitBody(*body);
+                    link(m_current, end);
+                }
+
+                if (statement->elseBody.empty())
+                    link(entry, end);
+
+                m_current = end;
+                break;
+            }
+            case Node_StatementReturn:
+                visit(cast<NodeStatementReturn>(node)->expression);
+                m_current = createBlock();
+                break;
+            case Node_StatementSwitch: {
+                auto statement = cast<NodeStatementSwitch>(node);
+
+                visit(statement->expression);
+
+                const auto entry = m_current;
+                const auto end = createBlock();
+
+                // Cases do not fall through.
+                m_breakTargets.push_back(end);
+
+                for (auto& caseNode : statement->cases) {
+                    auto statementCase = cast<NodeStatementCase>(caseNode);
+
+                    m_current = createBlock();
+                    link(entry, m_current);
+                    visit(statementCase->expression);
+                    visitBody(statementCase->body);
+                    link(m_current, end);
+                }
+
+                m_breakTargets.pop_back();
+
+                if (!statement->hasDefault())
+                    link(entry, end);
+
+                m_current = end;
+                break;
+            }
+            case Node_StatementVariable:
+                visit(cast<NodeStatementVariable>(node)->subExpression);
+                break;
+            case Node_StatementVariableDeclaration:
+                for (auto& variable : cast<NodeStatementVariableDeclaration>(node)->variables) {
+                    visit(variable->expression);
+                    declare(variable);
+                }
+                break;
+            case Node_StatementWhile: {
+                auto statement = cast<NodeStatementWhile>(node);
+
+                const auto condition = createBlock();
+                const auto body = createBlock();
+                const auto end = createBlock();
+
+                link(m_current, statement->doOnce ? body : condition);
+                m_current = condition;
+                visit(statement->condition);
+                link(m_current, body);
+                link(m_current, end);
+
+                m_continueTargets.push_back(condition);
+                m_breakTargets.push_back(end);
+                m_current = body;
+                visitBody(statement->body);
+                link(m_current, condition);
+                m_continueTargets.pop_back();
+                m_breakTargets.pop_back();
+
+                m_current = end;
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    void AssignmentAnalysis::solve() {
+        if (m_slotCount == 0)
+            return;
+
+        const size_t words = (m_slotCount + 63) / 64;
+        const auto blockCount = m_blocks.size();
+
+        // Constants each block sets or declares without a value, by the last event on them.
+        std::vector<uint64_t> generated(blockCount * words, 0);
+        std::vector<uint64_t> killed(blockCount * words, 0);
+        // Constants which may be set when entering each block.
+        std::vector<uint64_t> entering(blockCount * words, 0);
+
+        for (size_t block = 0; block < blockCount; block++) {
+            for (auto& event : m_blocks[block].events) {
+                const auto word = block * words + event.slot / 64;
+                const auto bit = uint64_t(1) << (event.slot % 64);
+
+                if (event.isInitialized) {
+                    generated[word] |= bit;
+                    killed[word] &= ~bit;
+                } else {
+                    generated[word] &= ~bit;
+                    killed[word] |= bit;
+                }
+            }
+        }
+
+        std::vector<uint32_t> worklist;
+        std::vector<bool> isQueued(blockCount, true);
+        std::vector<uint64_t> leaving(words);
+
+        for (auto block = blockCount; block-- > 0;)
+            worklist.push_back(static_cast<uint32_t>(block));
+
+        while (!worklist.empty()) {
+            const auto block = worklist.back();
+
+            worklist.pop_back();
+            isQueued[block] = false;
+
+            for (size_t word = 0; word < words; word++) {
+                const auto index = block * words + word;
+
+                leaving[word] = generated[index] | (entering[index] & ~killed[index]);
+            }
+
+            for (auto successor : m_blocks[block].successors) {
+                auto isChanged = false;
+
+                for (size_t word = 0; word < words; word++) {
+                    auto& bits = entering[successor * words + word];
+                    const auto merged = bits | leaving[word];
+
+                    isChanged |= merged != bits;
+                    bits = merged;
+                }
+
+                if (isChanged && !isQueued[successor]) {
+                    isQueued[successor] = true;
+                    worklist.push_back(successor);
+                }
+            }
+        }
+
+        std::vector<uint64_t> state(words);
+
+        for (size_t block = 0; block < blockCount; block++) {
+            std::copy(entering.begin() + block * words, entering.begin() + (block + 1) * words, state.begin());
+
+            for (auto& event : m_blocks[block].events) {
+                auto& word = state[event.slot / 64];
+                const auto bit = uint64_t(1) << (event.slot % 64);
+
+                if (!event.isDeclaration && (word & bit))
+                    m_reassignments.insert(event.node);
+
+                if (event.isInitialized)
+                    word |= bit;
+                else
+                    word &= ~bit;
+            }
+        }
+    }
+
+} /* Namespace Aryiele. */
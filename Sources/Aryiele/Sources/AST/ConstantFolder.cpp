@@ -0,0 +1,560 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <Aryiele/AST/ASTOperands.h>
+#include <Aryiele/AST/ConstantFolder.h>
+#include <Aryiele/AST/Type.h>
+#include <Aryiele/AST/Nodes/NodeLiteralBoolean.h>
+#include <Aryiele/AST/Nodes/NodeLiteralNumberFloating.h>
+#include <Aryiele/AST/Nodes/NodeLiteralNumberInteger.h>
+#include <Aryiele/AST/Nodes/NodeStatementBlock.h>
+#include <Aryiele/AST/Nodes/NodeStatementBreak.h>
+#include <Aryiele/AST/Nodes/NodeStatementContinue.h>
+#include <Aryiele/AST/Nodes/NodeStatementReturn.h>
+
+namespace Aryiele {
+    namespace {
+        // A literal with the type TypeChecker gave it. Integers are kept sign-extended from their width when their
+        // type is signed and zero-extended otherwise, a boolean being zero or one.
+        struct Constant {
+            const Type* type;
+            int64_t integer;
+            double floating;
+        };
+
+        // The bits of the value an integer of the type keeps, extended as the type is.
+        int64_t normalize(uint64_t value, const Type* type) {
+            if (type->kind == Type_Boolean)
+                return value & 1;
+            else if (type->width >= 64)
+                return static_cast<int64_t>(value);
+
+            const auto shift = 64 - type->width;
+
+            if (type->isSigned)
+                return static_cast<int64_t>(value << shift) >> shift;
+
+            return static_cast<int64_t>((value << shift) >> shift);
+        }
+
+        // Rounded as the type stores it, false when the result is not finite.
+        bool roundFloating(double& value, const Type* type) {
+            if (type == &Type::Float)
+                value = static_cast<float>(value);
+
+            return std::isfinite(value);
+        }
+
+        bool getConstant(Node* node, Constant& constant) {
+            const auto type = node->valueType;
+
+            // Not checked, the folder does not guess types.
+            if (!type)
+                return false;
+
+            switch (node->getType()) {
+                case Node_LiteralBoolean:
+                    constant = { type, cast<NodeLiteralBoolean>(node)->value ? 1 : 0, 0.0 };
+                    return type->kind == Type_Boolean;
+                case Node_LiteralNumberInteger:
+                    constant = { type, 0, 0.0 };
+                    constant.integer = normalize(static_cast<uint64_t>(cast<NodeLiteralNumberInteger>(node)->value),
+                        type);
+                    return type->isInteger();
+                case Node_LiteralNumberFloating:
+                    constant = { type, 0, cast<NodeLiteralNumberFloating>(node)->value };
+                    return type->isFloating() && roundFloating(constant.floating, type);
+                default:
+                    return false;
+            }
+        }
+
+        // Null when the value cannot be given to a literal.
+        Node* createLiteral(ASTContext& context, const Constant& constant) {
+            Node* literal = nullptr;
+
+            if (constant.type->kind == Type_Boolean) {
+                literal = context.create<NodeLiteralBoolean>(constant.integer != 0);
+            } else if (constant.type->isInteger()) {
+                literal = context.create<NodeLiteralNumberInteger>(constant.integer,
+                                                                   !constant.type->isSigned && constant.integer < 0);
+            } else if (constant.type->isFloating()) {
+                auto value = constant.floating;
+
+                if (!roundFloating(value, constant.type))
+                    return nullptr;
+
+                literal = context.create<NodeLiteralNumberFloating>(value);
+            } else {
+                return nullptr;
+            }
+
+            literal->valueType = constant.type;
+
+            return literal;
+        }
+
+        // The constant converted to the type as CodeGenerator::visitOperationCast generates it. False when the
+        // result is undefined (a floating value out of the range of the integer) or not finite.
+        bool castConstant(Constant& constant, const Type* type) {
+            const auto from = constant.type;
+
+            if (type->kind == Type_Boolean) {
+                constant.integer = (from->isFloating() ? constant.floating != 0.0 : constant.integer != 0) ? 1 : 0;
+            } else if (from->isFloating() && type->isFloating()) {
+                if (!roundFloating(constant.floating, type))
+                    return false;
+            } else if (from->isFloating()) {
+                if (!type->isInteger())
+                    return false;
+
+                const auto value = std::trunc(constant.floating);
+                const auto limit = std::ldexp(1.0, static_cast<int>(type->width) - (type->isSigned ? 1 : 0));
+
+                if (!(value >= (type->isSigned ? -limit : 0.0) && value < limit))
+                    return false;
+
+                constant.integer = type->isSigned ? static_cast<int64_t>(value) :
+                    static_cast<int64_t>(static_cast<uint64_t>(value));
+            } else if (type->isFloating()) {
+                // Converted once to the type, a 64 bits integer would be rounded twice through a double.
+                if (type == &Type::Float) {
+                    constant.floating = from->isSigned ? static_cast<float>(constant.integer) :
+                        static_cast<float>(static_cast<uint64_t>(constant.integer));
+                } else {
+                    constant.floating = from->isSigned ? static_cast<double>(constant.integer) :
+                        static_cast<double>(static_cast<uint64_t>(constant.integer));
+                }
+            } else if (type->isInteger()) {
+                // The value is already extended as its type is: truncating or extending it again is the cast.
+                constant.integer = normalize(static_cast<uint64_t>(constant.integer), type);
+            } else {
+                return false;
+            }
+
+            constant.type = type;
+
+            return true;
+        }
+
+        // Calls the function on every node of the subtrees, until it returns false.
+        template<typename Function>
+        bool forEachNode(const std::vector<Node*>& roots, Function function) {
+            std::vector<Node*> nodes(roots.begin(), roots.end());
+            std::vector<Node**> operands;
+
+            while (!nodes.empty()) {
+                auto node = nodes.back();
+
+                nodes.pop_back();
+
+                if (!node)
+                    continue;
+
+                if (!function(node))
+                    return false;
+
+                operands.clear();
+                getOperands(node, operands);
+
+                for (auto& operand : operands)
+                    nodes.push_back(*operand);
+            }
+
+            return true;
+        }
+
+        // The statements after a jump would follow it in the same basic block, instead of a block of their own.
+        bool containsJump(const std::vector<Node*>& body) {
+            return !forEachNode(body, [](Node* node) {
+                return !isa<NodeStatementReturn>(node) && !isa<NodeStatementBreak>(node) &&
+                    !isa<NodeStatementContinue>(node);
+            });
+        }
+
+        size_t getNodeCount(Node* node) {
+            size_t count = 0;
+
+            forEachNode({ node }, [&](Node*) {
+                count++;
+
+                return true;
+            });
+
+            return count;
+        }
+    }
+
+    size_t ConstantFolder::fold(ASTContext& context, Node* node) {
+        struct Entry {
+            Node** slot;
+            bool isExpanded;
+        };
+
+        m_context = &context;
+        m_eliminatedCount = 0;
+
+        // Operands are folded before the node using them, without recursion: expressions can be as deep as they
+        // are long.
+        std::vector<Entry> entries { { &node, false } };
+        std::vector<Node**> operands;
+
+        while (!entries.empty()) {
+            auto& entry = entries.back();
+            auto slot = entry.slot;
+
+            if (!entry.isExpanded) {
+                entry.isExpanded = true;
+
+                operands.clear();
+                getOperands(*slot, operands);
+
+                for (auto operand = operands.rbegin(); operand != operands.rend(); ++operand) {
+                    if (**operand)
+                        entries.push_back({ *operand, false });
+                }
+
+                continue;
+            }
+
+            entries.pop_back();
+
+            auto current = *slot;
+            Node* replacement = nullptr;
+
+            switch (current->getType()) {
+                case Node_OperationBinary:
+                    replacement = foldOperationBinary(cast<NodeOperationBinary>(current));
+                    break;
+                case Node_OperationUnary:
+                    replacement = foldOperationUnary(cast<NodeOperationUnary>(current));
+                    break;
+                case Node_OperationTernary:
+                    replacement = foldOperationTernary(cast<NodeOperationTernary>(current));
+                    break;
+                case Node_OperationCast:
+                    replacement = foldOperationCast(cast<NodeOperationCast>(current));
+                    break;
+                case Node_StatementIf:
+                    replacement = foldStatementIf(cast<NodeStatementIf>(current));
+                    break;
+                default:
+                    break;
+            }
+
+            if (!replacement)
+                continue;
+
+            replacement->parent = current->parent;
+
+            if (current->parent) {
+                auto& children = current->parent->children;
+
+                std::replace(children.begin(), children.end(), current, replacement);
+            }
+
+            *slot = replacement;
+        }
+
+        return m_eliminatedCount;
+    }
+
+    Node* ConstantFolder::foldOperationBinary(NodeOperationBinary* node) {
+        const auto operation = node->operationType;
+
+        // The code generator has no logical operators, they are only folded between two booleans.
+        if (operation == ParserToken_OperatorLogicalAnd || operation == ParserToken_OperatorLogicalOr) {
+            auto lhs = dyn_cast<NodeLiteralBoolean>(node->lhs);
+            auto rhs = dyn_cast<NodeLiteralBoolean>(node->rhs);
+
+            if (!lhs || !rhs || !node->valueType)
+                return nullptr;
+
+            auto literal = m_context->create<NodeLiteralBoolean>(operation == ParserToken_OperatorLogicalAnd ?
+                lhs->value && rhs->value : lhs->value || rhs->value);
+
+            literal->valueType = node->valueType;
+            m_eliminatedCount += 2;
+
+            return literal;
+        }
+
+        Constant lhs {};
+        Constant rhs {};
+
+        // TypeChecker cast both operands to the type of the operation (of a comparison, to the one they share).
+        if (!getConstant(node->lhs, lhs) || !getConstant(node->rhs, rhs) || lhs.type != rhs.type)
+            return nullptr;
+
+        const auto type = lhs.type;
+        auto result = lhs;
+        auto isComparison = false;
+        auto comparison = false;
+
+        if (type->kind == Type_Boolean) {
+            isComparison = true;
+
+            switch (operation) {
+                case ParserToken_OperatorComparisonEqual:
+                    comparison = lhs.integer == rhs.integer;
+                    break;
+                case ParserToken_OperatorComparisonNotEqual:
+                    comparison = lhs.integer != rhs.integer;
+                    break;
+                default:
+                    return nullptr;
+            }
+        } else if (type->isFloating()) {
+            const auto a = lhs.floating;
+            const auto b = rhs.floating;
+
+            switch (operation) {
+                case ParserToken_OperatorArithmeticPlus:
+                    result.floating = a + b;
+                    break;
+                case ParserToken_OperatorArithmeticMinus:
+                    result.floating = a - b;
+                    break;
+                case ParserToken_OperatorArithmeticMultiply:
+                    result.floating = a * b;
+                    break;
+                case ParserToken_OperatorArithmeticDivide:
+                    result.floating = a / b;
+                    break;
+                case ParserToken_OperatorComparisonLessThan:
+                    isComparison = true;
+                    comparison = a < b;
+                    break;
+                case ParserToken_OperatorComparisonLessThanOrEqual:
+                    isComparison = true;
+                    comparison = a <= b;
+                    break;
+                case ParserToken_OperatorComparisonGreaterThan:
+                    isComparison = true;
+                    comparison = a > b;
+                    break;
+                case ParserToken_OperatorComparisonGreaterThanOrEqual:
+                    isComparison = true;
+                    comparison = a >= b;
+                    break;
+                case ParserToken_OperatorComparisonEqual:
+                    isComparison = true;
+                    comparison = a == b;
+                    break;
+                case ParserToken_OperatorComparisonNotEqual:
+                    isComparison = true;
+                    comparison = a != b;
+                    break;
+                default:
+                    return nullptr;
+            }
+        } else if (type->isInteger()) {
+            const auto a = static_cast<uint64_t>(lhs.integer);
+            const auto b = static_cast<uint64_t>(rhs.integer);
+            const auto minimum = normalize(uint64_t(1) << (type->width - 1), type);
+            // sdiv and srem are undefined by zero, and for the smallest value by -1, udiv and urem by zero.
+            const auto isDivisionDefined = b != 0 && !(type->isSigned && rhs.integer == -1 && lhs.integer == minimum);
+
+            switch (operation) {
+                case ParserToken_OperatorArithmeticPlus:
+                    result.integer = normalize(a + b, type);
+                    break;
+                case ParserToken_OperatorArithmeticMinus:
+                    result.integer = normalize(a - b, type);
+                    break;
+                case ParserToken_OperatorArithmeticMultiply:
+                    result.integer = normalize(a * b, type);
+                    break;
+                case ParserToken_OperatorArithmeticDivide:
+                    if (!isDivisionDefined)
+                        return nullptr;
+
+                    result.integer = normalize(type->isSigned ? static_cast<uint64_t>(lhs.integer / rhs.integer) :
+                        a / b, type);
+                    break;
+                case ParserToken_OperatorArithmeticRemainder:
+                    if (!isDivisionDefined)
+                        return nullptr;
+
+                    result.integer = normalize(type->isSigned ? static_cast<uint64_t>(lhs.integer % rhs.integer) :
+                        a % b, type);
+                    break;
+                case ParserToken_OperatorComparisonLessThan:
+                    isComparison = true;
+                    comparison = type->isSigned ? lhs.integer < rhs.integer : a < b;
+                    break;
+                case ParserToken_OperatorComparisonLessThanOrEqual:
+                    isComparison = true;
+                    comparison = type->isSigned ? lhs.integer <= rhs.integer : a <= b;
+                    break;
+                case ParserToken_OperatorComparisonGreaterThan:
+                    isComparison = true;
+                    comparison = type->isSigned ? lhs.integer > rhs.integer : a > b;
+                    break;
+                case ParserToken_OperatorComparisonGreaterThanOrEqual:
+                    isComparison = true;
+                    comparison = type->isSigned ? lhs.integer >= rhs.integer : a >= b;
+                    break;
+                case ParserToken_OperatorComparisonEqual:
+                    isComparison = true;
+                    comparison = a == b;
+                    break;
+                case ParserToken_OperatorComparisonNotEqual:
+                    isComparison = true;
+                    comparison = a != b;
+                    break;
+                default:
+                    return nullptr;
+            }
+        } else {
+            return nullptr;
+        }
+
+        if (isComparison)
+            result = { &Type::Boolean, comparison ? 1 : 0, 0.0 };
+
+        if (result.type != node->valueType)
+            return nullptr;
+
+        auto literal = createLiteral(*m_context, result);
+
+        if (literal)
+            m_eliminatedCount += 2;
+
+        return literal;
+    }
+
+    Node* ConstantFolder::foldOperationUnary(NodeOperationUnary* node) {
+        Constant constant {};
+
+        if (!getConstant(node->expression, constant) || constant.type != node->valueType)
+            return nullptr;
+
+        switch (node->operationType) {
+            case ParserToken_OperatorUnaryArithmeticPlus:
+                if (!constant.type->isArithmetic())
+                    return nullptr;
+
+                m_eliminatedCount++;
+
+                return node->expression;
+            case ParserToken_OperatorUnaryArithmeticMinus:
+                if (constant.type->isFloating()) {
+                    constant.floating = -constant.floating;
+                } else if (constant.type->isSigned && constant.type->isInteger() &&
+                           constant.integer != normalize(uint64_t(1) << (constant.type->width - 1), constant.type)) {
+                    constant.integer = -constant.integer;
+                } else {
+                    // The negation of the smallest value, or of an unsigned one, has no value of the type.
+                    return nullptr;
+                }
+                break;
+            case ParserToken_OperatorUnaryLogicalNot:
+                if (constant.type->kind != Type_Boolean)
+                    return nullptr;
+
+                constant.integer = !constant.integer;
+                break;
+            default:
+                return nullptr;
+        }
+
+        auto literal = createLiteral(*m_context, constant);
+
+        if (literal)
+            m_eliminatedCount++;
+
+        return literal;
+    }
+
+    Node* ConstantFolder::foldOperationTernary(NodeOperationTernary* node) {
+        auto condition = dyn_cast<NodeLiteralBoolean>(node->condition);
+
+        if (!condition)
+            return nullptr;
+
+        auto branch = condition->value ? node->lhs : node->rhs;
+
+        // Both branches were checked and cast to the type of the ternary, the dropped one needs no value.
+        if (!branch || !node->valueType || branch->valueType != node->valueType || containsJump({ branch }))
+            return nullptr;
+
+        // The ternary, its condition and the dropped branch.
+        m_eliminatedCount += 2 + getNodeCount(condition->value ? node->rhs : node->lhs);
+
+        return branch;
+    }
+
+    Node* ConstantFolder::foldOperationCast(NodeOperationCast* node) {
+        Constant constant {};
+
+        if (!getConstant(node->expression, constant) || !node->valueType || !castConstant(constant, node->valueType))
+            return nullptr;
+
+        auto literal = createLiteral(*m_context, constant);
+
+        if (literal)
+            m_eliminatedCount++;
+
+        return literal;
+    }
+
+    Node* ConstantFolder::foldStatementIf(NodeStatementIf* node) {
+        auto condition = dyn_cast<NodeLiteralBoolean>(node->condition);
+
+        if (!condition)
+            return nullptr;
+
+        const auto& body = condition->value ? node->ifBody : node->elseBody;
+
+        if (containsJump(body))
+            return nullptr;
+
+        forEachNode(condition->value ? node->elseBody : node->ifBody, [&](Node*) {
+            m_eliminatedCount++;
+
+            return true;
+        });
+
+        // The if is kept as a block, for the scope of its variables: only the condition goes.
+        m_eliminatedCount++;
+
+        auto block = m_context->create<NodeStatementBlock>(body);
+
+        for (auto& statement : block->body) {
+            if (statement)
+                statement->parent = block;
+        }
+
+        return block;
+    }
+
+} /* Namespace Aryiele. */
@@ -0,0 +1,237 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#include <Aryiele/AST/FlatAST.h>
+#include <Aryiele/AST/Variable.h>
+#include <Aryiele/AST/Nodes/NodeLiteralArray.h>
+#include <Aryiele/AST/Nodes/NodeLiteralBoolean.h>
+#include <Aryiele/AST/Nodes/NodeLiteralCharacter.h>
+#include <Aryiele/AST/Nodes/NodeLiteralNumberFloating.h>
+#include <Aryiele/AST/Nodes/NodeLiteralNumberInteger.h>
+#include <Aryiele/AST/Nodes/NodeLiteralString.h>
+#include <Aryiele/AST/Nodes/NodeOperationBinary.h>
+#include <Aryiele/AST/Nodes/NodeOperationUnary.h>
+#include <Aryiele/AST/Nodes/NodeStatementFunctionCall.h>
+#include <Aryiele/AST/Nodes/NodeStatementIf.h>
+#include <Aryiele/AST/Nodes/NodeStatementVariable.h>
+#include <Aryiele/AST/Nodes/NodeStatementVariableDeclaration.h>
+#include <Aryiele/AST/Nodes/NodeStatementWhile.h>
+#include <Aryiele/AST/Nodes/NodeTopFile.h>
+#include <Aryiele/AST/Nodes/NodeTopFunction.h>
+#include <Aryiele/AST/Nodes/NodeTopNamespace.h>
+
+namespace Aryiele {
+    void FlatAST::build(Node* root) {
+        clear();
+        append(root, FlatNode_None);
+    }
+
+    void FlatAST::clear() {
+        m_kinds.clear();
+        m_parents.clear();
+        m_firstChildren.clear();
+        m_nextSiblings.clear();
+        m_ends.clear();
+        m_payloads.clear();
+        m_integers.clear();
+        m_decimals.clear();
+        m_strings.clear();
+        m_operations.clear();
+        m_functions.clear();
+        m_arguments.clear();
+        m_variables.clear();
+    }
+
+    size_t FlatAST::getSize() const {
+        return m_kinds.size();
+    }
+
+    NodeEnum FlatAST::getKind(FlatNode node) const {
+        return static_cast<NodeEnum>(m_kinds[node]);
+    }
+
+    const std::vector<uint8_t>& FlatAST::getKinds() const {
+        return m_kinds;
+    }
+
+    FlatNode FlatAST::getParent(FlatNode node) const {
+        return m_parents[node];
+    }
+
+    FlatNode FlatAST::getFirstChild(FlatNode node) const {
+        return m_firstChildren[node];
+    }
+
+    FlatNode FlatAST::getNextSibling(FlatNode node) const {
+        return m_nextSiblings[node];
+    }
+
+    FlatNode FlatAST::getEnd(FlatNode node) const {
+        return m_ends[node];
+    }
+
+    bool FlatAST::contains(FlatNode node, FlatNode element) const {
+        return element > node && element < m_ends[node];
+    }
+
+    uint32_t FlatAST::getPayload(FlatNode node) const {
+        return m_payloads[node];
+    }
+
+    int64_t FlatAST::getInteger(FlatNode node) const {
+        return m_integers[m_payloads[node]];
+    }
+
+    double FlatAST::getDecimal(FlatNode node) const {
+        return m_decimals[m_payloads[node]];
+    }
+
+    const std::string& FlatAST::getString(FlatNode node) const {
+        return m_strings[m_payloads[node]];
+    }
+
+    const FlatOperation& FlatAST::getOperation(FlatNode node) const {
+        return m_operations[m_payloads[node]];
+    }
+
+    const FlatFunction& FlatAST::getFunction(FlatNode node) const {
+        return m_functions[m_payloads[node]];
+    }
+
+    const Argument& FlatAST::getArgument(const FlatFunction& function, uint32_t index) const {
+        return m_arguments[function.firstArgument + index];
+    }
+
+    const FlatVariable& FlatAST::getVariable(FlatNode node, uint32_t index) const {
+        return m_variables[m_payloads[node] + index];
+    }
+
+    FlatNode FlatAST::append(Node* node, FlatNode parent) {
+        const auto index = static_cast<FlatNode>(m_kinds.size());
+
+        m_kinds.push_back(static_cast<uint8_t>(node ? node->getType() : Node_Error));
+        m_parents.push_back(parent);
+        m_firstChildren.push_back(FlatNode_None);
+        m_nextSiblings.push_back(FlatNode_None);
+        m_ends.push_back(index + 1);
+        m_payloads.push_back(0);
+
+        if (!node)
+            return index;
+
+        m_payloads[index] = appendPayload(node);
+
+        auto previous = FlatNode_None;
+        auto appendChild = [&](Node* child) {
+            const auto childIndex = append(child, index);
+
+            if (previous == FlatNode_None)
+                m_firstChildren[index] = childIndex;
+            else
+                m_nextSiblings[previous] = childIndex;
+
+            previous = childIndex;
+        };
+
+        // These two do not list their operands in Node::children.
+        if (node->getType() == Node_StatementVariableDeclaration) {
+            for (auto& variable : cast<NodeStatementVariableDeclaration>(node)->variables)
+                appendChild(variable->expression);
+        } else if (node->getType() == Node_LiteralArray) {
+            for (auto& element : cast<NodeLiteralArray>(node)->elements)
+                appendChild(element);
+        } else {
+            for (auto& child : node->children)
+                appendChild(child);
+        }
+
+        m_ends[index] = static_cast<FlatNode>(m_kinds.size());
+
+        return index;
+    }
+
+    uint32_t FlatAST::appendPayload(Node* node) {
+        switch (node->getType()) {
+            case Node_LiteralBoolean:
+                return cast<NodeLiteralBoolean>(node)->value;
+            case Node_LiteralCharacter:
+                m_strings.emplace_back(cast<NodeLiteralCharacter>(node)->value);
+                return static_cast<uint32_t>(m_strings.size() - 1);
+            case Node_LiteralString:
+                m_strings.emplace_back(cast<NodeLiteralString>(node)->value);
+                return static_cast<uint32_t>(m_strings.size() - 1);
+            case Node_TopFile:
+                m_strings.emplace_back(cast<NodeTopFile>(node)->path);
+                return static_cast<uint32_t>(m_strings.size() - 1);
+            case Node_LiteralNumberInteger:
+                m_integers.push_back(cast<NodeLiteralNumberInteger>(node)->value);
+                return static_cast<uint32_t>(m_integers.size() - 1);
+            case Node_LiteralNumberFloating:
+                m_decimals.push_back(cast<NodeLiteralNumberFloating>(node)->value);
+                return static_cast<uint32_t>(m_decimals.size() - 1);
+            case Node_OperationUnary: {
+                auto operation = cast<NodeOperationUnary>(node);
+
+                m_operations.push_back({ operation->operationType, operation->left });
+                return static_cast<uint32_t>(m_operations.size() - 1);
+            }
+            case Node_OperationBinary:
+                m_operations.push_back({ cast<NodeOperationBinary>(node)->operationType, false });
+                return static_cast<uint32_t>(m_operations.size() - 1);
+            case Node_StatementFunctionCall:
+                return cast<NodeStatementFunctionCall>(node)->identifier;
+            case Node_StatementVariable:
+                return cast<NodeStatementVariable>(node)->identifier;
+            case Node_TopNamespace:
+                return cast<NodeTopNamespace>(node)->identifier;
+            case Node_StatementIf:
+                return static_cast<uint32_t>(cast<NodeStatementIf>(node)->ifBody.size());
+            case Node_StatementWhile:
+                return cast<NodeStatementWhile>(node)->doOnce;
+            case Node_StatementVariableDeclaration: {
+                const auto first = static_cast<uint32_t>(m_variables.size());
+
+                for (auto& variable : cast<NodeStatementVariableDeclaration>(node)->variables)
+                    m_variables.push_back({ variable->identifier, variable->type, variable->isConstant });
+
+                return first;
+            }
+            case Node_TopFunction: {
+                auto function = cast<NodeTopFunction>(node);
+
+                m_functions.push_back({ function->identifier, function->type, static_cast<uint32_t>(m_arguments.size()),
+                    static_cast<uint32_t>(function->arguments.size()) });
+                m_arguments.insert(m_arguments.end(), function->arguments.begin(), function->arguments.end());
+
+                return static_cast<uint32_t>(m_functions.size() - 1);
+            }
+            default:
+                return 0;
+        }
+    }
+
+} /* Namespace Aryiele. */
@@ -26,13 +26,18 @@
 //==================================================================================//
 
 #include <Aryiele/AST/Nodes/Node.h>
+#include <Aryiele/AST/ASTDumper.h>
 
 namespace Aryiele {
-    Node::Node(std::vector<std::shared_ptr<Node>> children, std::shared_ptr<Node> parent) :
-        children(children), parent(parent) {
+    Node::Node(NodeEnum kind, std::vector<Node*> children, Node* parent) :
+        kind(kind), children(children), parent(parent) {
         
     }
     
+    void Node::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
+        ASTDumper().visit(this, parentNode);
+    }
+    
     std::string Node::getTypeName() {
         return getTypeName(getType());
     }
@@ -71,6 +76,8 @@ namespace Aryiele {
                 return "OperationBinary";
             case Node_OperationTernary:
                 return "OperationTernary";
+            case Node_OperationCast:
+                return "OperationCast";
                 
             case Node_StatementArrayCall:
                 return "StatementArrayCall";
@@ -112,7 +119,7 @@ namespace Aryiele {
         auto parent = node->parent;
         
         for (int i = 0; i < parent->children.size(); i++) {
-            if (parent->children[i].get() == node) {
+            if (parent->children[i] == node) {
                 return i;
             }
         }
@@ -120,17 +127,13 @@ namespace Aryiele {
         return -1;
     }
     
-    int Node::getPositionInParent(std::shared_ptr<Node> node) {
-        return getPositionInParent(node.get());
-    }
-    
     bool Node::contains(Node *element) {
         return contains(element, this);
     }
     
     bool Node::contains(Node *element, Node *parent) {
         for (auto& child : parent->children) {
-            if  (child && (child.get() == element || (!child->children.empty() && contains(element, child.get())))) {
+            if  (child && (child == element || (!child->children.empty() && contains(element, child)))) {
                 return true;
             }
         }
@@ -29,31 +29,8 @@
 
 namespace Aryiele {
     
-    NodeLiteralArray::NodeLiteralArray(std::vector<std::shared_ptr<Node>> elements) :
-        elements(elements) {
+    NodeLiteralArray::NodeLiteralArray(std::vector<Node*> elements) :
+        Node(Kind), elements(elements) {
     
     }
-    
-    void NodeLiteralArray::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "Array");
-        auto elementsNode = std::make_shared<ParserInformation>(node, "Elements:");
-        
-        for (int i = 0; i < elements.size(); i++) {
-            auto elementNode = std::make_shared<ParserInformation>(elementsNode, std::to_string(i) + ": ");
-            auto elementExpressionNode = std::make_shared<ParserInformation>(elementNode, "Expression:");
-    
-            elements.at(i)->dumpAST(elementExpressionNode);
-    
-            elementNode->children.emplace_back(elementExpressionNode);
-    
-            elementsNode->children.emplace_back(elementNode);
-        }
-    
-        node->children.emplace_back(elementsNode);
-        parentNode->children.emplace_back(node);
-    }
-    
-    NodeEnum NodeLiteralArray::getType() {
-        return Node_LiteralArray;
-    }
 } /* Namespace Aryiele. */
\ No newline at end of file
@@ -29,20 +29,8 @@
 
 namespace Aryiele {
     NodeLiteralBoolean::NodeLiteralBoolean(bool value) :
-        value(value) {
+        Node(Kind), value(value) {
         
     }
     
-    void NodeLiteralBoolean::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "Boolean");
-        auto bodyNode = std::make_shared<ParserInformation>(node, "Value: " + std::to_string(value));
-        
-        node->children.emplace_back(bodyNode);
-        parentNode->children.emplace_back(node);
-    }
-    
-    NodeEnum NodeLiteralBoolean::getType() {
-        return Node_LiteralBoolean;
-    }
-    
 } /* Namespace Aryiele. */
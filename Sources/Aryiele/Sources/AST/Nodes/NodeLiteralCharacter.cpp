@@ -29,20 +29,8 @@
 
 namespace Aryiele {
     NodeLiteralCharacter::NodeLiteralCharacter(const std::string& value) :
-        value(value) {
+        Node(Kind), value(value) {
         
     }
     
-    void NodeLiteralCharacter::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "Character");
-        auto bodyNode = std::make_shared<ParserInformation>(node, "Value: " + value);
-        
-        node->children.emplace_back(bodyNode);
-        parentNode->children.emplace_back(node);
-    }
-    
-    NodeEnum NodeLiteralCharacter::getType() {
-        return Node_LiteralCharacter;
-    }
-    
 } /* Namespace Aryiele. */
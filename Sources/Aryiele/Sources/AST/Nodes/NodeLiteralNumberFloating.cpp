@@ -29,20 +29,8 @@
 
 namespace Aryiele {
     NodeLiteralNumberFloating::NodeLiteralNumberFloating(double value) :
-        value(value) {
+        Node(Kind), value(value) {
 
     }
 
-    void NodeLiteralNumberFloating::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "Double");
-        auto bodyNode = std::make_shared<ParserInformation>(node, "Value: " + std::to_string(value));
-
-        node->children.emplace_back(bodyNode);
-        parentNode->children.emplace_back(node);
-    }
-    
-    NodeEnum NodeLiteralNumberFloating::getType() {
-        return Node_LiteralNumberFloating;
-    }
-
 } /* Namespace Aryiele. */
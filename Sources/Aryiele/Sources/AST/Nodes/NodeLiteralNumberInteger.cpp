@@ -28,21 +28,9 @@
 #include <Aryiele/AST/Nodes/NodeLiteralNumberInteger.h>
 
 namespace Aryiele {
-    NodeLiteralNumberInteger::NodeLiteralNumberInteger(long value) :
-            value(value) {
+    NodeLiteralNumberInteger::NodeLiteralNumberInteger(int64_t value, bool isUnsigned) :
+            Node(Kind), value(value), isUnsigned(isUnsigned) {
 
     }
 
-    void NodeLiteralNumberInteger::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "Integer");
-        auto bodyNode = std::make_shared<ParserInformation>(node, "Value: " + std::to_string(value));
-
-        node->children.emplace_back(bodyNode);
-        parentNode->children.emplace_back(node);
-    }
-    
-    NodeEnum NodeLiteralNumberInteger::getType() {
-        return Node_LiteralNumberInteger;
-    }
-
 } /* Namespace Aryiele. */
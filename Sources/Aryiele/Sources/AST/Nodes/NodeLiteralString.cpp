@@ -29,20 +29,8 @@
 
 namespace Aryiele {
     NodeLiteralString::NodeLiteralString(std::string value) :
-        value(value) {
+        Node(Kind), value(value) {
         
     }
     
-    void NodeLiteralString::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "String");
-        auto bodyNode = std::make_shared<ParserInformation>(node, "Value: " + value);
-        
-        node->children.emplace_back(bodyNode);
-        parentNode->children.emplace_back(node);
-    }
-    
-    NodeEnum NodeLiteralString::getType() {
-        return Node_LiteralString;
-    }
-    
 } /* Namespace Aryiele. */
@@ -29,30 +29,9 @@
 
 namespace Aryiele {
     NodeOperationBinary::NodeOperationBinary(ParserTokenEnum operationType,
-        std::shared_ptr<Node> lhs, std::shared_ptr<Node> rhs) :
-        operationType(operationType), lhs(lhs), rhs(rhs) {
-        children = std::vector<std::shared_ptr<Node>> {lhs, rhs};
-    }
-
-    void NodeOperationBinary::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "Binary Operation");
-        auto operationTypeNode = std::make_shared<ParserInformation>(
-            node, "Type: " + ParserToken::getTypeName(operationType));
-        auto lhsNode = std::make_shared<ParserInformation>(node, "LHS:");
-        auto rhsNode = std::make_shared<ParserInformation>(node, "RHS:");
-    
-        lhs->dumpAST(lhsNode);
-        rhs->dumpAST(rhsNode);
-
-        node->children.emplace_back(operationTypeNode);
-        node->children.emplace_back(lhsNode);
-        node->children.emplace_back(rhsNode);
-
-        parentNode->children.emplace_back(node);
-    }
-    
-    NodeEnum NodeOperationBinary::getType() {
-        return Node_OperationBinary;
+        Node* lhs, Node* rhs) :
+        Node(Kind), operationType(operationType), lhs(lhs), rhs(rhs) {
+        children = std::vector<Node*> {lhs, rhs};
     }
 
 } /* Namespace Aryiele. */
@@ -25,12 +25,12 @@
 //                                                                                  //
 //==================================================================================//
 
-#include <Aryiele/CodeGenerator/BlockVariable.h>
+#include <Aryiele/AST/Nodes/NodeOperationCast.h>
 
 namespace Aryiele {
-    BlockVariable::BlockVariable(llvm::AllocaInst *instance, Node* initializationNode, bool isConstant) :
-        instance(instance), initializationNode(initializationNode), isConstant(isConstant) {
-        
+    NodeOperationCast::NodeOperationCast(Node* expression, const Type* type) :
+        Node(Kind), expression(expression) {
+        children = std::vector<Node*> {expression};
+        valueType = type;
     }
-    
-} /* Namespace Aryiele. */
\ No newline at end of file
+} /* Namespace Aryiele. */
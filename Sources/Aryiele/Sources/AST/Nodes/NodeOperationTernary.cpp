@@ -28,31 +28,10 @@
 #include <Aryiele/AST/Nodes/NodeOperationTernary.h>
 
 namespace Aryiele {
-    NodeOperationTernary::NodeOperationTernary(std::shared_ptr<Node> condition,
-        std::shared_ptr<Node> lhs, std::shared_ptr<Node> rhs) :
-        condition(condition), lhs(lhs), rhs(rhs) {
-        children = std::vector<std::shared_ptr<Node>> {condition, lhs, rhs};
-    }
-    
-    void NodeOperationTernary::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "Ternary Operation");
-        auto conditionNode = std::make_shared<ParserInformation>(node, "Condition:");
-        auto lhsNode = std::make_shared<ParserInformation>(node, "LHS:");
-        auto rhsNode = std::make_shared<ParserInformation>(node, "RHS:");
-        
-        condition->dumpAST(conditionNode);
-        lhs->dumpAST(lhsNode);
-        rhs->dumpAST(rhsNode);
-        
-        node->children.emplace_back(conditionNode);
-        node->children.emplace_back(lhsNode);
-        node->children.emplace_back(rhsNode);
-        
-        parentNode->children.emplace_back(node);
-    }
-    
-    NodeEnum NodeOperationTernary::getType() {
-        return Node_OperationTernary;
+    NodeOperationTernary::NodeOperationTernary(Node* condition,
+        Node* lhs, Node* rhs) :
+        Node(Kind), condition(condition), lhs(lhs), rhs(rhs) {
+        children = std::vector<Node*> {condition, lhs, rhs};
     }
     
 } /* Namespace Aryiele. */
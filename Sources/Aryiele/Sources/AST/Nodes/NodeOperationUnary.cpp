@@ -28,28 +28,8 @@
 #include <Aryiele/AST/Nodes/NodeOperationUnary.h>
 
 namespace Aryiele {
-    NodeOperationUnary::NodeOperationUnary(ParserTokenEnum operationType, std::shared_ptr<Node> expression, bool left) :
-        operationType(operationType), expression(expression), left(left) {
-        children = std::vector<std::shared_ptr<Node>> {expression};
-    }
-    
-    void NodeOperationUnary::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "Unary Operation");
-        auto sideNode = std::make_shared<ParserInformation>(node, std::string("Side: ") + std::string(left ? "Left" : "Right"));
-        auto operationTypeNode = std::make_shared<ParserInformation>(
-            node, "Type: " + ParserToken::getTypeName(operationType));
-        auto expressionNode = std::make_shared<ParserInformation>(node, "Operand:");
-    
-        expression->dumpAST(expressionNode);
-    
-        node->children.emplace_back(sideNode);
-        node->children.emplace_back(operationTypeNode);
-        node->children.emplace_back(expressionNode);
-    
-        parentNode->children.emplace_back(node);
-    }
-    
-    NodeEnum NodeOperationUnary::getType() {
-        return Node_OperationUnary;
+    NodeOperationUnary::NodeOperationUnary(ParserTokenEnum operationType, Node* expression, bool left) :
+        Node(Kind), operationType(operationType), expression(expression), left(left) {
+        children = std::vector<Node*> {expression};
     }
 } /* Namespace Aryiele. */
\ No newline at end of file
@@ -26,26 +26,33 @@
 //==================================================================================//
 
 #include <Aryiele/AST/Nodes/NodeRoot.h>
+#include <Aryiele/AST/Nodes/NodeTopFile.h>
+#include <Aryiele/AST/Nodes/NodeTopNamespace.h>
 
 namespace Aryiele {
-    
-    NodeRoot::NodeRoot(std::vector<std::shared_ptr<Node>> body) :
-        body(body) {
-        children = std::vector<std::shared_ptr<Node>>();
-        children.insert(children.end(), body.begin(), body.end());
-    }
-    
-    void NodeRoot::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "Root");
-    
-        for (auto& childNode : body) {
-            childNode->dumpAST(node);
+    namespace {
+        void appendDeclarations(const std::vector<Node*>& body, std::vector<Node*>& declarations) {
+            for (auto& node : body) {
+                if (auto nodeNamespace = dyn_cast<NodeTopNamespace>(node))
+                    appendDeclarations(nodeNamespace->body, declarations);
+                else if (node)
+                    declarations.emplace_back(node);
+            }
         }
-    
-        parentNode->children.emplace_back(node);
     }
     
-    NodeEnum NodeRoot::getType() {
-        return Node_Root;
+    NodeRoot::NodeRoot(std::vector<Node*> body) :
+        Node(Kind), body(body) {
+        children = std::vector<Node*>();
+        children.insert(children.end(), body.begin(), body.end());
+    }
+
+    std::vector<Node*> getDeclarations(NodeRoot* nodeRoot) {
+        std::vector<Node*> declarations;
+
+        for (auto& file : nodeRoot->body)
+            appendDeclarations(cast<NodeTopFile>(file)->body, declarations);
+
+        return declarations;
     }
 } /* Namespace Aryiele. */
\ No newline at end of file
@@ -29,29 +29,8 @@
 
 namespace Aryiele {
     
-    NodeStatementArrayCall::NodeStatementArrayCall(std::shared_ptr<Node> expression, std::shared_ptr<Node> subExpression) :
-        expression(expression), subExpression(subExpression) {
-        children = std::vector<std::shared_ptr<Node>> {expression, subExpression};
-    }
-    
-    void NodeStatementArrayCall::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "Array Call");
-        auto elementsNode = std::make_shared<ParserInformation>(node, "Element:");
-        auto subExpressionNode = std::make_shared<ParserInformation>(node, "Subexpression:");
-    
-        expression->dumpAST(elementsNode);
-        
-        node->children.emplace_back(elementsNode);
-    
-        if (subExpression) {
-            subExpression->dumpAST(subExpressionNode);
-            node->children.emplace_back(subExpressionNode);
-        }
-        
-        parentNode->children.emplace_back(node);
-    }
-    
-    NodeEnum NodeStatementArrayCall::getType() {
-        return Node_StatementArrayCall;
+    NodeStatementArrayCall::NodeStatementArrayCall(Node* expression, Node* subExpression) :
+        Node(Kind), expression(expression), subExpression(subExpression) {
+        children = std::vector<Node*> {expression, subExpression};
     }
 } /* Namespace Aryiele. */
\ No newline at end of file
@@ -28,25 +28,10 @@
 #include <Aryiele/AST/Nodes/NodeStatementBlock.h>
 
 namespace Aryiele {
-    NodeStatementBlock::NodeStatementBlock(std::vector<std::shared_ptr<Node>> body) :
-        body(body) {
-        children = std::vector<std::shared_ptr<Node>>();
+    NodeStatementBlock::NodeStatementBlock(std::vector<Node*> body) :
+        Node(Kind), body(body) {
+        children = std::vector<Node*>();
         children.insert(children.end(), body.begin(), body.end());
     }
 
-    void NodeStatementBlock::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "Block");
-        auto bodyNode = std::make_shared<ParserInformation>(node, "Body:");
-
-        for (auto& statement : body)
-            statement->dumpAST(bodyNode);
-
-        node->children.emplace_back(bodyNode);
-        parentNode->children.emplace_back(node);
-    }
-
-    NodeEnum NodeStatementBlock::getType() {
-        return Node_StatementBlock;
-    }
-
 } /* Namespace Aryiele. */
\ No newline at end of file
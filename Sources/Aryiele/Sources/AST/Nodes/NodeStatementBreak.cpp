@@ -28,14 +28,9 @@
 #include <Aryiele/AST/Nodes/NodeStatementBreak.h>
 
 namespace Aryiele {
-    void NodeStatementBreak::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "Break");
+    NodeStatementBreak::NodeStatementBreak() :
+        Node(Kind) {
         
-        parentNode->children.emplace_back(node);
-    }
-    
-    NodeEnum NodeStatementBreak::getType() {
-        return Node_StatementBreak;
     }
     
 } /* Namespace Aryiele. */
@@ -29,35 +29,9 @@
 
 namespace Aryiele {
     
-    NodeStatementCase::NodeStatementCase(std::shared_ptr<Node> expression, std::vector<std::shared_ptr<Node>> body) :
-        expression(expression), body(body) {
-        children = std::vector<std::shared_ptr<Node>> {expression};
+    NodeStatementCase::NodeStatementCase(Node* expression, std::vector<Node*> body) :
+        Node(Kind), expression(expression), body(body) {
+        children = std::vector<Node*> {expression};
         children.insert(children.end(), body.begin(), body.end());
     }
-    
-    void NodeStatementCase::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, expression ? "Case" : "Default");
-        std::shared_ptr<ParserInformation> expressionNode = nullptr;
-        auto bodyNode = std::make_shared<ParserInformation>(node, "Body:");
-        
-        if (expression) {
-            expressionNode = std::make_shared<ParserInformation>(node, "Expression:");
-    
-            expression->dumpAST(expressionNode);
-    
-            node->children.emplace_back(expressionNode);
-        }
-    
-        for (auto& j : body) {
-            j->dumpAST(bodyNode);
-        }
-    
-        node->children.emplace_back(bodyNode);
-    
-        parentNode->children.emplace_back(node);
-    }
-    
-    NodeEnum NodeStatementCase::getType() {
-        return Node_StatementCase;
-    }
 } /* Namespace Aryiele. */
\ No newline at end of file
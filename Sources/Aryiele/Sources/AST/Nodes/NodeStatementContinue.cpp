@@ -28,14 +28,9 @@
 #include <Aryiele/AST/Nodes/NodeStatementContinue.h>
 
 namespace Aryiele {
-    void NodeStatementContinue::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "Continue");
-    
-        parentNode->children.emplace_back(node);
-    }
-    
-    NodeEnum NodeStatementContinue::getType() {
-        return Node_StatementContinue;
+    NodeStatementContinue::NodeStatementContinue() :
+        Node(Kind) {
+        
     }
     
 } /* Namespace Aryiele. */
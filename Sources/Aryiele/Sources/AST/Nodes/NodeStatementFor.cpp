@@ -28,48 +28,10 @@
 #include <Aryiele/AST/Nodes/NodeStatementFor.h>
 
 namespace Aryiele {
-    NodeStatementFor::NodeStatementFor(std::shared_ptr<Node> variable, std::shared_ptr<Node> condition,
-        std::shared_ptr<Node> incrementalValue, std::vector<std::shared_ptr<Node>> body) :
-        variable(variable), condition(condition), incrementalValue(incrementalValue), body(body) {
-        children = std::vector<std::shared_ptr<Node>> {variable, condition, incrementalValue};
+    NodeStatementFor::NodeStatementFor(Node* variable, Node* condition,
+        Node* incrementalValue, std::vector<Node*> body) :
+        Node(Kind), variable(variable), condition(condition), incrementalValue(incrementalValue), body(body) {
+        children = std::vector<Node*> {variable, condition, incrementalValue};
         children.insert(children.end(), body.begin(), body.end());
     }
-    
-    void NodeStatementFor::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "For");
-        auto variableNode = std::make_shared<ParserInformation>(node, "Variable:");
-        auto conditionNode = std::make_shared<ParserInformation>(node, "Condition:");
-        auto incrementalValueNode = std::make_shared<ParserInformation>(node, "Incremental Value:");
-        auto bodyNode = std::make_shared<ParserInformation>(node, "Body:");
-    
-        if (variable) {
-            variable->dumpAST(variableNode);
-        }
-        condition->dumpAST(conditionNode);
-        
-        for (auto& i : body) {
-            i->dumpAST(bodyNode);
-        }
-        
-        if (incrementalValue) {
-            incrementalValue->dumpAST(incrementalValueNode);
-        }
-    
-        if (variable) {
-            node->children.emplace_back(variableNode);
-        }
-        node->children.emplace_back(conditionNode);
-    
-        if (incrementalValue != nullptr) {
-            node->children.emplace_back(incrementalValueNode);
-        }
-        
-        node->children.emplace_back(bodyNode);
-    
-        parentNode->children.emplace_back(node);
-    }
-    
-    NodeEnum NodeStatementFor::getType() {
-        return Node_StatementFor;
-    }
 } /* Namespace Aryiele. */
\ No newline at end of file
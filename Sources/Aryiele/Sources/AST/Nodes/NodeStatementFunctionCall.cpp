@@ -29,50 +29,12 @@
 
 namespace Aryiele {
 
-    NodeStatementFunctionCall::NodeStatementFunctionCall(const std::string &identifier,
-        std::vector<std::shared_ptr<Node>> arguments, std::shared_ptr<Node> subExpression) :
-        identifier(identifier) , arguments(arguments), subExpression(subExpression) {
-        children = std::vector<std::shared_ptr<Node>>();
+    NodeStatementFunctionCall::NodeStatementFunctionCall(Symbol identifier,
+        std::vector<Node*> arguments, Node* subExpression) :
+        Node(Kind), identifier(identifier) , arguments(arguments), subExpression(subExpression) {
+        children = std::vector<Node*>();
         children.insert(children.end(), arguments.begin(), arguments.end());
         children.insert(children.end(), subExpression);
     }
 
-    void NodeStatementFunctionCall::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "Function Call");
-        auto identifierNode = std::make_shared<ParserInformation>(node, "Identifier: " + identifier);
-        auto argumentsNode = std::make_shared<ParserInformation>(node, "Arguments:");
-        auto subExpressionNode = std::make_shared<ParserInformation>(node, "Subexpression:");
-
-        auto i = 0;
-
-        for(auto& argument : arguments) {
-            auto argumentNode = std::make_shared<ParserInformation>(argumentsNode, std::to_string(i));
-            auto body = std::make_shared<ParserInformation>(argumentNode, "Body:");
-
-            argument->dumpAST(body);
-
-            argumentNode->children.emplace_back(body);
-            argumentsNode->children.emplace_back(argumentNode);
-
-            i++;
-        }
-
-        node->children.emplace_back(identifierNode);
-        
-        if (!arguments.empty()) {
-            node->children.emplace_back(argumentsNode);
-        }
-        
-        if (subExpression) {
-            subExpression->dumpAST(subExpressionNode);
-            node->children.emplace_back(subExpressionNode);
-        }
-        
-        parentNode->children.emplace_back(node);
-    }
-    
-    NodeEnum NodeStatementFunctionCall::getType() {
-        return Node_StatementFunctionCall;
-    }
-
 } /* Namespace Aryiele. */
@@ -28,45 +28,12 @@
 #include <Aryiele/AST/Nodes/NodeStatementIf.h>
 
 namespace Aryiele {
-    NodeStatementIf::NodeStatementIf(std::shared_ptr<Node> condition,
-        std::vector<std::shared_ptr<Node>> ifBody, std::vector<std::shared_ptr<Node>> elseBody) :
-        condition(condition), ifBody(ifBody), elseBody(elseBody) {
-        children = std::vector<std::shared_ptr<Node>> {condition};
+    NodeStatementIf::NodeStatementIf(Node* condition,
+        std::vector<Node*> ifBody, std::vector<Node*> elseBody) :
+        Node(Kind), condition(condition), ifBody(ifBody), elseBody(elseBody) {
+        children = std::vector<Node*> {condition};
         children.insert(children.end(), ifBody.begin(), ifBody.end());
         children.insert(children.end(), elseBody.begin(), elseBody.end());
     }
 
-    void NodeStatementIf::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "If/Else");
-        auto ifNode = std::make_shared<ParserInformation>(node, "If");
-        auto ifConditionNode = std::make_shared<ParserInformation>(ifNode, "Condition:");
-        auto ifBodyNode = std::make_shared<ParserInformation>(ifNode, "Body:");
-
-        condition->dumpAST(ifConditionNode);
-
-        for (auto& i : ifBody)
-            i->dumpAST(ifBodyNode);
-
-        ifNode->children.emplace_back(ifConditionNode);
-        ifNode->children.emplace_back(ifBodyNode);
-        node->children.emplace_back(ifNode);
-
-        if (!elseBody.empty()) {
-            auto elseNode = std::make_shared<ParserInformation>(node, "Else");
-            auto elseBodyNode = std::make_shared<ParserInformation>(elseNode, "Body:");
-
-            for (auto& i : elseBody)
-                i->dumpAST(elseBodyNode);
-
-            elseNode->children.emplace_back(elseBodyNode);
-            node->children.emplace_back(elseNode);
-        }
-
-        parentNode->children.emplace_back(node);
-    }
-    
-    NodeEnum NodeStatementIf::getType() {
-        return Node_StatementIf;
-    }
-
 } /* Namespace Aryiele. */
@@ -29,26 +29,9 @@
 
 namespace Aryiele {
 
-    NodeStatementReturn::NodeStatementReturn(std::shared_ptr<Node> expression) :
-        expression(expression) {
-        children = std::vector<std::shared_ptr<Node>> {expression};
-    }
-
-    void NodeStatementReturn::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "Return");
-        
-        if (expression) {
-            auto bodyNode = std::make_shared<ParserInformation>(node, "Body:");
-    
-            expression->dumpAST(bodyNode);
-            node->children.emplace_back(bodyNode);
-        }
-
-        parentNode->children.emplace_back(node);
-    }
-    
-    NodeEnum NodeStatementReturn::getType() {
-        return Node_StatementReturn;
+    NodeStatementReturn::NodeStatementReturn(Node* expression) :
+        Node(Kind), expression(expression) {
+        children = std::vector<Node*> {expression};
     }
 
 } /* Namespace Aryiele. */
@@ -30,47 +30,19 @@
 
 namespace Aryiele {
     
-    NodeStatementSwitch::NodeStatementSwitch(std::shared_ptr<Node> expression,
-        std::vector<std::shared_ptr<Node>> cases) :
-        expression(expression), cases(cases) {
-        children = std::vector<std::shared_ptr<Node>> {expression};
+    NodeStatementSwitch::NodeStatementSwitch(Node* expression,
+        std::vector<Node*> cases) :
+        Node(Kind), expression(expression), cases(cases) {
+        children = std::vector<Node*> {expression};
         children.insert(children.end(), cases.begin(), cases.end());
     }
     
-    void NodeStatementSwitch::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "Switch");
-        auto expressionNode = std::make_shared<ParserInformation>(node, "Expression:");
-        std::shared_ptr<ParserInformation> casesNode = nullptr;
-        
-        if (!cases.empty()) {
-            casesNode = std::make_shared<ParserInformation>(node, "Cases:");
-        }
-    
-        expression->dumpAST(expressionNode);
-        
-        for (auto& caseNode : cases) {
-            caseNode->dumpAST(casesNode);
-        }
-    
-        node->children.emplace_back(expressionNode);
-        
-        if (!cases.empty()) {
-            node->children.emplace_back(casesNode);
-        }
-        
-        parentNode->children.emplace_back(node);
-    }
-    
-    NodeEnum NodeStatementSwitch::getType() {
-        return Node_StatementSwitch;
-    }
-    
     bool NodeStatementSwitch::hasDefault() {
         if (cases.empty()) {
             return false;
         }
         
-        auto caseNode = std::dynamic_pointer_cast<NodeStatementCase>(cases[0]);
+        auto caseNode = cast<NodeStatementCase>(cases[0]);
         
         return caseNode->expression ? false : true;
     }
@@ -28,28 +28,9 @@
 #include <Aryiele/AST/Nodes/NodeStatementVariable.h>
 
 namespace Aryiele {
-    NodeStatementVariable::NodeStatementVariable(const std::string& identifier, std::shared_ptr<Node> subExpression) :
-        identifier(identifier), subExpression(subExpression) {
-        children = std::vector<std::shared_ptr<Node>> {subExpression};
-    }
-
-    void NodeStatementVariable::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "Variable");
-        auto bodyNode = std::make_shared<ParserInformation>(node, "Identifier: " + identifier);
-        auto subExpressionNode = std::make_shared<ParserInformation>(node, "Subexpression:");
-
-        node->children.emplace_back(bodyNode);
-        
-        if (subExpression) {
-            subExpression->dumpAST(subExpressionNode);
-            node->children.emplace_back(subExpressionNode);
-        }
-        
-        parentNode->children.emplace_back(node);
-    }
-    
-    NodeEnum NodeStatementVariable::getType() {
-        return Node_StatementVariable;
+    NodeStatementVariable::NodeStatementVariable(Symbol identifier, Node* subExpression) :
+        Node(Kind), identifier(identifier), subExpression(subExpression) {
+        children = std::vector<Node*> {subExpression};
     }
 
 } /* Namespace Aryiele. */
@@ -29,48 +29,9 @@
 
 namespace Aryiele {
     NodeStatementVariableDeclaration::NodeStatementVariableDeclaration(
-        std::vector<std::shared_ptr<Variable>> variables) :
-        variables(variables) {
-        children = std::vector<std::shared_ptr<Node>>();
-    }
-
-    void NodeStatementVariableDeclaration::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "Variable Declaration");
-        auto constantNode = std::make_shared<ParserInformation>(parentNode,
-            std::string("Constant") + std::string(variables.size() > 1 ? "s" : "") +
-            std::string(": ") + std::string(variables.at(0)->isConstant ? "true" : "false"));
-    
-        node->children.emplace_back(constantNode);
-        
-        auto i = 0;
-
-        for (auto &variable : variables) {
-            auto variableNode = std::make_shared<ParserInformation>(node, std::to_string(i));
-
-            variableNode->children.emplace_back(std::make_shared<ParserInformation>(
-                    variableNode, "Identifier: " + variable->identifier));
-            
-            if (!variable->type.empty()) {
-                variableNode->children.emplace_back(std::make_shared<ParserInformation>(variableNode,
-                    "Type: " + variable->type));
-            }
-
-            if (variable->expression) {
-                auto valueNode = std::make_shared<ParserInformation>(variableNode, "Expression:");
-                variable->expression->dumpAST(valueNode);
-                variableNode->children.emplace_back(valueNode);
-            }
-
-            node->children.emplace_back(variableNode);
-
-            i++;
-        }
-
-        parentNode->children.emplace_back(node);
-    }
-    
-    NodeEnum NodeStatementVariableDeclaration::getType() {
-        return Node_StatementVariableDeclaration;
+        std::vector<Variable*> variables) :
+        Node(Kind), variables(variables) {
+        children = std::vector<Node*>();
     }
 
 } /* Namespace Aryiele. */
\ No newline at end of file
@@ -28,34 +28,10 @@
 #include <Aryiele/AST/Nodes/NodeStatementWhile.h>
 
 namespace Aryiele {
-    NodeStatementWhile::NodeStatementWhile(bool doOnce, std::shared_ptr<Node> condition,
-        std::vector<std::shared_ptr<Node>> body) :
-        doOnce(doOnce), condition(condition), body(body) {
-        children = std::vector<std::shared_ptr<Node>> {condition};
+    NodeStatementWhile::NodeStatementWhile(bool doOnce, Node* condition,
+        std::vector<Node*> body) :
+        Node(Kind), doOnce(doOnce), condition(condition), body(body) {
+        children = std::vector<Node*> {condition};
         children.insert(children.end(), body.begin(), body.end());
     }
-    
-    void NodeStatementWhile::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "While");
-        auto doOnceNode = std::make_shared<ParserInformation>(node,
-            std::string("Do: ") + std::string((doOnce ? "true" : "false")));
-        auto conditionNode = std::make_shared<ParserInformation>(node, "Condition:");
-        auto bodyNode = std::make_shared<ParserInformation>(node, "Body:");
-    
-        condition->dumpAST(conditionNode);
-    
-        for (auto& i : body) {
-            i->dumpAST(bodyNode);
-        }
-    
-        node->children.emplace_back(doOnceNode);
-        node->children.emplace_back(conditionNode);
-        node->children.emplace_back(bodyNode);
-    
-        parentNode->children.emplace_back(node);
-    }
-    
-    NodeEnum NodeStatementWhile::getType() {
-        return Node_StatementWhile;
-    }
 } /* Namespace Aryiele. */
\ No newline at end of file
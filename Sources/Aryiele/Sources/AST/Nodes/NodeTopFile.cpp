@@ -26,33 +26,12 @@
 //==================================================================================//
 
 #include <Aryiele/AST/Nodes/NodeTopFile.h>
-#include <Sources/Vanir/Include/Vanir/FileSystem/FileSystem.h>
 
 namespace Aryiele {
-    NodeTopFile::NodeTopFile(const std::string &path, std::vector<std::shared_ptr<Node>> body) :
-        path(path), body(body) {
-        children = std::vector<std::shared_ptr<Node>>();
+    NodeTopFile::NodeTopFile(const std::string &path, std::vector<Node*> body) :
+        Node(Kind), path(path), body(body) {
+        children = std::vector<Node*>();
         children.insert(children.end(), body.begin(), body.end());
     }
     
-    void NodeTopFile::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "File");
-        auto identifierNode = std::make_shared<ParserInformation>(node,
-            "Identifier: " + Vanir::FileSystem::getFilePath(path));
-        auto bodyNode = std::make_shared<ParserInformation>(node, "Body:");
-    
-        for (auto& childNode : body) {
-            childNode->dumpAST(bodyNode);
-        }
-    
-        node->children.emplace_back(identifierNode);
-        node->children.emplace_back(bodyNode);
-    
-        parentNode->children.emplace_back(node);
-    }
-    
-    NodeEnum NodeTopFile::getType() {
-        return Node_TopFile;
-    }
-    
 } /* Namespace Aryiele. */
\ No newline at end of file
@@ -28,50 +28,11 @@
 #include <Aryiele/AST/Nodes/NodeTopFunction.h>
 
 namespace Aryiele {
-    NodeTopFunction::NodeTopFunction(const std::string& identifier, const std::string& type,
-        std::vector<Argument> arguments, std::vector<std::shared_ptr<Node>> body) :
-        identifier(identifier), type(type), arguments(arguments), body(body) {
-        children = std::vector<std::shared_ptr<Node>> ();
+    NodeTopFunction::NodeTopFunction(Symbol identifier, Symbol type,
+        std::vector<Argument> arguments, std::vector<Node*> body) :
+        Node(Kind), identifier(identifier), type(type), arguments(arguments), body(body) {
+        children = std::vector<Node*> ();
         children.insert(children.end(), body.begin(), body.end());
     }
 
-    void NodeTopFunction::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "Function");
-        auto argumentsNode = std::make_shared<ParserInformation>(node, "Arguments:");
-        auto valueNode = std::make_shared<ParserInformation>(node, "Body:");
-
-        for (auto& childNode : body)
-            childNode->dumpAST(valueNode);
-
-        int i = 0;
-
-        for(auto& argument : arguments) {
-            auto argumentNode = std::make_shared<ParserInformation>(argumentsNode, std::to_string(i));
-
-            argumentNode->children.emplace_back(std::make_shared<ParserInformation>(
-                argumentNode, "Identifier: " + argument.identifier));
-            argumentNode->children.emplace_back(std::make_shared<ParserInformation>(
-                argumentNode, "Type: " + argument.type));
-
-            argumentsNode->children.emplace_back(argumentNode);
-
-            i++;
-        }
-
-        node->children.emplace_back(std::make_shared<ParserInformation>(node, "Identifier: " + identifier));
-        node->children.emplace_back(std::make_shared<ParserInformation>(node, "Type: " + type));
-        
-        if (!arguments.empty()) {
-            node->children.emplace_back(argumentsNode);
-        }
-        
-        node->children.emplace_back(valueNode);
-
-        parentNode->children.emplace_back(node);
-    }
-
-    NodeEnum NodeTopFunction::getType() {
-        return Node_TopFunction;
-    }
-
 } /* Namespace Aryiele. */
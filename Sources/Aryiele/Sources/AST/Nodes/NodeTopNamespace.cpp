@@ -28,28 +28,9 @@
 #include <Aryiele/AST/Nodes/NodeTopNamespace.h>
 
 namespace Aryiele {
-    NodeTopNamespace::NodeTopNamespace(const std::string& identifier, std::vector<std::shared_ptr<Node>> body) :
-        identifier(identifier), body(body) {
-        children = std::vector<std::shared_ptr<Node>> ();
+    NodeTopNamespace::NodeTopNamespace(Symbol identifier, std::vector<Node*> body) :
+        Node(Kind), identifier(identifier), body(body) {
+        children = std::vector<Node*> ();
         children.insert(children.end(), body.begin(), body.end());
     }
-    
-    void NodeTopNamespace::dumpAST(std::shared_ptr<ParserInformation> parentNode) {
-        auto node = std::make_shared<ParserInformation>(parentNode, "Namespace");
-        auto identifierNode = std::make_shared<ParserInformation>(node, "Identifier: " + identifier);
-        auto bodyNode = std::make_shared<ParserInformation>(node, "Body:");
-    
-        for (auto& statement : body) {
-            statement->dumpAST(bodyNode);
-        }
-    
-        node->children.emplace_back(identifierNode);
-        node->children.emplace_back(bodyNode);
-        
-        parentNode->children.emplace_back(node);
-    }
-    
-    NodeEnum NodeTopNamespace::getType() {
-        return Node_TopNamespace;
-    }
 } /* Namespace Aryiele. */
\ No newline at end of file
@@ -0,0 +1,221 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#include <Aryiele/AST/Resolver.h>
+#include <Aryiele/AST/Nodes/NodeLiteralArray.h>
+#include <Aryiele/AST/Nodes/NodeStatementBlock.h>
+#include <Aryiele/AST/Nodes/NodeStatementCase.h>
+#include <Aryiele/AST/Nodes/NodeStatementFor.h>
+#include <Aryiele/AST/Nodes/NodeStatementFunctionCall.h>
+#include <Aryiele/AST/Nodes/NodeStatementIf.h>
+#include <Aryiele/AST/Nodes/NodeStatementSwitch.h>
+#include <Aryiele/AST/Nodes/NodeStatementVariable.h>
+#include <Aryiele/AST/Nodes/NodeStatementVariableDeclaration.h>
+#include <Aryiele/AST/Nodes/NodeStatementWhile.h>
+
+namespace Aryiele {
+    void Resolver::resolve(NodeRoot* nodeRoot) {
+        const auto declarations = getDeclarations(nodeRoot);
+
+        m_globals.clear();
+        m_globalCount = 0;
+        m_variables.clear();
+
+        // The globals first, so that the bodies parsed now see the same ones as the bodies parsed later.
+        for (auto& node : declarations) {
+            if (auto declaration = dyn_cast<NodeStatementVariableDeclaration>(node)) {
+                for (auto& variable : declaration->variables) {
+                    visit(variable->expression);
+
+                    variable->slot = m_globalCount++;
+                    m_globals[variable->identifier] = variable->slot;
+                }
+            }
+        }
+
+        for (auto& node : declarations) {
+            auto function = dyn_cast<NodeTopFunction>(node);
+
+            if (function && function->lazyBody.empty())
+                resolve(function);
+        }
+    }
+
+    void Resolver::resolve(NodeTopFunction* function) {
+        m_variables.clear();
+        m_shadowedVariables.clear();
+        m_scopes.clear();
+        m_slotCount = 0;
+
+        pushScope();
+
+        for (auto& argument : function->arguments)
+            declare(argument.identifier);
+
+        visitBody(function->body);
+        popScope();
+
+        function->slotCount = m_slotCount;
+    }
+
+    Slot Resolver::getGlobalCount() const {
+        return m_globalCount;
+    }
+
+    void Resolver::pushScope() {
+        m_scopes.push_back(m_shadowedVariables.size());
+    }
+
+    void Resolver::popScope() {
+        const auto size = m_scopes.back();
+
+        m_scopes.pop_back();
+
+        while (m_shadowedVariables.size() > size) {
+            const auto& shadowed = m_shadowedVariables.back();
+
+            if (shadowed.second == Slot_Unresolved)
+                m_variables.erase(shadowed.first);
+            else
+                m_variables[shadowed.first] = shadowed.second;
+
+            m_shadowedVariables.pop_back();
+        }
+    }
+
+    Slot Resolver::declare(Symbol identifier) {
+        auto variable = m_variables.find(identifier);
+
+        m_shadowedVariables.emplace_back(identifier,
+            variable != m_variables.end() ? variable->second : Slot_Unresolved);
+
+        return m_variables[identifier] = m_slotCount++;
+    }
+
+    void Resolver::visitBody(const std::vector<Node*>& body) {
+        for (auto& statement : body)
+            visit(statement);
+    }
+
+    void Resolver::visit(Node* node) {
+        if (!node)
+            return;
+
+        switch (node->getType()) {
+            case Node_LiteralArray:
+                visitBody(cast<NodeLiteralArray>(node)->elements);
+                break;
+            case Node_StatementBlock:
+                pushScope();
+                visitBody(cast<NodeStatementBlock>(node)->body);
+                popScope();
+                break;
+            case Node_StatementFor: {
+                auto statement = cast<NodeStatementFor>(node);
+
+                pushScope();
+
+                if (auto declaration = dyn_cast<NodeStatementVariableDeclaration>(statement->variable)) {
+                    visit(declaration->variables[0]->expression);
+
+                    declaration->variables[0]->slot = declare(declaration->variables[0]->identifier);
+                } else {
+                    visit(statement->variable);
+                }
+
+                visit(statement->incrementalValue);
+                visit(statement->condition);
+                visitBody(statement->body);
+                popScope();
+                break;
+            }
+            // The sub-expression is a member, not a variable of the function.
+            case Node_StatementFunctionCall:
+                visitBody(cast<NodeStatementFunctionCall>(node)->arguments);
+                break;
+            case Node_StatementIf: {
+                auto statement = cast<NodeStatementIf>(node);
+
+                visit(statement->condition);
+
+                for (auto body : { &statement->ifBody, &statement->elseBody }) {
+                    pushScope();
+                    visitBody(*body);
+                    popScope();
+                }
+                break;
+            }
+            case Node_StatementSwitch: {
+                auto statement = cast<NodeStatementSwitch>(node);
+
+                visit(statement->expression);
+
+                for (auto& caseNode : statement->cases) {
+                    pushScope();
+                    visit(cast<NodeStatementCase>(caseNode)->expression);
+                    visitBody(cast<NodeStatementCase>(caseNode)->body);
+                    popScope();
+                }
+                break;
+            }
+            case Node_StatementVariable: {
+                auto variable = cast<NodeStatementVariable>(node);
+                auto local = m_variables.find(variable->identifier);
+
+                if (local != m_variables.end()) {
+                    variable->slot = local->second;
+                    variable->isGlobal = false;
+                    break;
+                }
+
+                auto global = m_globals.find(variable->identifier);
+
+                variable->slot = global != m_globals.end() ? global->second : Slot_Unresolved;
+                variable->isGlobal = global != m_globals.end();
+                break;
+            }
+            case Node_StatementVariableDeclaration:
+                for (auto& variable : cast<NodeStatementVariableDeclaration>(node)->variables) {
+                    visit(variable->expression);
+
+                    variable->slot = declare(variable->identifier);
+                }
+                break;
+            case Node_StatementWhile:
+                pushScope();
+                visit(cast<NodeStatementWhile>(node)->condition);
+                visitBody(cast<NodeStatementWhile>(node)->body);
+                popScope();
+                break;
+            default:
+                for (auto& child : node->children)
+                    visit(child);
+                break;
+        }
+    }
+
+} /* Namespace Aryiele. */
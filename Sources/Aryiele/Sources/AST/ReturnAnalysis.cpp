@@ -0,0 +1,145 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#include <Aryiele/AST/ASTOperands.h>
+#include <Aryiele/AST/ReturnAnalysis.h>
+#include <Aryiele/AST/Nodes/NodeOperationTernary.h>
+#include <Aryiele/AST/Nodes/NodeStatementCase.h>
+#include <Aryiele/AST/Nodes/NodeStatementFor.h>
+#include <Aryiele/AST/Nodes/NodeStatementIf.h>
+#include <Aryiele/AST/Nodes/NodeStatementReturn.h>
+#include <Aryiele/AST/Nodes/NodeStatementSwitch.h>
+#include <Aryiele/AST/Nodes/NodeStatementWhile.h>
+#include <Aryiele/AST/Nodes/NodeTopFunction.h>
+
+namespace Aryiele {
+    namespace {
+        // The rules of ReturnAnalysis, the nodes and bodies under the node being answered for by the functions.
+        template<typename NodeReturns, typename BodyReturns>
+        bool isNodeReturning(Node* node, NodeReturns nodeReturns, BodyReturns bodyReturns) {
+            switch (node->getType()) {
+                case Node_TopFunction: {
+                    auto function = cast<NodeTopFunction>(node);
+
+                    return function->type == Symbol_Void || bodyReturns(function->body);
+                }
+                case Node_StatementIf:
+                    return bodyReturns(cast<NodeStatementIf>(node)->ifBody) &&
+                        bodyReturns(cast<NodeStatementIf>(node)->elseBody);
+                case Node_StatementFor:
+                    return bodyReturns(cast<NodeStatementFor>(node)->body);
+                case Node_StatementWhile:
+                    return bodyReturns(cast<NodeStatementWhile>(node)->body);
+                case Node_StatementSwitch: {
+                    auto statement = cast<NodeStatementSwitch>(node);
+
+                    if (!statement->hasDefault())
+                        return false;
+
+                    for (auto& caseNode : statement->cases) {
+                        if (!bodyReturns(cast<NodeStatementCase>(caseNode)->body))
+                            return false;
+                    }
+
+                    return true;
+                }
+                case Node_OperationTernary:
+                    return nodeReturns(cast<NodeOperationTernary>(node)->lhs) &&
+                        nodeReturns(cast<NodeOperationTernary>(node)->rhs);
+                case Node_StatementReturn:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+    }
+
+    void ReturnAnalysis::analyze(Node* node) {
+        struct Entry {
+            Node* node;
+            bool isExpanded;
+        };
+
+        // Operands are answered for before the node using them, without recursion.
+        std::vector<Entry> entries { { node, false } };
+        std::vector<Node*> operands;
+
+        while (!entries.empty()) {
+            auto& entry = entries.back();
+            auto current = entry.node;
+
+            if (!entry.isExpanded) {
+                entry.isExpanded = true;
+
+                operands.clear();
+                getOperands(current, operands);
+
+                for (auto& operand : operands) {
+                    if (operand)
+                        entries.push_back({ operand, false });
+                }
+
+                continue;
+            }
+
+            entries.pop_back();
+
+            current->isReturning = isNodeReturning(current, [](Node* operand) {
+                return operand && operand->isReturning;
+            }, [](const std::vector<Node*>& body) {
+                return isReturning(body);
+            });
+        }
+    }
+
+    bool ReturnAnalysis::isReturning(const std::vector<Node*>& body) {
+        for (auto& statement : body) {
+            if (statement && statement->isReturning)
+                return true;
+        }
+
+        return false;
+    }
+
+    bool ReturnAnalysis::walk(Node* node) {
+        return node && isNodeReturning(node, [](Node* operand) {
+            return walk(operand);
+        }, [](const std::vector<Node*>& body) {
+            return walk(body);
+        });
+    }
+
+    bool ReturnAnalysis::walk(const std::vector<Node*>& body) {
+        for (auto& statement : body) {
+            if (walk(statement))
+                return true;
+        }
+
+        return false;
+    }
+
+} /* Namespace Aryiele. */
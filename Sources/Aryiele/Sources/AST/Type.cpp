@@ -0,0 +1,114 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#include <Aryiele/AST/Type.h>
+
+namespace Aryiele {
+    const Type Type::Int8 { Type_Integer, 8, true, Symbol_Int8 };
+    const Type Type::Int16 { Type_Integer, 16, true, Symbol_Int16 };
+    const Type Type::Int32 { Type_Integer, 32, true, Symbol_Int32 };
+    const Type Type::Int64 { Type_Integer, 64, true, Symbol_Int64 };
+    const Type Type::UInt8 { Type_Integer, 8, false, Symbol_UInt8 };
+    const Type Type::UInt16 { Type_Integer, 16, false, Symbol_UInt16 };
+    const Type Type::UInt32 { Type_Integer, 32, false, Symbol_UInt32 };
+    const Type Type::UInt64 { Type_Integer, 64, false, Symbol_UInt64 };
+    const Type Type::Float { Type_Float, 32, true, Symbol_Float };
+    const Type Type::Double { Type_Double, 64, true, Symbol_Double };
+    const Type Type::Boolean { Type_Boolean, 0, false, Symbol_Boolean };
+    const Type Type::String { Type_String, 0, false, Symbol_String };
+    const Type Type::Character { Type_Character, 0, false, Symbol_Character };
+    const Type Type::Void { Type_Void, 0, false, Symbol_Void };
+
+    bool Type::isInteger() const {
+        return kind == Type_Integer;
+    }
+
+    bool Type::isFloating() const {
+        return kind == Type_Float || kind == Type_Double;
+    }
+
+    bool Type::isArithmetic() const {
+        return isInteger() || isFloating();
+    }
+
+    std::string Type::getName() const {
+        return getSymbolTable().getName(name);
+    }
+
+    const Type* Type::get(Symbol name) {
+        switch (name) {
+            case Symbol_Int8:
+                return &Int8;
+            case Symbol_Int16:
+                return &Int16;
+            case Symbol_Int32:
+                return &Int32;
+            case Symbol_Int64:
+            case Symbol_Int:
+                return &Int64;
+            case Symbol_UInt8:
+                return &UInt8;
+            case Symbol_UInt16:
+                return &UInt16;
+            case Symbol_UInt32:
+                return &UInt32;
+            case Symbol_UInt64:
+            case Symbol_UInt:
+                return &UInt64;
+            case Symbol_Float:
+                return &Float;
+            case Symbol_Double:
+                return &Double;
+            case Symbol_Boolean:
+                return &Boolean;
+            case Symbol_String:
+                return &String;
+            case Symbol_Character:
+                return &Character;
+            case Symbol_Void:
+                return &Void;
+            default:
+                return nullptr;
+        }
+    }
+
+    const Type* Type::getInteger(uint32_t width, bool isSigned) {
+        switch (width) {
+            case 8:
+                return isSigned ? &Int8 : &UInt8;
+            case 16:
+                return isSigned ? &Int16 : &UInt16;
+            case 32:
+                return isSigned ? &Int32 : &UInt32;
+            case 64:
+                return isSigned ? &Int64 : &UInt64;
+            default:
+                return nullptr;
+        }
+    }
+
+} /* Namespace Aryiele. */
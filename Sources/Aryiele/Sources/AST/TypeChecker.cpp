@@ -0,0 +1,572 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#include <algorithm>
+#include <cfloat>
+#include <climits>
+#include <cmath>
+#include <string>
+#include <Aryiele/AST/TypeChecker.h>
+
+namespace Aryiele {
+    namespace {
+        bool isConvertible(const Type* type) {
+            return type->isArithmetic() || type->kind == Type_Boolean;
+        }
+
+        // The type both operands of an operation are converted to: the floating one if any, else the wider, the
+        // unsigned one when both are as wide, as the usual arithmetic conversions do. Operands are never narrowed.
+        const Type* getCommonType(const Type* lhs, const Type* rhs) {
+            if (lhs->isFloating() != rhs->isFloating())
+                return lhs->isFloating() ? lhs : rhs;
+            else if (lhs->width != rhs->width)
+                return lhs->width > rhs->width ? lhs : rhs;
+
+            return lhs->isSigned ? rhs : lhs;
+        }
+
+        // Whether the value of the integer literal is one of the integer type, which it is then given without a cast.
+        bool isInRange(NodeLiteralNumberInteger* literal, const Type* type) {
+            if (!type->isInteger())
+                return false;
+            else if (literal->isUnsigned)
+                return !type->isSigned && type->width == 64;
+            else if (type->width == 64)
+                return type->isSigned || literal->value >= 0;
+
+            const auto maximum = (int64_t(1) << (type->isSigned ? type->width - 1 : type->width)) - 1;
+            const auto minimum = type->isSigned ? -maximum - 1 : 0;
+
+            return literal->value >= minimum && literal->value <= maximum;
+        }
+
+        // A decimal literal computed with a Float is one, as when it is assigned to a Float, and an integer literal
+        // computed with an integer is of its type when its value is in range.
+        const Type* getCommonType(Node* lhs, const Type* lhsType, Node* rhs, const Type* rhsType) {
+            if ((lhsType == &Type::Float && isa<NodeLiteralNumberFloating>(rhs)) ||
+                (rhsType == &Type::Float && isa<NodeLiteralNumberFloating>(lhs)))
+                return &Type::Float;
+            else if (isa<NodeLiteralNumberInteger>(rhs) && isInRange(cast<NodeLiteralNumberInteger>(rhs), lhsType))
+                return lhsType;
+            else if (isa<NodeLiteralNumberInteger>(lhs) && isInRange(cast<NodeLiteralNumberInteger>(lhs), rhsType))
+                return rhsType;
+
+            return getCommonType(lhsType, rhsType);
+        }
+
+        bool isComparison(ParserTokenEnum operation) {
+            return operation == ParserToken_OperatorComparisonLessThan ||
+                operation == ParserToken_OperatorComparisonLessThanOrEqual ||
+                operation == ParserToken_OperatorComparisonGreaterThan ||
+                operation == ParserToken_OperatorComparisonGreaterThanOrEqual ||
+                operation == ParserToken_OperatorComparisonEqual ||
+                operation == ParserToken_OperatorComparisonNotEqual;
+        }
+
+        bool isAssignment(ParserTokenEnum operation) {
+            return operation == ParserToken_OperatorEqual ||
+                operation == ParserToken_OperatorArithmeticPlusEqual ||
+                operation == ParserToken_OperatorArithmeticMinusEqual ||
+                operation == ParserToken_OperatorArithmeticMultiplyEqual ||
+                operation == ParserToken_OperatorArithmeticDivideEqual ||
+                operation == ParserToken_OperatorArithmeticRemainderEqual;
+        }
+    }
+
+    bool TypeChecker::check(ASTContext& context, NodeRoot* nodeRoot) {
+        const auto errorCount = ::Vanir::Logger::errorCount;
+
+        m_context = &context;
+        m_globalTypes.clear();
+
+        const auto declarations = getDeclarations(nodeRoot);
+
+        // Functions can be called before being declared, and their bodies are not always parsed yet.
+        for (auto& node : declarations) {
+            if (auto function = dyn_cast<NodeTopFunction>(node))
+                declareFunction(function);
+        }
+
+        // The types of the globals are known before the bodies using them, wherever they are declared.
+        for (auto& node : declarations) {
+            if (auto declaration = dyn_cast<NodeStatementVariableDeclaration>(node)) {
+                for (auto& variable : declaration->variables)
+                    checkVariable(variable, true);
+            }
+        }
+
+        for (auto& node : declarations) {
+            auto function = dyn_cast<NodeTopFunction>(node);
+
+            if (function && function->lazyBody.empty())
+                checkFunction(function);
+        }
+
+        return ::Vanir::Logger::errorCount == errorCount;
+    }
+
+    bool TypeChecker::check(ASTContext& context, NodeTopFunction* function) {
+        const auto errorCount = ::Vanir::Logger::errorCount;
+
+        m_context = &context;
+
+        checkFunction(function);
+
+        return ::Vanir::Logger::errorCount == errorCount;
+    }
+
+    void TypeChecker::declareFunction(Symbol identifier, const Type* returnType,
+                                      std::vector<const Type*> argumentTypes) {
+        m_signatures[identifier] = { returnType, std::move(argumentTypes) };
+    }
+
+    const Type* TypeChecker::resolveType(Symbol name) {
+        auto type = Type::get(name);
+
+        if (!type) {
+            LOG_ERROR("unknown type: ", getSymbolTable().getName(name))
+        }
+
+        return type;
+    }
+
+    void TypeChecker::declareFunction(NodeTopFunction* function) {
+        std::vector<const Type*> argumentTypes;
+
+        function->returnType = resolveType(function->type);
+
+        for (auto& argument : function->arguments) {
+            argument.valueType = resolveType(argument.type);
+
+            if (argument.valueType == &Type::Void) {
+                LOG_ERROR("in function '", getSymbolTable().getName(function->identifier), "': argument '",
+                    getSymbolTable().getName(argument.identifier), "' cannot be of type Void")
+
+                argument.valueType = nullptr;
+            }
+
+            argumentTypes.emplace_back(argument.valueType);
+        }
+
+        declareFunction(function->identifier, function->returnType, argumentTypes);
+    }
+
+    void TypeChecker::checkFunction(NodeTopFunction* function) {
+        m_variableTypes.assign(function->slotCount, nullptr);
+        m_returnType = function->returnType;
+        m_isInFunction = true;
+
+        for (size_t i = 0; i < function->arguments.size(); i++)
+            m_variableTypes[i] = function->arguments[i].valueType;
+
+        checkBody(function->body);
+
+        m_isInFunction = false;
+    }
+
+    void TypeChecker::checkBody(const std::vector<Node*>& body) {
+        for (auto& statement : body)
+            check(statement);
+    }
+
+    void TypeChecker::checkVariable(Variable* variable, bool isGlobal) {
+        const Type* type = nullptr;
+
+        if (variable->type != Symbol_Empty) {
+            type = resolveType(variable->type);
+
+            if (type && variable->expression)
+                convert(variable->expression, type);
+        } else if (variable->expression) {
+            type = check(variable->expression);
+        } else {
+            LOG_ERROR("cannot infer the type of the variable '", getSymbolTable().getName(variable->identifier),
+                "' without a value")
+        }
+
+        if (type == &Type::Void) {
+            LOG_ERROR("the variable '", getSymbolTable().getName(variable->identifier), "' cannot be of type Void")
+
+            type = nullptr;
+        }
+
+        variable->valueType = type;
+
+        if (variable->slot == Slot_Unresolved)
+            return;
+
+        auto& types = isGlobal ? m_globalTypes : m_variableTypes;
+
+        if (types.size() <= variable->slot)
+            types.resize(variable->slot + 1, nullptr);
+
+        types[variable->slot] = type;
+    }
+
+    const Type* TypeChecker::check(Node* node) {
+        if (!node)
+            return &Type::Void;
+
+        return node->valueType = visit(node);
+    }
+
+    const Type* TypeChecker::convert(Node*& expression, const Type* type) {
+        auto expressionType = check(expression);
+
+        if (!expressionType || !type || !insertCast(expression, expressionType, type))
+            return nullptr;
+
+        return type;
+    }
+
+    bool TypeChecker::insertCast(Node*& expression, const Type* expressionType, const Type* type) {
+        if (expressionType == type)
+            return true;
+
+        // A decimal literal used as a Float is generated in single precision directly, rounded once.
+        if (type == &Type::Float && isa<NodeLiteralNumberFloating>(expression)) {
+            if (std::fabs(cast<NodeLiteralNumberFloating>(expression)->value) > FLT_MAX) {
+                LOG_ERROR("cannot represent the floating literal ", cast<NodeLiteralNumberFloating>(expression)->value,
+                    " as a Float")
+
+                return false;
+            }
+
+            expression->valueType = type;
+
+            return true;
+        }
+
+        // An integer literal used as an integer type is generated in that type directly, when it holds its value.
+        if (type->isInteger() && isa<NodeLiteralNumberInteger>(expression)) {
+            auto literal = cast<NodeLiteralNumberInteger>(expression);
+
+            if (!isInRange(literal, type)) {
+                const auto value = literal->isUnsigned ? std::to_string(static_cast<uint64_t>(literal->value)) :
+                    std::to_string(literal->value);
+
+                LOG_ERROR("cannot represent the integer literal ", value, " as a value of type ", type->getName())
+
+                return false;
+            }
+
+            expression->valueType = type;
+
+            return true;
+        }
+
+        if (!isConvertible(expressionType) || !isConvertible(type)) {
+            LOG_ERROR("cannot convert a value of type ", expressionType->getName(), " to ", type->getName())
+
+            return false;
+        }
+
+        auto cast = m_context->create<NodeOperationCast>(expression, type);
+
+        cast->parent = expression->parent;
+
+        if (expression->parent) {
+            auto& children = expression->parent->children;
+
+            std::replace(children.begin(), children.end(), expression, static_cast<Node*>(cast));
+        }
+
+        expression->parent = cast;
+        expression = cast;
+
+        return true;
+    }
+
+    const Type* TypeChecker::visitNode(Node* node) {
+        return &Type::Void;
+    }
+
+    // Arrays are not generated yet, only their elements are checked.
+    const Type* TypeChecker::visitLiteralArray(NodeLiteralArray* node) {
+        for (auto& element : node->elements)
+            check(element);
+
+        return &Type::Void;
+    }
+
+    const Type* TypeChecker::visitLiteralBoolean(NodeLiteralBoolean* node) {
+        return &Type::Boolean;
+    }
+
+    const Type* TypeChecker::visitLiteralCharacter(NodeLiteralCharacter* node) {
+        return &Type::Character;
+    }
+
+    const Type* TypeChecker::visitLiteralNumberFloating(NodeLiteralNumberFloating* node) {
+        if (std::isfinite(node->value))
+            return &Type::Double;
+
+        LOG_ERROR("cannot represent the floating literal ", node->value)
+
+        return nullptr;
+    }
+
+    const Type* TypeChecker::visitLiteralNumberInteger(NodeLiteralNumberInteger* node) {
+        if (node->isUnsigned)
+            return &Type::UInt64;
+        else if (node->value >= INT32_MIN && node->value <= INT32_MAX)
+            return &Type::Int32;
+
+        return &Type::Int64;
+    }
+
+    const Type* TypeChecker::visitLiteralString(NodeLiteralString* node) {
+        return &Type::String;
+    }
+
+    const Type* TypeChecker::visitOperationUnary(NodeOperationUnary* node) {
+        if (node->operationType == ParserToken_OperatorUnaryLogicalNot)
+            return convert(node->expression, &Type::Boolean);
+
+        auto type = check(node->expression);
+
+        if (type && !type->isArithmetic()) {
+            LOG_ERROR("cannot apply the operator '", ParserToken::getTypeName(node->operationType),
+                "' to a value of type ", type->getName())
+
+            return nullptr;
+        }
+
+        return type;
+    }
+
+    const Type* TypeChecker::visitOperationBinary(NodeOperationBinary* node) {
+        const auto operation = node->operationType;
+
+        if (isAssignment(operation)) {
+            if (!isa<NodeStatementVariable>(node->lhs)) {
+                LOG_ERROR("cannot assign to an expression which is not a variable")
+
+                return nullptr;
+            }
+
+            auto type = check(node->lhs);
+
+            if (type && operation != ParserToken_OperatorEqual && !type->isArithmetic()) {
+                LOG_ERROR("cannot apply the operator '", ParserToken::getTypeName(operation),
+                    "' to a value of type ", type->getName())
+
+                return nullptr;
+            }
+
+            return convert(node->rhs, type) ? &Type::Void : nullptr;
+        }
+
+        if (operation == ParserToken_OperatorLogicalAnd || operation == ParserToken_OperatorLogicalOr) {
+            auto lhsType = convert(node->lhs, &Type::Boolean);
+            auto rhsType = convert(node->rhs, &Type::Boolean);
+
+            return lhsType && rhsType ? &Type::Boolean : nullptr;
+        }
+
+        auto lhsType = check(node->lhs);
+        auto rhsType = check(node->rhs);
+
+        if (!lhsType || !rhsType)
+            return nullptr;
+
+        const auto isEquality = operation == ParserToken_OperatorComparisonEqual ||
+            operation == ParserToken_OperatorComparisonNotEqual;
+
+        for (auto type : { lhsType, rhsType }) {
+            if (!type->isArithmetic() && !(isEquality && type->kind == Type_Boolean)) {
+                LOG_ERROR("cannot apply the operator '", ParserToken::getTypeName(operation),
+                    "' to a value of type ", type->getName())
+
+                return nullptr;
+            }
+        }
+
+        auto type = getCommonType(node->lhs, lhsType, node->rhs, rhsType);
+
+        if (!insertCast(node->lhs, lhsType, type) || !insertCast(node->rhs, rhsType, type))
+            return nullptr;
+
+        return isComparison(operation) ? &Type::Boolean : type;
+    }
+
+    const Type* TypeChecker::visitOperationTernary(NodeOperationTernary* node) {
+        auto conditionType = convert(node->condition, &Type::Boolean);
+        auto lhsType = check(node->lhs);
+        auto rhsType = check(node->rhs);
+
+        if (!conditionType || !lhsType || !rhsType)
+            return nullptr;
+
+        auto type = getCommonType(node->lhs, lhsType, node->rhs, rhsType);
+
+        if (!insertCast(node->lhs, lhsType, type) || !insertCast(node->rhs, rhsType, type))
+            return nullptr;
+
+        return type;
+    }
+
+    const Type* TypeChecker::visitOperationCast(NodeOperationCast* node) {
+        return node->valueType;
+    }
+
+    const Type* TypeChecker::visitStatementArrayCall(NodeStatementArrayCall* node) {
+        check(node->expression);
+        check(node->subExpression);
+
+        return &Type::Void;
+    }
+
+    const Type* TypeChecker::visitStatementBlock(NodeStatementBlock* node) {
+        checkBody(node->body);
+
+        return &Type::Void;
+    }
+
+    const Type* TypeChecker::visitStatementFor(NodeStatementFor* node) {
+        const Type* type = nullptr;
+
+        if (auto declaration = dyn_cast<NodeStatementVariableDeclaration>(node->variable)) {
+            checkVariable(declaration->variables[0], false);
+
+            type = declaration->variables[0]->valueType;
+        } else if (node->variable) {
+            type = check(node->variable);
+        }
+
+        if (type && !type->isArithmetic()) {
+            LOG_ERROR("the variable of a for loop cannot be of type ", type->getName())
+        } else if (type && node->incrementalValue) {
+            convert(node->incrementalValue, type);
+        }
+
+        convert(node->condition, &Type::Boolean);
+        checkBody(node->body);
+
+        return &Type::Void;
+    }
+
+    const Type* TypeChecker::visitStatementFunctionCall(NodeStatementFunctionCall* node) {
+        auto signature = m_signatures.find(node->identifier);
+
+        if (signature == m_signatures.end()) {
+            LOG_ERROR("unknown function referenced: ", getSymbolTable().getName(node->identifier))
+
+            return nullptr;
+        }
+
+        const auto& argumentTypes = signature->second.argumentTypes;
+
+        if (argumentTypes.size() != node->arguments.size()) {
+            LOG_ERROR("incorrect number of argument passed: ",
+                node->arguments.size(), " while expecting ", argumentTypes.size())
+
+            return nullptr;
+        }
+
+        auto isValid = true;
+
+        for (size_t i = 0; i < argumentTypes.size(); i++)
+            isValid &= convert(node->arguments[i], argumentTypes[i]) != nullptr;
+
+        return isValid ? signature->second.returnType : nullptr;
+    }
+
+    const Type* TypeChecker::visitStatementIf(NodeStatementIf* node) {
+        convert(node->condition, &Type::Boolean);
+        checkBody(node->ifBody);
+        checkBody(node->elseBody);
+
+        return &Type::Void;
+    }
+
+    const Type* TypeChecker::visitStatementReturn(NodeStatementReturn* node) {
+        if (!m_returnType)
+            return nullptr;
+
+        if (!node->expression) {
+            if (m_returnType != &Type::Void) {
+                LOG_ERROR("cannot return without a value from a function returning ", m_returnType->getName())
+            }
+        } else if (m_returnType == &Type::Void) {
+            LOG_ERROR("cannot return a value from a function returning Void")
+        } else {
+            convert(node->expression, m_returnType);
+        }
+
+        return &Type::Void;
+    }
+
+    const Type* TypeChecker::visitStatementSwitch(NodeStatementSwitch* node) {
+        auto type = check(node->expression);
+
+        if (type && !type->isInteger()) {
+            LOG_ERROR("cannot switch on a value of type ", type->getName())
+
+            type = nullptr;
+        }
+
+        for (auto& caseNode : node->cases) {
+            auto statementCase = cast<NodeStatementCase>(caseNode);
+
+            if (type && statementCase->expression)
+                convert(statementCase->expression, type);
+
+            checkBody(statementCase->body);
+        }
+
+        return &Type::Void;
+    }
+
+    const Type* TypeChecker::visitStatementVariable(NodeStatementVariable* node) {
+        if (node->slot == Slot_Unresolved) {
+            LOG_ERROR("unknown variable: ", getSymbolTable().getName(node->identifier))
+
+            return nullptr;
+        }
+
+        const auto& types = node->isGlobal ? m_globalTypes : m_variableTypes;
+
+        // Null when the declaration itself had an error.
+        return node->slot < types.size() ? types[node->slot] : nullptr;
+    }
+
+    const Type* TypeChecker::visitStatementVariableDeclaration(NodeStatementVariableDeclaration* node) {
+        for (auto& variable : node->variables)
+            checkVariable(variable, !m_isInFunction);
+
+        return &Type::Void;
+    }
+
+    const Type* TypeChecker::visitStatementWhile(NodeStatementWhile* node) {
+        convert(node->condition, &Type::Boolean);
+        checkBody(node->body);
+
+        return &Type::Void;
+    }
+
+} /* Namespace Aryiele. */
@@ -28,7 +28,7 @@
 #include <Aryiele/AST/Variable.h>
 
 namespace Aryiele {
-    Variable::Variable(const std::string &identifier, const std::string &type, bool isConstant, std::shared_ptr<Node> expression) :
+    Variable::Variable(Symbol identifier, Symbol type, bool isConstant, Node* expression) :
         identifier(identifier), type(type), isConstant(isConstant), expression(expression) {
 
     }
@@ -29,31 +29,30 @@
 #include <llvm/Transforms/Utils/BasicBlockUtils.h>
 #include <Aryiele/CodeGenerator/CodeGenerator.h>
 #include <Aryiele/Parser/Parser.h>
+#include <Aryiele/AST/ConstantFolder.h>
+#include <Aryiele/AST/ReturnAnalysis.h>
 #include <Aryiele/AST/Nodes/Node.h>
-#include <Aryiele/AST/Nodes/NodeTopFile.h>
 #include <cfloat>
 
 namespace Aryiele {
     CodeGenerator::CodeGenerator(const std::string& filename) {
         m_module = std::make_shared<llvm::Module>(filename, m_context);
         m_dataLayout = std::make_shared<llvm::DataLayout>(m_module.get());
-        m_blockStack = std::make_shared<BlockStack>();
     }
     
-    void CodeGenerator::generateCode(std::shared_ptr<NodeRoot> nodeRoot) {
-        m_root = nodeRoot;
+    void CodeGenerator::generateCode(ASTContext& context, NodeRoot* nodeRoot) {
+        ReturnAnalysis::analyze(nodeRoot);
+        m_resolver.resolve(nodeRoot);
+        m_globals.assign(m_resolver.getGlobalCount(), nullptr);
         
-        for (auto& file : nodeRoot->body) {
-            auto fileNode = std::dynamic_pointer_cast<NodeTopFile>(file);
-            
-            for (auto& node : fileNode->body) {
-                if (node->getType() == Node_TopFunction) {
-                    auto function = std::dynamic_pointer_cast<NodeTopFunction>(node);
-                    
-                    if (!allPathsReturn(node)) {
-                        LOG_ERROR("in function '", function->identifier, "': ", "not all code paths return a value")
-                    }
-                }
+        const auto declarations = getDeclarations(nodeRoot);
+        
+        for (auto& node : declarations) {
+            if (node->getType() == Node_TopFunction) {
+                auto function = cast<NodeTopFunction>(node);
+                
+                if (function->lazyBody.empty())
+                    checkReturns(function);
             }
         }
         
@@ -67,131 +66,236 @@ namespace Aryiele {
         for (auto &Arg : function->args())
             Arg.setName("value");
         
-        m_blockStack->create();
+        m_functions[getSymbolTable().intern("print")] = function;
+        m_typeChecker.declareFunction(getSymbolTable().intern("print"), &Type::Int32, { &Type::Int32 });
         
-        for (auto& file : nodeRoot->body) {
-            auto fileNode = std::dynamic_pointer_cast<NodeTopFile>(file);
-            
-            for (auto& node : fileNode->body) {
+        // Nothing is generated from a tree with type errors. Folding comes after, so that the branches it drops
+        // were checked as the rest.
+        if (!m_typeChecker.check(context, nodeRoot))
+            return;
+        
+        foldConstants(context, nodeRoot);
+        
+        // The globals before the bodies, which can use any of them.
+        for (auto& node : declarations) {
+            if (node->getType() != Node_TopFunction)
                 generateCode(node);
+        }
+        
+        for (auto& node : declarations) {
+            if (node->getType() != Node_TopFunction)
+                continue;
+            
+            if (!cast<NodeTopFunction>(node)->lazyBody.empty()) {
+                m_lazyFunctions[cast<NodeTopFunction>(node)->identifier] = cast<NodeTopFunction>(node);
+                
+                continue;
             }
+            
+            generateCode(node);
         }
         
-        m_blockStack->escape();
+        findFunction(getSymbolTable().intern("main"));
+        
+        // Calls found while generating a body queue the functions they reach.
+        for (size_t i = 0; i < m_pendingFunctions.size(); i++) {
+            auto function = m_pendingFunctions[i];
+            const auto errorCount = ::Vanir::Logger::errorCount;
+            
+            getParser().parseLazyBody(context, function);
+            
+            if (::Vanir::Logger::errorCount != errorCount)
+                continue;
+            
+            ReturnAnalysis::analyze(function);
+            m_resolver.resolve(function);
+            
+            if (!m_typeChecker.check(context, function))
+                continue;
+            
+            checkReturns(function);
+            
+            foldConstants(context, function);
+            generateCode(function);
+        }
     }
     
     std::shared_ptr<llvm::Module> CodeGenerator::getModule() {
         return m_module;
     }
     
-    llvm::Type* CodeGenerator::getType(const std::string &type) {
-        if (type == "Int8") {
-            return llvm::Type::getInt8Ty(m_context);
-        } else if (type == "Int16" || type == "UInt8") {
-            return llvm::Type::getInt16Ty(m_context);
-        } else if (type == "Int32" || type == "UInt16") {
-            return llvm::Type::getInt32Ty(m_context);
-        } else if (type == "Int64" || type == "Int" || type == "UInt32") {
-            return llvm::Type::getInt64Ty(m_context);
-        } else if (type == "UInt64" || type == "UInt") {
-            return llvm::Type::getInt128Ty(m_context);
-        } else if (type == "Float") {
-            return llvm::Type::getFloatTy(m_context);
-        } else if (type == "Double") {
-            return llvm::Type::getDoubleTy(m_context);
-        } else if (type == "String" || type == "Character") {
-            return llvm::Type::getInt8PtrTy(m_context);
-        } else if (type == "Void") {
-            return llvm::Type::getVoidTy(m_context);
-        } else if (type == "Boolean") {
-            return llvm::Type::getIntNTy(m_context, 1);
+    size_t CodeGenerator::getEliminatedNodeCount() const {
+        return m_eliminatedNodeCount;
+    }
+    
+    void CodeGenerator::checkReturns(NodeTopFunction* node) {
+        if (!allPathsReturn(node)) {
+            LOG_ERROR("in function '", getSymbolTable().getName(node->identifier), "': ", "not all code paths return a value")
         }
+    }
+    
+    void CodeGenerator::foldConstants(ASTContext& context, Node* node) {
+        auto eliminatedCount = ConstantFolder().fold(context, node);
         
-        return nullptr;
+        // The returns were analyzed on the tree as written, for the errors, the blocks replacing ifs have no bits.
+        if (eliminatedCount != 0)
+            ReturnAnalysis::analyze(node);
+        
+        m_eliminatedNodeCount += eliminatedCount;
     }
     
-    llvm::Value *CodeGenerator::getTypeDefaultValue(llvm::Type* type) {
-        if (type->isIntegerTy(1)) {
-            return llvm::ConstantInt::get(m_context, llvm::APInt(1, 0));
-        } else if (type->isIntegerTy(8)) {
-            return llvm::ConstantInt::get(m_context, llvm::APInt(8, 0));
-        } else if (type->isIntegerTy(16)) {
-            return llvm::ConstantInt::get(m_context, llvm::APInt(16, 0));
-        } else if (type->isIntegerTy(32)) {
-            return llvm::ConstantInt::get(m_context, llvm::APInt(32, 0));
-        } else if (type->isIntegerTy(64)) {
-            return llvm::ConstantInt::get(m_context, llvm::APInt(64, 0));
-        } else if (type->isIntegerTy(128)) {
-            return llvm::ConstantInt::get(m_context, llvm::APInt(128, 0));
-        } else if (type->isFloatTy()) {
-            return llvm::ConstantFP::get(m_context, llvm::APFloat(0.0f));
-        } else if (type->isDoubleTy()) {
-            return llvm::ConstantFP::get(m_context, llvm::APFloat(0.0));
+    llvm::Type* CodeGenerator::getType(const Type* type) {
+        switch (type->kind) {
+            // The signedness is not part of the LLVM type, createOperation and the casts pick the instructions.
+            case Type_Integer:
+                return llvm::Type::getIntNTy(m_context, type->width);
+            case Type_Float:
+                return llvm::Type::getFloatTy(m_context);
+            case Type_Double:
+                return llvm::Type::getDoubleTy(m_context);
+            case Type_Boolean:
+                return llvm::Type::getInt1Ty(m_context);
+            case Type_String:
+            case Type_Character:
+                return llvm::Type::getInt8PtrTy(m_context);
+            case Type_Void:
+                return llvm::Type::getVoidTy(m_context);
+            default:
+                return nullptr;
         }
+    }
+    
+    llvm::Value *CodeGenerator::getTypeDefaultValue(const Type* type) {
+        if (type->kind == Type_Void)
+            return nullptr;
         
-        return nullptr;
+        return llvm::Constant::getNullValue(getType(type));
     }
     
-    llvm::Value *CodeGenerator::getTypeDefaultValue(const std::string &type) {
-        return getTypeDefaultValue(getType(type));
+    llvm::Value *CodeGenerator::getTypeDefaultStep(const Type* type) {
+        if (type->isInteger())
+            return llvm::ConstantInt::get(getType(type), 1);
+        else if (type->isFloating())
+            return llvm::ConstantFP::get(getType(type), 1.0);
+        
+        return nullptr;
     }
     
-    llvm::Value *CodeGenerator::getTypeDefaultStep(llvm::Type* type) {
-        if (type->isIntegerTy(8) ||
-            (type->isIntOrPtrTy() && type->getNumContainedTypes() > 0 &&
-             type->getContainedType(0)->isIntegerTy(8))) {
-            return llvm::ConstantInt::get(m_context, llvm::APInt(8, 1));
-        } else if (type->isIntegerTy(16) ||
-                  (type->isIntOrPtrTy() && type->getNumContainedTypes() > 0 &&
-                   type->getContainedType(0)->isIntegerTy(16))) {
-            return llvm::ConstantInt::get(m_context, llvm::APInt(16, 1));
-        } else if (type->isIntegerTy(32) ||
-                  (type->isIntOrPtrTy() && type->getNumContainedTypes() > 0 &&
-                   type->getContainedType(0)->isIntegerTy(32))) {
-            return llvm::ConstantInt::get(m_context, llvm::APInt(32, 1));
-        } else if (type->isIntegerTy(64) ||
-                  (type->isIntOrPtrTy() && type->getNumContainedTypes() > 0 &&
-                   type->getContainedType(0)->isIntegerTy(64))) {
-            return llvm::ConstantInt::get(m_context, llvm::APInt(64, 1));
-        } else if (type->isIntegerTy(128) ||
-                  (type->isIntOrPtrTy() && type->getNumContainedTypes() > 0 &&
-                   type->getContainedType(0)->isIntegerTy(128))) {
-            return llvm::ConstantInt::get(m_context, llvm::APInt(128, 1));
-        } else if (type->isFloatTy()) {
-            return llvm::ConstantFP::get(m_context, llvm::APFloat(1.0f));
-        } else if (type->isDoubleTy()) {
-            return llvm::ConstantFP::get(m_context, llvm::APFloat(1.0));
+    llvm::Value *CodeGenerator::createOperation(ParserTokenEnum operation, llvm::Value* lhs, llvm::Value* rhs,
+                                                const Type* type) {
+        if (type->isFloating()) {
+            switch (operation) {
+                case ParserToken_OperatorArithmeticPlus:
+                    return m_builder.CreateFAdd(lhs, rhs, "fadd");
+                case ParserToken_OperatorArithmeticMinus:
+                    return m_builder.CreateFSub(lhs, rhs, "fsub");
+                case ParserToken_OperatorArithmeticMultiply:
+                    return m_builder.CreateFMul(lhs, rhs, "fmul");
+                case ParserToken_OperatorArithmeticDivide:
+                    return m_builder.CreateFDiv(lhs, rhs, "fdiv");
+                case ParserToken_OperatorArithmeticRemainder:
+                    return m_builder.CreateFRem(lhs, rhs, "frem");
+                case ParserToken_OperatorComparisonLessThan:
+                    return m_builder.CreateFCmpOLT(lhs, rhs, "fcmpolt");
+                case ParserToken_OperatorComparisonLessThanOrEqual:
+                    return m_builder.CreateFCmpOLE(lhs, rhs, "fcmpole");
+                case ParserToken_OperatorComparisonGreaterThan:
+                    return m_builder.CreateFCmpOGT(lhs, rhs, "fcmpogt");
+                case ParserToken_OperatorComparisonGreaterThanOrEqual:
+                    return m_builder.CreateFCmpOGE(lhs, rhs, "fcmpoge");
+                case ParserToken_OperatorComparisonEqual:
+                    return m_builder.CreateFCmpOEQ(lhs, rhs, "fcmpoeq");
+                case ParserToken_OperatorComparisonNotEqual:
+                    return m_builder.CreateFCmpUNE(lhs, rhs, "fcmpune");
+                default:
+                    return nullptr;
+            }
         }
         
-        return nullptr;
+        switch (operation) {
+            case ParserToken_OperatorArithmeticPlus:
+                return m_builder.CreateAdd(lhs, rhs, "add");
+            case ParserToken_OperatorArithmeticMinus:
+                return m_builder.CreateSub(lhs, rhs, "sub");
+            case ParserToken_OperatorArithmeticMultiply:
+                return m_builder.CreateMul(lhs, rhs, "mul");
+            case ParserToken_OperatorArithmeticDivide:
+                return type->isSigned ? m_builder.CreateSDiv(lhs, rhs, "sdiv") : m_builder.CreateUDiv(lhs, rhs, "udiv");
+            case ParserToken_OperatorArithmeticRemainder:
+                return type->isSigned ? m_builder.CreateSRem(lhs, rhs, "srem") : m_builder.CreateURem(lhs, rhs, "urem");
+            case ParserToken_OperatorComparisonLessThan:
+                return type->isSigned ? m_builder.CreateICmpSLT(lhs, rhs, "icmpslt") :
+                    m_builder.CreateICmpULT(lhs, rhs, "icmpult");
+            case ParserToken_OperatorComparisonLessThanOrEqual:
+                return type->isSigned ? m_builder.CreateICmpSLE(lhs, rhs, "icmpsle") :
+                    m_builder.CreateICmpULE(lhs, rhs, "icmpule");
+            case ParserToken_OperatorComparisonGreaterThan:
+                return type->isSigned ? m_builder.CreateICmpSGT(lhs, rhs, "icmpsgt") :
+                    m_builder.CreateICmpUGT(lhs, rhs, "icmpugt");
+            case ParserToken_OperatorComparisonGreaterThanOrEqual:
+                return type->isSigned ? m_builder.CreateICmpSGE(lhs, rhs, "icmpsge") :
+                    m_builder.CreateICmpUGE(lhs, rhs, "icmpuge");
+            case ParserToken_OperatorComparisonEqual:
+                return m_builder.CreateICmpEQ(lhs, rhs, "icmpeq");
+            case ParserToken_OperatorComparisonNotEqual:
+                return m_builder.CreateICmpNE(lhs, rhs, "icmpne");
+            default:
+                return nullptr;
+        }
     }
     
-    llvm::Value *CodeGenerator::getTypeDefaultStep(const std::string &type) {
-        return getTypeDefaultStep(getType(type));
+    llvm::Function *CodeGenerator::findFunction(Symbol identifier) {
+        auto function = m_functions.find(identifier);
+        
+        if (function != m_functions.end())
+            return function->second;
+        
+        auto lazyFunction = m_lazyFunctions.find(identifier);
+        
+        if (lazyFunction == m_lazyFunctions.end())
+            return nullptr;
+        
+        auto node = lazyFunction->second;
+        
+        m_lazyFunctions.erase(lazyFunction);
+        m_pendingFunctions.emplace_back(node);
+        
+        return declareFunction(node);
     }
     
-    llvm::Value *CodeGenerator::castType(llvm::Value *value, llvm::Type *returnType, bool isSigned) {
-        if (value->getType()->isIntegerTy() && returnType->isIntegerTy()) {
-            return m_builder.CreateIntCast(value, returnType, isSigned);
-        } else if (value->getType()->isIntegerTy() && returnType->isIntOrPtrTy()) {
-            if (returnType->getContainedType(0)->isIntegerTy(8)) {
-                return m_builder.CreateIntCast(value, m_builder.getInt8Ty(), isSigned);
-            } else if (returnType->getContainedType(0)->isIntegerTy(16)) {
-                return m_builder.CreateIntCast(value, m_builder.getInt16Ty(), isSigned);
-            } else if (returnType->getContainedType(0)->isIntegerTy(32)) {
-                return m_builder.CreateIntCast(value, m_builder.getInt32Ty(), isSigned);
-            }
-            
-            return m_builder.CreateIntCast(value, m_builder.getInt64Ty(), isSigned);
-        } else if((value->getType()->isIntegerTy() && returnType->isDoubleTy()) ||
-                  (value->getType()->isIntegerTy() && returnType->isFloatTy())) {
-            return m_builder.CreateSIToFP(value, returnType);
-        } else if((value->getType()->isDoubleTy() && returnType->isIntegerTy()) ||
-                  (value->getType()->isFloatTy() && returnType->isIntegerTy())) {
-            return m_builder.CreateFPToSI(value, returnType);
+    llvm::Function *CodeGenerator::declareFunction(NodeTopFunction* node) {
+        std::vector<llvm::Type*> arguments;
+        
+        for (const auto &argument : node->arguments) {
+            arguments.emplace_back(getType(argument.valueType));
         }
         
-        return value;
+        llvm::FunctionType *functionType = llvm::FunctionType::get(getType(node->returnType), arguments, false);
+        llvm::Function *function = llvm::Function::Create(functionType, llvm::Function::ExternalLinkage,
+            getSymbolTable().getName(node->identifier), m_module.get());
+        
+        m_functions[node->identifier] = function;
+        
+        unsigned i = 0;
+        
+        for (auto &Arg : function->args())
+            Arg.setName(getSymbolTable().getName(node->arguments[i++].identifier));
+        
+        return function;
+    }
+    
+    llvm::AllocaInst *CodeGenerator::findVariable(NodeStatementVariable* node) {
+        if (node->isGlobal || node->slot == Slot_Unresolved)
+            return nullptr;
+        
+        return m_variables[node->slot];
+    }
+    
+    llvm::GlobalVariable *CodeGenerator::findGlobal(NodeStatementVariable* node) {
+        if (!node->isGlobal)
+            return nullptr;
+        
+        return m_globals[node->slot];
     }
     
     llvm::AllocaInst *CodeGenerator::createEntryBlockAllocation(
@@ -202,51 +306,11 @@ namespace Aryiele {
             type == nullptr ? llvm::Type::getInt32Ty(m_context) : type, nullptr, identifier);
     }
     
-    GenerationError CodeGenerator::generateCode(std::shared_ptr<Node> node) {
-        auto nodePtr = node.get();
-        
-        switch (node->getType()) {
-            case Node_TopFunction:
-                return generateCode((NodeTopFunction*)nodePtr);
-            case Node_LiteralNumberFloating:
-                return generateCode((NodeLiteralNumberFloating*)nodePtr);
-            case Node_LiteralNumberInteger:
-                return generateCode((NodeLiteralNumberInteger*)nodePtr);
-            case Node_OperationUnary:
-                return generateCode((NodeOperationUnary*)nodePtr);
-            case Node_OperationBinary:
-                return generateCode((NodeOperationBinary*)nodePtr);
-            case Node_OperationTernary:
-                return generateCode((NodeOperationTernary*)nodePtr);
-            case Node_StatementBlock:
-                return generateCode((NodeStatementBlock*)nodePtr);
-            case Node_StatementBreak:
-                return generateCode((NodeStatementBreak*)nodePtr);
-            case Node_StatementContinue:
-                return generateCode((NodeStatementContinue*)nodePtr);
-            case Node_StatementFor:
-                return generateCode((NodeStatementFor*)nodePtr);
-            case Node_StatementFunctionCall:
-                return generateCode((NodeStatementFunctionCall*)nodePtr);
-            case Node_StatementIf:
-                return generateCode((NodeStatementIf*)nodePtr);
-            case Node_StatementReturn:
-                return generateCode((NodeStatementReturn*)nodePtr);
-            case Node_StatementSwitch:
-                return generateCode((NodeStatementSwitch*)nodePtr);
-            case Node_StatementVariable:
-                return generateCode((NodeStatementVariable*)nodePtr);
-            case Node_StatementVariableDeclaration:
-                return generateCode((NodeStatementVariableDeclaration*)nodePtr);
-            case Node_StatementWhile:
-                return generateCode((NodeStatementWhile*)nodePtr);
-                
-            default:
-                return GenerationError();
-        }
+    GenerationError CodeGenerator::generateCode(Node* node) {
+        return visit(node);
     }
     
-    GenerationError CodeGenerator::generateCode(std::vector<std::shared_ptr<Node>> node) {
+    GenerationError CodeGenerator::generateCode(std::vector<Node*> node) {
         for (auto& statement: node) {
             generateCode(statement);
         }
@@ -254,33 +318,17 @@ namespace Aryiele {
         return GenerationError(true);
     }
     
-    GenerationError CodeGenerator::generateCode(NodeTopFunction* node) {
+    GenerationError CodeGenerator::visitTopFunction(NodeTopFunction* node) {
         m_isInFunction = true;
         
-        llvm::Function *function = m_module->getFunction(node->identifier);
+        m_assignmentAnalysis.analyze(node);
         
-        if (!function) {
-            std::vector<llvm::Type*> arguments;
-            llvm::Type* functionTypeValue;
-            
-            for (const auto &argument : node->arguments) {
-                arguments.emplace_back(getType(argument.type));
-            }
-            
-            functionTypeValue = getType(node->type);
-            
-            llvm::FunctionType *functionType = llvm::FunctionType::get(functionTypeValue, arguments, false);
-            
-            function = llvm::Function::Create(
-                functionType, llvm::Function::ExternalLinkage, node->identifier, m_module.get());
-            
-            unsigned i = 0;
-            
-            for (auto &Arg : function->args())
-                Arg.setName(node->arguments[i++].identifier);
-        }
+        llvm::Function *function = findFunction(node->identifier);
         
-        m_blockStack->create();
+        if (!function)
+            function = declareFunction(node);
+        
+        m_variables.assign(node->slotCount, nullptr);
         
         llvm::BasicBlock *basicBlock = llvm::BasicBlock::Create(m_context, "_start", function);
         
@@ -291,23 +339,24 @@ namespace Aryiele {
                 function, argument.getName(), argument.getType());
             
             m_builder.CreateStore(&argument, allocationInstance);
-            m_blockStack->addVariable(argument.getName(), allocationInstance, node, false);
+            m_variables[argument.getArgNo()] = allocationInstance;
         }
         
         for (auto& statement : node->body) {
             auto error = generateCode(statement);
             
             if (!error.success) {
+                // Later calls must not find the erased function.
+                m_functions.erase(node->identifier);
                 function->eraseFromParent();
+                m_isInFunction = false;
                 
-                LOG_ERROR("cannot generate the body of a function: ", node->identifier)
+                LOG_ERROR("cannot generate the body of a function: ", getSymbolTable().getName(node->identifier))
                 
                 return GenerationError();
             }
         }
         
-        m_blockStack->escape();
-        
         verifyFunction(*function);
     
         m_isInFunction = false;
@@ -315,141 +364,82 @@ namespace Aryiele {
         return GenerationError(true, function);
     }
     
-    GenerationError CodeGenerator::generateCode(NodeLiteralNumberFloating* node) {
-        if (node->value >= FLT_MIN && node->value <= FLT_MAX) {
-            return GenerationError(true, llvm::ConstantFP::get(
-                m_context, llvm::APFloat((float)node->value)));
-        } else if (node->value >= DBL_MIN && node->value <= DBL_MAX) {
-            return GenerationError(true, llvm::ConstantFP::get(
-                m_context, llvm::APFloat(node->value)));
-        }
-        
-        return GenerationError(false);
+    GenerationError CodeGenerator::visitLiteralBoolean(NodeLiteralBoolean* node) {
+        return GenerationError(true, llvm::ConstantInt::get(m_builder.getInt1Ty(), node->value));
     }
     
-    GenerationError CodeGenerator::generateCode(NodeLiteralNumberInteger* node) {
-        if (node->value >= CHAR_MIN && node->value <= CHAR_MAX) {
-            return GenerationError(true, llvm::ConstantInt::get(
-                m_builder.getInt8Ty(), node->value));
-        } else if (node->value >= SHRT_MIN && node->value <= SHRT_MAX) {
-            return GenerationError(true, llvm::ConstantInt::get(
-                m_builder.getInt16Ty(), node->value));
-        } else if (node->value >= INT_MIN && node->value <= INT_MAX) {
-            return GenerationError(true, llvm::ConstantInt::get(
-                m_builder.getInt32Ty(), node->value));
-        } else if (node->value >= LONG_MIN && node->value <= LONG_MAX) {
-            return GenerationError(true, llvm::ConstantInt::get(
-                m_builder.getInt64Ty(), node->value));
-        }
-        
-        return GenerationError(false);
+    GenerationError CodeGenerator::visitLiteralNumberFloating(NodeLiteralNumberFloating* node) {
+        return GenerationError(true, llvm::ConstantFP::get(getType(node->valueType), node->value));
     }
     
-    GenerationError CodeGenerator::generateCode(NodeOperationUnary* node) {
-        if (node->expression->getType() == Node_StatementVariable) {
-            auto statement = std::dynamic_pointer_cast<NodeStatementVariable>(node->expression);
-            auto variable = m_blockStack->findVariable(statement->identifier);
+    GenerationError CodeGenerator::visitLiteralNumberInteger(NodeLiteralNumberInteger* node) {
+        return GenerationError(true, llvm::ConstantInt::get(getType(node->valueType), node->value, true));
+    }
+    
+    GenerationError CodeGenerator::visitOperationUnary(NodeOperationUnary* node) {
+        if ((node->operationType == ParserToken_OperatorUnaryArithmeticIncrement ||
+             node->operationType == ParserToken_OperatorUnaryArithmeticDecrement) &&
+            node->expression->getType() == Node_StatementVariable) {
+            auto statement = cast<NodeStatementVariable>(node->expression);
+            auto variable = findVariable(statement);
             llvm::GlobalVariable* global = nullptr;
     
             if (!variable) {
-                global = m_module->getNamedGlobal(statement->identifier);
+                global = findGlobal(statement);
         
                 if (!global) {
-                    LOG_ERROR(
-                        "cannot generate a binary operation: lhs: unknown variable '" + statement->identifier + "'")
+                    LOG_ERROR("cannot generate a binary operation: lhs: unknown variable '",
+                        getSymbolTable().getName(statement->identifier), "'")
             
                     return GenerationError();
                 }
             }
     
-            if ((variable &&variable->isConstant && isVariableSet(
-                    statement->identifier, variable->initializationNode, node, false)) ||
-                (global && global->isConstant() && isVariableSet(
-                    statement->identifier, nullptr, node, true))) {
+            if ((variable && m_assignmentAnalysis.isReassignment(node)) ||
+                (global && global->isConstant())) {
                 LOG_ERROR("cannot redefine a constant")
         
                 return GenerationError();
             }
         }
         
-        if ((!node->left && node->operationType == ParserToken_OperatorUnaryArithmeticIncrement) ||
-            (!node->left && node->operationType == ParserToken_OperatorUnaryArithmeticDecrement)) {
+        if (node->operationType == ParserToken_OperatorUnaryArithmeticIncrement ||
+            node->operationType == ParserToken_OperatorUnaryArithmeticDecrement) {
             auto lhsValue = generateCode(node->expression);
             
-            llvm::AllocaInst* alloca = createEntryBlockAllocation(m_builder.GetInsertBlock()->getParent(),
-                node->operationType == ParserToken_OperatorUnaryArithmeticIncrement ? "inc" : "dec");
-            auto returnValue = m_builder.CreateStore(castType(lhsValue.value, alloca->getType()), alloca);
+            if (!lhsValue.success)
+                return GenerationError();
+            
+            auto operation = createOperation(
+                node->operationType == ParserToken_OperatorUnaryArithmeticIncrement ?
+                    ParserToken_OperatorArithmeticPlus : ParserToken_OperatorArithmeticMinus,
+                lhsValue.value, getTypeDefaultStep(node->valueType), node->valueType);
             
             if (node->expression->getType() == Node_StatementVariable) {
-                llvm::Value* operation = nullptr;
-                
-                if (node->operationType == ParserToken_OperatorUnaryArithmeticIncrement) {
-                    operation = m_builder.CreateAdd(lhsValue.value, getTypeDefaultStep(lhsValue.value->getType()),
-                        "add");
-                } else {
-                    operation = m_builder.CreateSub(lhsValue.value, getTypeDefaultStep(lhsValue.value->getType()),
-                        "sub");
-                }
-                
-                auto variable = m_blockStack->findVariable(
-                    std::dynamic_pointer_cast<NodeStatementVariable>(node->expression)->identifier);
-                llvm::GlobalVariable *global = nullptr;
-                
-                if (!variable) {
-                    global = m_module->getNamedGlobal(
-                        std::dynamic_pointer_cast<NodeStatementVariable>(node->expression)->identifier);
-                }
+                auto variable = findVariable(cast<NodeStatementVariable>(node->expression));
                 
                 if (variable) {
-                    m_builder.CreateStore(operation, variable->instance);
+                    m_builder.CreateStore(operation, variable);
                 } else {
-                    m_builder.CreateStore(operation, global);
+                    m_builder.CreateStore(operation, findGlobal(cast<NodeStatementVariable>(node->expression)));
                 }
             }
             
-            return GenerationError(true, returnValue->getValueOperand());
-        } else if (node->operationType == ParserToken_OperatorUnaryArithmeticIncrement ||
-                   node->operationType == ParserToken_OperatorUnaryArithmeticDecrement) {
-            auto lhsValue = generateCode(node->expression);
-            llvm::Value* operation = nullptr;
-            
-            if (node->operationType == ParserToken_OperatorUnaryArithmeticIncrement) {
-                operation = m_builder.CreateAdd(lhsValue.value, getTypeDefaultStep(lhsValue.value->getType()),
-                    "add");
-            } else {
-                operation = m_builder.CreateSub(lhsValue.value, getTypeDefaultStep(lhsValue.value->getType()),
-                    "sub");
-            }
-    
-            auto variable = m_blockStack->findVariable(
-                std::dynamic_pointer_cast<NodeStatementVariable>(node->expression)->identifier);
-            llvm::GlobalVariable *global = nullptr;
-    
-            if (!variable) {
-                global = m_module->getNamedGlobal(
-                    std::dynamic_pointer_cast<NodeStatementVariable>(node->expression)->identifier);
-            }
-    
-            if (variable) {
-                m_builder.CreateStore(operation, variable->instance);
-            } else {
-                m_builder.CreateStore(operation, global);
-            }
-            
-            return GenerationError(true, operation);
+            // The operator on the right gives the value from before.
+            return GenerationError(true, node->left ? operation : lhsValue.value);
         }
         
         return GenerationError(false);
     }
     
-    GenerationError CodeGenerator::generateCode(NodeOperationBinary* node) {
+    GenerationError CodeGenerator::visitOperationBinary(NodeOperationBinary* node) {
         if (node->operationType == ParserToken_OperatorEqual ||
             node->operationType == ParserToken_OperatorArithmeticPlusEqual ||
             node->operationType == ParserToken_OperatorArithmeticMinusEqual ||
             node->operationType == ParserToken_OperatorArithmeticMultiplyEqual ||
             node->operationType == ParserToken_OperatorArithmeticDivideEqual ||
             node->operationType == ParserToken_OperatorArithmeticRemainderEqual) {
-            auto lhs = std::static_pointer_cast<NodeStatementVariable>(node->lhs);
+            auto lhs = cast<NodeStatementVariable>(node->lhs);
             
             if (!lhs) {
                 LOG_ERROR("cannot generate a binary operation: lhs: expecting a variable")
@@ -457,23 +447,22 @@ namespace Aryiele {
                 return GenerationError();
             }
     
-            auto variable = m_blockStack->findVariable(lhs->identifier);
+            auto variable = findVariable(lhs);
             llvm::GlobalVariable* global = nullptr;
             
             if (!variable) {
-                global = m_module->getNamedGlobal(lhs->identifier);
+                global = findGlobal(lhs);
                 
                 if (!global) {
-                    LOG_ERROR("cannot generate a binary operation: lhs: unknown variable '" + lhs->identifier + "'")
+                    LOG_ERROR("cannot generate a binary operation: lhs: unknown variable '",
+                        getSymbolTable().getName(lhs->identifier), "'")
     
                     return GenerationError();
                 }
             }
             
-            if ((variable && variable->isConstant &&
-                 isVariableSet(lhs->identifier, variable->initializationNode, node, false)) ||
-                (global && global->isConstant() &&
-                 isVariableSet(lhs->identifier, nullptr, node, true))) {
+            if ((variable && m_assignmentAnalysis.isReassignment(node)) ||
+                (global && global->isConstant())) {
                 LOG_ERROR("cannot redefine a constant")
                 
                 return GenerationError();
@@ -489,37 +478,38 @@ namespace Aryiele {
             
             if (node->operationType == ParserToken_OperatorEqual) {
                 if (variable) {
-                    m_builder.CreateStore(
-                        castType(rhsValue.value, variable->instance->getType()), variable->instance);
+                    m_builder.CreateStore(rhsValue.value, variable);
                 } else {
-                    m_builder.CreateStore(castType(rhsValue.value, global->getType()), global);
+                    m_builder.CreateStore(rhsValue.value, global);
                 }
             } else {
                 llvm::Value* load = nullptr;
-                llvm::Value* result = nullptr;
+                ParserTokenEnum operation;
                 
                 if (variable) {
-                    load = m_builder.CreateLoad(variable->instance, lhs->identifier.c_str());
+                    load = m_builder.CreateLoad(variable, getSymbolTable().getName(lhs->identifier));
                 } else {
-                    load = m_builder.CreateLoad(global, lhs->identifier.c_str());
+                    load = m_builder.CreateLoad(global, getSymbolTable().getName(lhs->identifier));
                 }
                 
                 if (node->operationType == ParserToken_OperatorArithmeticPlusEqual) {
-                    result = m_builder.CreateAdd(load, castType(rhsValue.value, load->getType()), "add");
+                    operation = ParserToken_OperatorArithmeticPlus;
                 } else if (node->operationType == ParserToken_OperatorArithmeticMinusEqual) {
-                    result = m_builder.CreateSub(load, castType(rhsValue.value, load->getType()), "sub");
+                    operation = ParserToken_OperatorArithmeticMinus;
                 } else if (node->operationType == ParserToken_OperatorArithmeticMultiplyEqual) {
-                    result = m_builder.CreateMul(load, castType(rhsValue.value, load->getType()), "mul");
+                    operation = ParserToken_OperatorArithmeticMultiply;
                 } else if (node->operationType == ParserToken_OperatorArithmeticDivideEqual) {
-                    result = m_builder.CreateSDiv(load, castType(rhsValue.value, load->getType()), "div");
-                } else if (node->operationType == ParserToken_OperatorArithmeticRemainderEqual) {
-                    result = m_builder.CreateURem(load, castType(rhsValue.value, load->getType()), "urem");
+                    operation = ParserToken_OperatorArithmeticDivide;
+                } else {
+                    operation = ParserToken_OperatorArithmeticRemainder;
                 }
+                
+                auto result = createOperation(operation, load, rhsValue.value, lhs->valueType);
     
                 if (variable) {
-                    m_builder.CreateStore(castType(result, variable->instance->getType()), variable->instance);
+                    m_builder.CreateStore(result, variable);
                 } else {
-                    m_builder.CreateStore(castType(result, global->getType()), global);
+                    m_builder.CreateStore(result, global);
                 }
             }
             
@@ -532,57 +522,19 @@ namespace Aryiele {
         if (!lhsValue.success || !rhsValue.success)
             return GenerationError();
         
-        llvm::Value *value = nullptr;
+        // The type checker converted the rhs to the type of the lhs, or the other way around.
+        auto value = createOperation(node->operationType, lhsValue.value, rhsValue.value, node->lhs->valueType);
         
-        if (lhsValue.value->getType() != rhsValue.value->getType()) {
-            rhsValue.value = castType(rhsValue.value, lhsValue.value->getType());
-        }
-        
-        switch (node->operationType) {
-            case ParserToken_OperatorArithmeticPlus:
-                value = m_builder.CreateAdd(lhsValue.value, rhsValue.value, "add");
-                break;
-            case ParserToken_OperatorArithmeticMinus:
-                value = m_builder.CreateSub(lhsValue.value, rhsValue.value, "sub");
-                break;
-            case ParserToken_OperatorArithmeticMultiply:
-                value = m_builder.CreateMul(lhsValue.value, rhsValue.value, "mul");
-                break;
-            case ParserToken_OperatorArithmeticDivide:
-                value = m_builder.CreateSDiv(lhsValue.value, rhsValue.value, "sdiv");
-                break;
-            case ParserToken_OperatorArithmeticRemainder:
-                value = m_builder.CreateURem(lhsValue.value, rhsValue.value, "urem");
-                break;
-            case ParserToken_OperatorComparisonLessThan:
-                value = m_builder.CreateICmpULT(lhsValue.value, rhsValue.value, "icmpult");
-                break;
-            case ParserToken_OperatorComparisonLessThanOrEqual:
-                value = m_builder.CreateICmpULE(lhsValue.value, rhsValue.value, "icmpule");
-                break;
-            case ParserToken_OperatorComparisonGreaterThan:
-                value = m_builder.CreateICmpUGT(lhsValue.value, rhsValue.value, "icmpugt");
-                break;
-            case ParserToken_OperatorComparisonGreaterThanOrEqual:
-                value = m_builder.CreateICmpUGE(lhsValue.value, rhsValue.value, "icmpuge");
-                break;
-            case ParserToken_OperatorComparisonEqual:
-                value = m_builder.CreateICmpEQ(lhsValue.value, rhsValue.value, "icmpeq");
-                break;
-            case ParserToken_OperatorComparisonNotEqual:
-                value = m_builder.CreateICmpNE(lhsValue.value, rhsValue.value, "icmpeq");
-                break;
-            default: {
-                LOG_ERROR("unknown binary operator: ", ParserToken::getTypeName(node->operationType))
-                
-                return GenerationError();
-            }
+        if (!value) {
+            LOG_ERROR("unknown binary operator: ", ParserToken::getTypeName(node->operationType))
+            
+            return GenerationError();
         }
         
         return GenerationError(true, value);
     }
     
-    GenerationError CodeGenerator::generateCode(NodeOperationTernary *node) {
+    GenerationError CodeGenerator::visitOperationTernary(NodeOperationTernary *node) {
         auto entryBlock = m_builder.GetInsertBlock();
         auto ternaryBasicBlock = llvm::BasicBlock::Create(
             m_context, "_ternary_start", m_builder.GetInsertBlock()->getParent());
@@ -608,9 +560,7 @@ namespace Aryiele {
                 m_context, "_ternary_end", m_builder.GetInsertBlock()->getParent());
             
             alloca = createEntryBlockAllocation(
-                m_builder.GetInsertBlock()->getParent(), "v_ternary_temp");
-            m_builder.CreateStore(castType(
-                getTypeDefaultValue("Boolean"), alloca->getType()), alloca);
+                m_builder.GetInsertBlock()->getParent(), "v_ternary_temp", getType(node->valueType));
         }
         
         m_builder.CreateCondBr(condition.value, leftBasicBlock, rightBasicBlock);
@@ -624,7 +574,7 @@ namespace Aryiele {
         }
         
         if (!allPathsReturn(node->lhs)) {
-            m_builder.CreateStore(castType(left, alloca->getType()), alloca);
+            m_builder.CreateStore(left, alloca);
             
             m_builder.CreateBr(endBasicBlock);
         }
@@ -637,7 +587,7 @@ namespace Aryiele {
         }
         
         if (!allPathsReturn(node->rhs)) {
-            m_builder.CreateStore(castType(right, alloca->getType()), alloca);
+            m_builder.CreateStore(right, alloca);
             
             m_builder.CreateBr(endBasicBlock);
         }
@@ -655,9 +605,39 @@ namespace Aryiele {
         return GenerationError(true, ternaryVariable);
     }
     
-    GenerationError CodeGenerator::generateCode(NodeStatementBlock *node) {
-        m_blockStack->create();
+    GenerationError CodeGenerator::visitOperationCast(NodeOperationCast* node) {
+        auto error = generateCode(node->expression);
         
+        if (!error.success)
+            return GenerationError();
+        
+        auto from = node->expression->valueType;
+        auto to = node->valueType;
+        auto type = getType(to);
+        
+        if (to->kind == Type_Boolean) {
+            if (from->isFloating()) {
+                return GenerationError(true, m_builder.CreateFCmpUNE(
+                    error.value, llvm::ConstantFP::get(error.value->getType(), 0.0), "tobool"));
+            }
+            
+            return GenerationError(true, m_builder.CreateICmpNE(
+                error.value, llvm::ConstantInt::get(error.value->getType(), 0), "tobool"));
+        } else if (from->isFloating() && to->isFloating()) {
+            return GenerationError(true, m_builder.CreateFPCast(error.value, type, "fpcast"));
+        } else if (from->isFloating()) {
+            return GenerationError(true, to->isSigned ? m_builder.CreateFPToSI(error.value, type, "fptosi") :
+                m_builder.CreateFPToUI(error.value, type, "fptoui"));
+        } else if (to->isFloating()) {
+            return GenerationError(true, from->isSigned ? m_builder.CreateSIToFP(error.value, type, "sitofp") :
+                m_builder.CreateUIToFP(error.value, type, "uitofp"));
+        }
+        
+        // Widening sign-extends a signed value and zero-extends an unsigned one, true becomes one.
+        return GenerationError(true, m_builder.CreateIntCast(error.value, type, from->isSigned, "cast"));
+    }
+    
+    GenerationError CodeGenerator::visitStatementBlock(NodeStatementBlock *node) {
         for (auto &statement : node->body) {
             auto error = generateCode(statement);
             
@@ -666,12 +646,10 @@ namespace Aryiele {
             }
         }
         
-        m_blockStack->escape();
-        
         return GenerationError(true);
     }
     
-    GenerationError CodeGenerator::generateCode(NodeStatementBreak *node) {
+    GenerationError CodeGenerator::visitStatementBreak(NodeStatementBreak *node) {
         if (m_breakList.empty()) {
             LOG_ERROR("no break possible")
             
@@ -683,7 +661,7 @@ namespace Aryiele {
         return GenerationError(true);
     }
     
-    GenerationError CodeGenerator::generateCode(NodeStatementContinue *node) {
+    GenerationError CodeGenerator::visitStatementContinue(NodeStatementContinue *node) {
         if (m_breakList.empty()) {
             LOG_ERROR("no continue possible")
         
@@ -695,7 +673,7 @@ namespace Aryiele {
         return GenerationError(true);
     }
     
-    GenerationError CodeGenerator::generateCode(NodeStatementFor *node) {
+    GenerationError CodeGenerator::visitStatementFor(NodeStatementFor *node) {
         if (node->body.empty()) {
             return GenerationError(true);
         }
@@ -716,41 +694,37 @@ namespace Aryiele {
             m_breakList.emplace_back(endForBasicBlock);
         }
         
-        m_blockStack->create();
-        
         m_builder.CreateBr(forBasicBlock);
         m_builder.SetInsertPoint(forBasicBlock);
         
         llvm::AllocaInst* alloca = nullptr;
-        llvm::Value* startValue = nullptr;
+        const Type* variableType = nullptr;
         
         if (node->variable && node->variable->getType() == Node_StatementVariableDeclaration) {
-            auto var = std::dynamic_pointer_cast<NodeStatementVariableDeclaration>(node->variable);
+            auto var = cast<NodeStatementVariableDeclaration>(node->variable);
             
-            alloca = createEntryBlockAllocation(
-                m_builder.GetInsertBlock()->getParent(), var->variables[0]->identifier);
-            startValue = generateCode(var->variables[0]->expression).value;
-            m_builder.CreateStore(castType(startValue, alloca->getType()), alloca);
+            variableType = var->variables[0]->valueType;
+            alloca = createEntryBlockAllocation(m_builder.GetInsertBlock()->getParent(),
+                getSymbolTable().getName(var->variables[0]->identifier), getType(variableType));
+            m_builder.CreateStore(generateCode(var->variables[0]->expression).value, alloca);
+        } else if (node->variable) {
+            variableType = node->variable->valueType;
         }
         
         m_builder.CreateBr(forConditionBasicBlock);
         m_builder.SetInsertPoint(forConditionBasicBlock);
         
         if (node->variable && node->variable->getType() == Node_StatementVariableDeclaration) {
-            auto var = std::dynamic_pointer_cast<NodeStatementVariableDeclaration>(node->variable);
-            m_blockStack->addVariable(
-                var->variables[0]->identifier, alloca, node->variable.get(), false);
+            auto var = cast<NodeStatementVariableDeclaration>(node->variable);
+            m_variables[var->variables[0]->slot] = alloca;
         }
         
         llvm::Value* stepValue = nullptr;
         
         if (node->incrementalValue) {
             stepValue = generateCode(node->incrementalValue).value;
-        } else if (node->variable && node->variable->getType() == Node_StatementVariableDeclaration) {
-            stepValue = getTypeDefaultStep(startValue->getType());
         } else if (node->variable) {
-            stepValue = getTypeDefaultStep(m_blockStack->findVariable(
-                std::dynamic_pointer_cast<NodeStatementVariable>(node->variable)->identifier)->instance->getType());
+            stepValue = getTypeDefaultStep(variableType);
         }
         
         auto endCondition = generateCode(node->condition).value;
@@ -772,24 +746,22 @@ namespace Aryiele {
                 m_builder.CreateBr(stepForBasicBlock);
                 m_builder.SetInsertPoint(stepForBasicBlock);
                 
-                std::string identifier;
+                Symbol identifier;
                 
                 if (node->variable->getType() == Node_StatementVariableDeclaration) {
-                    identifier = std::dynamic_pointer_cast<NodeStatementVariableDeclaration>(
+                    identifier = cast<NodeStatementVariableDeclaration>(
                         node->variable)->variables[0]->identifier;
-                    auto currentVar = m_builder.CreateLoad(alloca, identifier);
-                    auto nextVar = m_builder.CreateAdd(
-                        currentVar, castType(stepValue, currentVar->getType()), "v_for_next");
+                    auto currentVar = m_builder.CreateLoad(alloca, getSymbolTable().getName(identifier));
+                    auto nextVar = createOperation(
+                        ParserToken_OperatorArithmeticPlus, currentVar, stepValue, variableType);
                     m_builder.CreateStore(nextVar, alloca);
                 } else {
-                    identifier = std::dynamic_pointer_cast<NodeStatementVariable>(node->variable)->identifier;
-                    auto currentVar = m_builder.CreateLoad(m_blockStack->findVariable(
-                        std::dynamic_pointer_cast<NodeStatementVariable>(node->variable)->identifier)->instance,
-                            identifier);
-                    auto nextVar = m_builder.CreateAdd(
-                        currentVar, castType(stepValue, currentVar->getType()), "v_for_next");
-                    m_builder.CreateStore(nextVar, m_blockStack->findVariable(
-                        std::dynamic_pointer_cast<NodeStatementVariable>(node->variable)->identifier)->instance);
+                    identifier = cast<NodeStatementVariable>(node->variable)->identifier;
+                    auto currentVar = m_builder.CreateLoad(findVariable(cast<NodeStatementVariable>(node->variable)),
+                            getSymbolTable().getName(identifier));
+                    auto nextVar = createOperation(
+                        ParserToken_OperatorArithmeticPlus, currentVar, stepValue, variableType);
+                    m_builder.CreateStore(nextVar, findVariable(cast<NodeStatementVariable>(node->variable)));
                 }
             }
             
@@ -798,8 +770,6 @@ namespace Aryiele {
         
         m_builder.SetInsertPoint(endForBasicBlock);
         
-        m_blockStack->escape();
-        
         if (!allPathsReturn(node->body)) {
             m_continueList.pop_back();
             m_breakList.pop_back();
@@ -808,11 +778,11 @@ namespace Aryiele {
         return GenerationError(true);
     }
     
-    GenerationError CodeGenerator::generateCode(NodeStatementFunctionCall* node) {
-        llvm::Function *calledFunction = m_module->getFunction(node->identifier);
+    GenerationError CodeGenerator::visitStatementFunctionCall(NodeStatementFunctionCall* node) {
+        llvm::Function *calledFunction = findFunction(node->identifier);
         
         if (!calledFunction) {
-            LOG_ERROR("unknown function referenced: ", node->identifier)
+            LOG_ERROR("unknown function referenced: ", getSymbolTable().getName(node->identifier))
             
             return GenerationError();
         }
@@ -833,10 +803,6 @@ namespace Aryiele {
                 return GenerationError();
             }
             
-            if (error.value->getType() != calledFunction->getArg(i)->getType()) {
-                error.value = castType(error.value, calledFunction->getArg(i)->getType());
-            }
-            
             argumentsValues.push_back(error.value);
         }
         
@@ -849,7 +815,7 @@ namespace Aryiele {
             true, m_builder.CreateCall(calledFunction, argumentsValues, "call"));
     }
     
-    GenerationError CodeGenerator::generateCode(NodeStatementIf* node) {
+    GenerationError CodeGenerator::visitStatementIf(NodeStatementIf* node) {
         auto conditionValue = generateCode(node->condition);
         
         if (!conditionValue.success)
@@ -874,8 +840,6 @@ namespace Aryiele {
             conditionValue.value, ifBasicBlock, !node->elseBody.empty() ? elseBasicBlock : mergeBasicBlock);
         
         m_builder.SetInsertPoint(ifBasicBlock);
-        m_blockStack->create();
-        
         for (auto &statement : node->ifBody) {
             auto generatedCode = generateCode(statement);
             
@@ -883,16 +847,12 @@ namespace Aryiele {
                 return GenerationError();
         }
         
-        m_blockStack->escape();
-        
         if (!allPathsReturn(node->ifBody)) {
             m_builder.CreateBr(mergeBasicBlock);
         }
         
         if (elseBasicBlock) {
             m_builder.SetInsertPoint(elseBasicBlock);
-            m_blockStack->create();
-            
             for (auto &statement : node->elseBody) {
                 auto generatedCode = generateCode(statement);
                 
@@ -900,8 +860,6 @@ namespace Aryiele {
                     return GenerationError();
             }
             
-            m_blockStack->escape();
-            
             if (!allPathsReturn(node->elseBody)) {
                 m_builder.CreateBr(mergeBasicBlock);
             }
@@ -916,7 +874,7 @@ namespace Aryiele {
         return GenerationError(true);
     }
     
-    GenerationError CodeGenerator::generateCode(NodeStatementReturn* node) {
+    GenerationError CodeGenerator::visitStatementReturn(NodeStatementReturn* node) {
         if (node->expression == nullptr) {
             m_builder.CreateRetVoid();
             
@@ -931,17 +889,12 @@ namespace Aryiele {
             return GenerationError();
         }
         
-        if (error.value->getType() != m_builder.getCurrentFunctionReturnType()) {
-            error.value = castType(error.value, m_builder.getCurrentFunctionReturnType(), true);
-        }
-        
-        m_builder.CreateRet(
-            castType(error.value, m_builder.GetInsertBlock()->getParent()->getReturnType()));
+        m_builder.CreateRet(error.value);
         
         return GenerationError(true, error.value);
     }
     
-    GenerationError CodeGenerator::generateCode(NodeStatementSwitch *node) {
+    GenerationError CodeGenerator::visitStatementSwitch(NodeStatementSwitch *node) {
         if (node->cases.empty()) {
             return GenerationError(true);
         }
@@ -959,38 +912,38 @@ namespace Aryiele {
         
         auto switchInst = m_builder.CreateSwitch(expressionValue.value, switchDefault, node->cases.size());
         
-        m_blockStack->create();
-        
         m_builder.SetInsertPoint(switchDefault);
         
         if (node->hasDefault()) {
-            for (auto& statement : std::dynamic_pointer_cast<NodeStatementCase>(node->cases[0])->body) {
+            for (auto& statement : cast<NodeStatementCase>(node->cases[0])->body) {
                 generateCode(statement);
             }
             
-            if (!allPathsReturn(std::dynamic_pointer_cast<NodeStatementCase>(node->cases[0])->body)) {
+            if (!allPathsReturn(cast<NodeStatementCase>(node->cases[0])->body)) {
                 m_builder.CreateBr(switchEnd);
             }
         } else {
             m_builder.CreateBr(switchEnd);
         }
         
-        m_blockStack->escape();
-        
         for (int i = node->hasDefault() ? 1 : 0; i < node->cases.size(); i++) {
-            auto caseNode = std::dynamic_pointer_cast<NodeStatementCase>(node->cases[i]);
-            
-            m_blockStack->create();
+            auto caseNode = cast<NodeStatementCase>(node->cases[i]);
             
             if (!allPathsReturn(caseNode->body)) {
                 m_breakList.emplace_back(switchEnd);
             }
             
             auto switchCase = llvm::BasicBlock::Create(m_context, "_switch_case", function);
-            auto conditionValue = generateCode(caseNode->expression);
+            auto conditionValue = llvm::dyn_cast_or_null<llvm::ConstantInt>(
+                generateCode(caseNode->expression).value);
+            
+            if (!conditionValue) {
+                LOG_ERROR("cannot generate a case: expecting a constant value")
+                
+                return GenerationError();
+            }
             
-            switchInst->addCase(llvm::dyn_cast<llvm::ConstantInt>(
-                castType(conditionValue.value, expressionValue.value->getType())), switchCase);
+            switchInst->addCase(conditionValue, switchCase);
             
             m_builder.SetInsertPoint(switchCase);
             
@@ -1003,8 +956,6 @@ namespace Aryiele {
     
                 m_breakList.pop_back();
             }
-            
-            m_blockStack->escape();
         }
         
         if (switchEnd) {
@@ -1016,23 +967,23 @@ namespace Aryiele {
         return GenerationError(true);
     }
     
-    GenerationError CodeGenerator::generateCode(NodeStatementVariable* node) {
-        auto value = m_blockStack->findVariable(node->identifier);
+    GenerationError CodeGenerator::visitStatementVariable(NodeStatementVariable* node) {
+        auto value = findVariable(node);
         
         if (!value) {
-            auto gValue = m_module->getNamedGlobal(node->identifier);
+            auto gValue = findGlobal(node);
             
             if (!gValue) {
-                LOG_ERROR("unknown variable: ", node->identifier)
+                LOG_ERROR("unknown variable: ", getSymbolTable().getName(node->identifier))
             }
     
-            return GenerationError(true, m_builder.CreateLoad(gValue, node->identifier.c_str()));
+            return GenerationError(true, m_builder.CreateLoad(gValue, getSymbolTable().getName(node->identifier)));
         }
         
-        return GenerationError(true, m_builder.CreateLoad(value->instance, node->identifier.c_str()));
+        return GenerationError(true, m_builder.CreateLoad(value, getSymbolTable().getName(node->identifier)));
     }
     
-    GenerationError CodeGenerator::generateCode(NodeStatementVariableDeclaration *node) {
+    GenerationError CodeGenerator::visitStatementVariableDeclaration(NodeStatementVariableDeclaration *node) {
         if (m_isInFunction) {
             llvm::Function *function = m_builder.GetInsertBlock()->getParent();
             for (auto &variable : node->variables) {
@@ -1048,16 +999,17 @@ namespace Aryiele {
                     }
                 }
                 else if (!variable->isConstant) {
-                    error.value = getTypeDefaultValue(variable->type);
+                    error.value = getTypeDefaultValue(variable->valueType);
                 }
         
-                llvm::AllocaInst *allocationInstance = createEntryBlockAllocation(function, variable->identifier);
+                llvm::AllocaInst *allocationInstance = createEntryBlockAllocation(
+                    function, getSymbolTable().getName(variable->identifier), getType(variable->valueType));
         
                 if (error.value) {
-                    m_builder.CreateStore(castType(error.value, allocationInstance->getType()), allocationInstance);
+                    m_builder.CreateStore(error.value, allocationInstance);
                 }
         
-                m_blockStack->addVariable(variable->identifier, allocationInstance, node, variable->isConstant);
+                m_variables[variable->slot] = allocationInstance;
             }
         } else {
             for (auto &variable : node->variables) {
@@ -1073,17 +1025,28 @@ namespace Aryiele {
                     }
                 }
                 else if (!variable->isConstant) {
-                    error.value = getTypeDefaultValue(variable->type);
+                    error.value = getTypeDefaultValue(variable->valueType);
                 }
         
                 if (error.value) {
-                    m_module->getOrInsertGlobal(variable->identifier,
-                        !variable->type.empty() ? getType(variable->type) : error.value->getType());
+                    const auto& identifier = getSymbolTable().getName(variable->identifier);
+                    auto initializer = llvm::dyn_cast<llvm::Constant>(error.value);
+                    
+                    // Nothing is declared (nor kept in m_globals) for a global that cannot be generated.
+                    if (!initializer) {
+                        LOG_ERROR("cannot generate declaration of a global variable: expecting a constant value: ",
+                            identifier)
+                        
+                        return GenerationError();
+                    }
+                    
+                    m_module->getOrInsertGlobal(identifier, getType(variable->valueType));
                     
-                    m_module->getNamedGlobal(variable->identifier)->setInitializer(
-                        llvm::dyn_cast<llvm::ConstantInt>(!variable->type.empty() ? castType(
-                            error.value, getType(variable->type)) : error.value));
-                    m_module->getNamedGlobal(variable->identifier)->setConstant(variable->isConstant);
+                    auto global = m_module->getNamedGlobal(identifier);
+                    
+                    global->setInitializer(initializer);
+                    global->setConstant(variable->isConstant);
+                    m_globals[variable->slot] = global;
                 }
             }
         }
@@ -1091,7 +1054,7 @@ namespace Aryiele {
         return GenerationError(true);
     }
     
-    GenerationError CodeGenerator::generateCode(NodeStatementWhile *node) {
+    GenerationError CodeGenerator::visitStatementWhile(NodeStatementWhile *node) {
         if (node->body.empty()) {
             return GenerationError(true);
         }
@@ -1119,8 +1082,6 @@ namespace Aryiele {
             m_breakList.emplace_back(whileEndBasicBlock);
         }
         
-        m_blockStack->create();
-        
         if (node->doOnce) {
             m_builder.CreateBr(whileDoBasicBlock);
             m_builder.SetInsertPoint(whileDoBasicBlock);
@@ -1153,8 +1114,6 @@ namespace Aryiele {
         
         m_builder.SetInsertPoint(whileEndBasicBlock);
         
-        m_blockStack->escape();
-        
         if (!allPathsReturn(node->body)) {
             m_continueList.pop_back();
             m_breakList.pop_back();
@@ -1163,236 +1122,12 @@ namespace Aryiele {
         return GenerationError(true);
     }
     
-    bool CodeGenerator::isVariableSet(
-        const std::string &identifier, Node *startPosition, Node *breakPosition, bool global) {
-        
-        if (global) {
-            startPosition = m_root->children[0]->children[0].get();
-        }
-        if (!startPosition) {
-            return false;
-        }
-        
-        //LOG("================================================================")
-        //LOG("breakPosition: ", breakPosition, " - ", breakPosition->getTypeName())
-        //LOG("----------------")
-        
-        auto parent = startPosition->parent;
-        auto positionInParent = startPosition->getPositionInParent();
-        
-        for (int i = positionInParent; i < parent->children.size(); i++) {
-            auto currentPosition = parent->children[i].get();
-            
-            if (!currentPosition) {
-                continue;
-            }
-            
-            //LOG(i, ": currentPosition: ", currentPosition, " - ", currentPosition->getTypeName())
-            
-            if (parent->getType() == Node_StatementIf) {
-                auto parentNode = (NodeStatementIf*)(parent.get());
-                
-                bool inIf = false;
-                bool inElse = false;
-                
-                for (auto& statement : parentNode->ifBody) {
-                    if (statement && (statement.get() == breakPosition || statement->contains(breakPosition))) {
-                        inIf = true;
-                    }
-                }
-                
-                for (auto& statement : parentNode->elseBody) {
-                    if (statement && (statement.get() == breakPosition || statement->contains(breakPosition))) {
-                        inElse = true;
-                    }
-                }
-                
-                if ((inIf && std::find(parentNode->ifBody.begin(),
-                                       parentNode->ifBody.end(), parentNode->children[i]) == parentNode->ifBody.end()) ||
-                    (inElse && std::find(parentNode->elseBody.begin(),
-                                         parentNode->elseBody.end(), parentNode->children[i]) == parentNode->elseBody.end())) {
-                    break;
-                }
-            } else if (parent->getType() == Node_StatementSwitch) {
-                auto parentNode = (NodeStatementSwitch*)(parent.get());
-                
-                bool inCase = false;
-                int caseNumber = 0;
-                
-                for (auto& caseNode : parentNode->cases) {
-                    auto caseNodePtr = (NodeStatementCase*)(parent.get());
-                    
-                    for (auto& statement : caseNodePtr->body) {
-                        if (statement && (statement.get() == breakPosition || statement->contains(breakPosition))) {
-                            inCase = true;
-                            break;
-                        }
-                    }
-                    
-                    if (inCase) {
-                        break;
-                    }
-                    
-                    caseNumber++;
-                }
-                
-                if (inCase && i == caseNumber + 1) {
-                    break;
-                }
-            }
-            
-            if (currentPosition == breakPosition) {
-                break;
-            } else if (currentPosition->getType() == Node_StatementVariableDeclaration) {
-                auto currentNode = (NodeStatementVariableDeclaration*)currentPosition;
-                
-                for (auto& variable : currentNode->variables) {
-                    if (variable->identifier == identifier && variable->expression) {
-                        return true;
-                    }
-                }
-            } else if (currentPosition->getType() == Node_OperationBinary) {
-                auto currentNode = (NodeOperationBinary*)currentPosition;
-                
-                if ((currentNode->operationType == ParserToken_OperatorEqual ||
-                     currentNode->operationType == ParserToken_OperatorArithmeticPlusEqual ||
-                     currentNode->operationType == ParserToken_OperatorArithmeticMinusEqual ||
-                     currentNode->operationType == ParserToken_OperatorArithmeticMultiplyEqual ||
-                     currentNode->operationType == ParserToken_OperatorArithmeticDivideEqual ||
-                     currentNode->operationType == ParserToken_OperatorArithmeticRemainderEqual) &&
-                    ((NodeStatementVariable*)(currentNode->lhs.get()))->identifier == identifier) {
-                    return true;
-                }
-            } else if (currentPosition->getType() == Node_OperationUnary) {
-                auto currentNode = (NodeOperationUnary*)currentPosition;
-                
-                if ((currentNode->operationType == ParserToken_OperatorUnaryArithmeticIncrement ||
-                     currentNode->operationType == ParserToken_OperatorUnaryArithmeticDecrement) &&
-                    ((NodeStatementVariable*)(currentNode->expression.get()))->identifier == identifier) {
-                    return true;
-                }
-            } else if (currentPosition->getType() == Node_StatementIf) {
-                auto currentNode = (NodeStatementIf*)currentPosition;
-                
-                if (currentNode->children.size() > 1 &&
-                    isVariableSet(identifier, currentNode->children[1].get(), breakPosition, global)) {
-                    return true;
-                }
-            } else if (currentPosition->getType() == Node_StatementSwitch) {
-                auto currentNode = (NodeStatementSwitch*)currentPosition;
-                
-                if (currentNode->children.size() > 1 &&
-                    isVariableSet(identifier, currentNode->children[1].get(), breakPosition, global)) {
-                    return true;
-                }
-            } else if (currentPosition->getType() == Node_StatementFor) {
-                auto currentNode = (NodeStatementFor*)currentPosition;
-                
-                if (currentNode->children.size() > 3 &&
-                    isVariableSet(identifier, currentNode->children[3].get(), breakPosition, global)) {
-                    return true;
-                }
-            } else if (currentPosition->getType() == Node_StatementWhile) {
-                auto currentNode = (NodeStatementWhile*)currentPosition;
-                
-                if (currentNode->children.size() > 1 &&
-                    isVariableSet(identifier, currentNode->children[1].get(), breakPosition, global)) {
-                    return true;
-                }
-            } else if (global && currentPosition->getType() == Node_TopFunction) {
-                auto currentNode = (NodeTopFunction*)currentPosition;
-                
-                if (isVariableSet(identifier, currentNode->children[0].get(), breakPosition, global)) {
-                    return true;
-                }
-            } else if (!currentPosition->children.empty() && isVariableSet(identifier,
-                currentPosition->children[0].get(), breakPosition, global)) {
-                return true;
-            }
-        }
-        
-        return false;
-    }
-    
     bool CodeGenerator::allPathsReturn(Node* node) {
-        if (node->getType() == Node_TopFunction) {
-            auto functionNode = (NodeTopFunction*)node;
-            
-            if (functionNode->type == "Void" || allPathsReturn(functionNode->body)) {
-                return true;
-            }
-        } else if (node->getType() == Node_StatementIf) {
-            auto ifNode = (NodeStatementIf*)node;
-            
-            bool ifReturns = false;
-            bool elseReturns = false;
-            
-            if (allPathsReturn(ifNode->ifBody)) {
-                ifReturns = true;
-            }
-            
-            if (allPathsReturn(ifNode->elseBody)) {
-                elseReturns = true;
-            }
-            
-            if (ifReturns && elseReturns) {
-                return true;
-            }
-        } else if (node->getType() == Node_StatementFor) {
-            auto forNode = (NodeStatementFor*)node;
-            
-            if (allPathsReturn(forNode->body)) {
-                return true;
-            }
-        } else if (node->getType() == Node_StatementWhile) {
-            auto whileNode = (NodeStatementWhile*)node;
-            
-            if (allPathsReturn(whileNode->body)) {
-                return true;
-            }
-        } else if (node->getType() == Node_StatementSwitch) {
-            auto switchNode = (NodeStatementSwitch*)node;
-            
-            bool allCasesReturns = true;
-            
-            for (auto& caseNode : switchNode->cases) {
-                auto casePtr = std::dynamic_pointer_cast<NodeStatementCase>(caseNode);
-                
-                if (!allPathsReturn(casePtr->body)) {
-                    allCasesReturns = false;
-                }
-            }
-            
-            if (allCasesReturns && switchNode->hasDefault()) {
-                return true;
-            }
-        } else if (node->getType() == Node_OperationTernary) {
-            auto ternaryNode = (NodeOperationTernary*)node;
-            
-            if (allPathsReturn(ternaryNode->lhs) && allPathsReturn(ternaryNode->rhs)) {
-                return true;
-            }
-        } else if (node->getType() == Node_StatementContinue || node->getType() == Node_StatementBreak) {
-            return false;
-        } else if (node->getType() == Node_StatementReturn) {
-            return true;
-        }
-        
-        return false;
-    }
-    
-    bool CodeGenerator::allPathsReturn(std::shared_ptr<Node> node) {
-        return allPathsReturn(node.get());
+        return node->isReturning;
     }
     
-    bool CodeGenerator::allPathsReturn(std::vector<std::shared_ptr<Node>> nodes) {
-        for (auto& statement : nodes) {
-            if (allPathsReturn(statement)) {
-                return true;
-            }
-        }
-        
-        return false;
+    bool CodeGenerator::allPathsReturn(const std::vector<Node*>& nodes) {
+        return ReturnAnalysis::isReturning(nodes);
     }
     
     CodeGenerator &getCodeGenerator() {
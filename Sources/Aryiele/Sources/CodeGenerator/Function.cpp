@@ -28,10 +28,9 @@
 #include <Aryiele/CodeGenerator/Function.h>
 
 namespace Aryiele {
-    Function::Function(const std::string &identifier, llvm::Type *returnType,
-                       std::vector<std::shared_ptr<FunctionArgument>> arguments,
-                       std::shared_ptr<BlockStack> blocks) :
-        identifier(identifier), returnType(returnType), arguments(arguments), blocks(blocks) {
+    Function::Function(Symbol identifier, llvm::Type *returnType,
+                       std::vector<std::shared_ptr<FunctionArgument>> arguments) :
+        identifier(identifier), returnType(returnType), arguments(arguments) {
 
     }
 
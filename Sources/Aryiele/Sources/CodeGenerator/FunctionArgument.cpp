@@ -28,7 +28,7 @@
 #include <Aryiele/CodeGenerator/FunctionArgument.h>
 
 namespace Aryiele {
-    FunctionArgument::FunctionArgument(const std::string &identifier, llvm::Type *type) :
+    FunctionArgument::FunctionArgument(Symbol identifier, llvm::Type *type) :
         identifier(identifier), type(type) {
 
     }
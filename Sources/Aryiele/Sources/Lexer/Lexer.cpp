@@ -25,22 +25,67 @@
 //                                                                                  //
 //==================================================================================//
 
+#include <algorithm>
+#include <charconv>
+#include <limits>
+#include <thread>
 #include <Aryiele/Lexer/Lexer.h>
+#include <Aryiele/Lexer/LexerScanner.h>
 #include <Aryiele/Lexer/LexerTable.h>
+#include <Aryiele/Parser/ParserSpelling.h>
 
 namespace Aryiele {
-    std::vector<LexerToken> Lexer::lex(const std::string& filepath) {
-        std::ifstream file;
-        std::string expression;
+    namespace {
+        // Below this many bytes per chunk, starting a thread costs more than lexing the chunk.
+        const size_t ParallelChunkMinimumSize = 64 * 1024;
 
-        file.open(filepath.c_str());
+        // Replace vector[first, last) by replacement, moving the elements after it only once.
+        template<typename T>
+        void replaceRange(std::vector<T>& vector, size_t first, size_t last, const std::vector<T>& replacement) {
+            const auto count = std::min(last - first, replacement.size());
 
-        if (file.fail())
-            return m_tokens;
+            if (replacement.size() > last - first)
+                vector.insert(vector.begin() + last, replacement.begin() + count, replacement.end());
+            else
+                vector.erase(vector.begin() + first + count, vector.begin() + last);
 
-        while (getline(file, expression)) {
-            stateMachine(expression);
-            m_tokens.emplace_back(LexerToken("", LexerToken_Newline));
+            std::copy(replacement.begin(), replacement.begin() + count, vector.begin() + first);
+        }
+    }
+
+    std::vector<ParserToken> Lexer::lex(const std::string& filepath, LexerMode mode) {
+        if (!open(filepath))
+            return std::move(m_tokens);
+
+        const auto source = m_source->getView();
+
+        if (mode == LexerMode_SinglePass) {
+            // Roughly one token every six characters once spaces are trivia, avoid growing the vector while scanning.
+            m_tokens.reserve(source.size() / 6 + 1);
+
+            while (lexLine()) {}
+
+            return std::move(m_tokens);
+        }
+
+        if (mode == LexerMode_Parallel) {
+            lexParallel();
+
+            return std::move(m_tokens);
+        }
+
+        m_lexerTokens.clear();
+
+        for (size_t lineStart = 0; lineStart < source.size();) {
+            auto lineEnd = source.find('\n', lineStart);
+
+            if (lineEnd == std::string_view::npos)
+                lineEnd = source.size();
+
+            stateMachine(source.substr(lineStart, lineEnd - lineStart));
+            m_lexerTokens.emplace_back(LexerToken("", LexerToken_Newline));
+
+            lineStart = lineEnd + 1;
         }
 
         stateComments();
@@ -49,16 +94,691 @@ namespace Aryiele {
         stateSpaces();
         stateOperators();
         stateIdentifiers();
+        stateClassify(source);
+
+        return std::move(m_tokens);
+    }
+
+    void Lexer::setThreadCount(size_t threadCount) {
+        m_threadCount = threadCount;
+    }
+
+    std::string_view Lexer::getContent(const ParserToken& token) const {
+        if (token.type == ParserToken_Identifier)
+            return getSymbolTable().getName(token.symbol);
+
+        auto storage = token.storage;
+
+        if (token.type == ParserToken_LiteralValueInteger || token.type == ParserToken_LiteralValueDecimal)
+            storage = m_literals[token.literal].storage;
+        else if (token.type == ParserToken_Newline)
+            storage = 0;
+
+        if (storage != 0)
+            return m_rewrittenContents[storage - 1];
+
+        return m_source->getView().substr(token.offset, token.length);
+    }
+
+    int64_t Lexer::getInteger(const ParserToken& token) const {
+        return m_literals[token.literal].integer;
+    }
+
+    bool Lexer::isUnsignedInteger(const ParserToken& token) const {
+        return m_literals[token.literal].isUnsigned;
+    }
+
+    double Lexer::getDecimal(const ParserToken& token) const {
+        return m_literals[token.literal].decimal;
+    }
+
+    const std::vector<LexerTrivia>& Lexer::getTrivia() const {
+        return m_trivia;
+    }
+
+    std::shared_ptr<SourceBuffer> Lexer::getSource() {
+        return m_source;
+    }
+
+    bool Lexer::open(const std::string& filepath, bool isTriviaKept) {
+        m_tokens.clear();
+        m_trivia.clear();
+        m_storage.clear();
+        m_rewrittenContents.clear();
+        m_literals.clear();
+        m_tokenBase = 0;
+        m_position = 0;
+        m_textStart = 0;
+        m_commentStart = 0;
+        m_text.clear();
+        m_textQuote = 0;
+        m_isInText = false;
+        m_isTextCopied = false;
+        m_isInCommentMultiLine = false;
+        m_isTriviaKept = isTriviaKept;
+        m_lastTokenAllowUnary = true;
+        m_isOperandExpected = true;
+        m_source = std::make_shared<SourceBuffer>();
+
+        const auto isOpened = m_source->open(filepath);
+
+        m_end = m_source->getSize();
+
+        return isOpened;
+    }
+
+    bool Lexer::lexLine() {
+        const auto source = m_source->getView();
+        const auto size = source.size();
+
+        if (m_position >= m_end)
+            return false;
+
+        auto isInCommentMultiLine = m_isInCommentMultiLine;
+        auto isInText = m_isInText;
+        auto isTextCopied = m_isTextCopied;
+        auto inTextQuote = m_textQuote;
+        auto textStart = m_textStart;
+        auto commentStart = m_commentStart;
+        auto currentText = std::move(m_text);
+        auto x = m_position;
+
+        const auto isOperatorCharacter = [&](size_t position) {
+            return position < size && getTransitionTableColumn(source[position]) == LexerToken_Operator;
+        };
+
+        // A number absorbs the dots and digit runs following it ('1.5', '1..2').
+        const auto readNumber = [&](size_t position) {
+            position = LexerScanner::skipWordCharacters(source, position);
+
+            while (position < size) {
+                if (source[position] == '.') {
+                    ++position;
+                } else if (getTransitionTableColumn(source[position]) == LexerToken_Number) {
+                    position = LexerScanner::skipWordCharacters(source, position);
+                } else {
+                    break;
+                }
+            }
+
+            return position;
+        };
+
+        while (x < size && source[x] != '\n') {
+            const auto currentCharacter = source[x];
+            const auto column = getTransitionTableColumn(currentCharacter);
+
+            if (isInText) {
+                // Literals are views into the source unless an escape or a line break forces a copy.
+                if (currentCharacter == inTextQuote) {
+                    const auto isEscaped = isTextCopied ? !currentText.empty() && currentText.back() == '\\' :
+                        x > textStart && source[x - 1] == '\\';
+
+                    if (isEscaped) {
+                        if (!isTextCopied) {
+                            currentText.assign(source.substr(textStart, x - textStart));
+                            isTextCopied = true;
+                        }
+
+                        currentText.back() = inTextQuote;
+                    } else {
+                        const auto content = isTextCopied ? keepContent(std::move(currentText)) :
+                            source.substr(textStart, x - textStart);
+
+                        addToken(textStart, content, content.size() == 1 ? LexerToken_Character : LexerToken_String,
+                            content != ")" && content != "++" && content != "--");
+
+                        isInText = false;
+                        isTextCopied = false;
+                        currentText.clear();
+                    }
+                } else if (isTextCopied) {
+                    currentText += currentCharacter;
+                }
+
+                ++x;
+            } else if (isInCommentMultiLine) {
+                if (column == LexerToken_Operator) {
+                    auto end = x;
+
+                    while (isOperatorCharacter(end))
+                        ++end;
+
+                    if (end - x == 2 && source[x] == '*' && source[x + 1] == '/') {
+                        addTrivia(commentStart, end - commentStart);
+                        m_lastTokenAllowUnary = true;
+                        isInCommentMultiLine = false;
+                    }
+
+                    x = end;
+                } else {
+                    x = LexerScanner::skipCommentText(source, x + 1);
+                }
+            } else if (column == LexerToken_Space) {
+                const auto end = LexerScanner::skipSpaces(source, x);
+
+                addTrivia(x, end - x);
+                m_lastTokenAllowUnary = true;
+                x = end;
+            } else if (column == LexerToken_StringQuote) {
+                isInText = true;
+                inTextQuote = currentCharacter;
+                textStart = ++x;
+            } else if (column == LexerToken_Number) {
+                const auto end = readNumber(x);
+
+                addToken(x, source.substr(x, end - x), LexerToken_Number, false);
+                x = end;
+            } else if (column == LexerToken_Identifier) {
+                auto end = LexerScanner::skipWordCharacters(source, x);
+
+                // Dotted identifiers ('Namespace.function'), a '...' ends the name.
+                while (end < size) {
+                    if (source[end] == '.' && source[end - 1] != '.') {
+                        if (end + 2 < size && source[end + 1] == '.' && source[end + 2] == '.')
+                            break;
+
+                        ++end;
+                    } else if (source[end - 1] == '.' &&
+                               getTransitionTableColumn(source[end]) == LexerToken_Identifier) {
+                        end = LexerScanner::skipWordCharacters(source, end);
+                    } else {
+                        break;
+                    }
+                }
+
+                addToken(x, source.substr(x, end - x), LexerToken_Identifier, source[end - 1] == '.');
+                x = end;
+            } else if (currentCharacter == '.') {
+                auto end = x;
+
+                while (end < size && source[end] == '.')
+                    ++end;
+
+                auto position = x;
+
+                for (auto i = (end - x) / 3; i > 0; i--, position += 3)
+                    addToken(position, source.substr(position, 3), LexerToken_Separator, true);
+
+                for (auto i = (end - x) % 3; i > 0; i--, position++)
+                    addToken(position, source.substr(position, 1), LexerToken_Separator, true);
+
+                x = end;
+            } else if (column == LexerToken_Separator) {
+                addToken(x, source.substr(x, 1), LexerToken_Separator, currentCharacter != ')');
+                ++x;
+            } else if (column == LexerToken_Operator) {
+                auto end = x;
+
+                while (isOperatorCharacter(end))
+                    ++end;
+
+                const auto length = end - x;
+
+                if (length == 2 && source[x] == '/' && source[x + 1] == '/') {
+                    end = LexerScanner::skipLine(source, end);
+
+                    addTrivia(x, end - x);
+                } else if (length == 2 && source[x] == '/' && source[x + 1] == '*') {
+                    isInCommentMultiLine = true;
+                    commentStart = x;
+                } else if (length == 1 && currentCharacter == '-' && m_lastTokenAllowUnary &&
+                           end < size && getTransitionTableColumn(source[end]) == LexerToken_Number) {
+                    end = readNumber(end);
+
+                    addToken(x, source.substr(x, end - x), LexerToken_Number, false);
+                } else {
+                    const auto isIncrement = length == 2 && source[x] == source[x + 1] &&
+                        (currentCharacter == '+' || currentCharacter == '-');
+
+                    addToken(x, source.substr(x, length), LexerToken_Operator, !isIncrement);
+                }
+
+                x = end;
+            } else {
+                addToken(x, source.substr(x, 1), LexerToken_Unknown, true);
+                ++x;
+            }
+        }
+
+        if (isInCommentMultiLine) {
+            addTrivia(commentStart, x - commentStart);
+            commentStart = x + 1;
+        }
+
+        if (!isInText) {
+            addToken(x, source.substr(x, 0), LexerToken_Newline, true);
+
+            m_tokens.back().lineState = (isInCommentMultiLine ? LexerLineState_CommentMultiLine : 0) |
+                (m_isOperandExpected ? LexerLineState_OperandExpected : 0);
+        } else if (!isTextCopied) {
+            // Line breaks are dropped from literals, so the literal can no longer be a view.
+            currentText.assign(source.substr(textStart, x - textStart));
+            isTextCopied = true;
+        }
+
+        if (x < size)
+            ++x;
+
+        m_isInCommentMultiLine = isInCommentMultiLine;
+        m_isInText = isInText;
+        m_isTextCopied = isTextCopied;
+        m_textQuote = inTextQuote;
+        m_textStart = textStart;
+        m_commentStart = commentStart;
+        m_text = std::move(currentText);
+        m_position = x;
+
+        return true;
+    }
+
+    void Lexer::lexParallel() {
+        const auto size = m_source->getSize();
+        auto threadCount = m_threadCount != 0 ? m_threadCount : std::thread::hardware_concurrency();
+
+        threadCount = std::max<size_t>(std::min<size_t>(threadCount, size / ParallelChunkMinimumSize), 1);
+
+        // Chunks start right after a line break, so only comments and strings spanning lines cross them.
+        std::vector<size_t> bounds { 0 };
+
+        for (size_t i = 1; i < threadCount; i++) {
+            const auto lineEnd = m_source->getView().find('\n', std::max(bounds.back(), size * i / threadCount));
+
+            if (lineEnd == std::string_view::npos || lineEnd + 1 >= size)
+                break;
+
+            bounds.push_back(lineEnd + 1);
+        }
+
+        bounds.push_back(size);
+
+        // The first chunk is lexed here for real, the others from a clean state on their own thread.
+        std::vector<Lexer> chunks(bounds.size() - 2);
+        std::vector<std::thread> threads;
+
+        for (size_t i = 0; i < chunks.size(); i++) {
+            chunks[i].openChunk(*this, bounds[i + 1], bounds[i + 2]);
+            threads.emplace_back([&chunk = chunks[i]] { while (chunk.lexLine()) {} });
+        }
+
+        m_tokens.reserve(size / 6 + 1);
+        m_end = bounds[1];
+
+        while (lexLine()) {}
+
+        for (auto& thread : threads)
+            thread.join();
+
+        // A chunk starting inside a comment or a string was lexed from the wrong state, it is lexed again here.
+        for (size_t i = 0; i < chunks.size(); i++) {
+            m_end = bounds[i + 2];
+
+            if (m_isInCommentMultiLine || m_isInText) {
+                while (lexLine()) {}
+            } else {
+                mergeChunk(chunks[i]);
+            }
+        }
+    }
 
-        return m_tokens;
+    void Lexer::openChunk(const Lexer& parent, size_t begin, size_t end) {
+        m_source = parent.m_source;
+        m_isTriviaKept = parent.m_isTriviaKept;
+        m_position = begin;
+        m_commentStart = begin;
+        m_end = end;
+        m_chunkSymbols = std::make_unique<SymbolTable>();
+        m_hasOperandState = false;
+        m_tokens.reserve((end - begin) / 6 + 1);
     }
 
-    void Lexer::stateMachine(std::string expression) {
+    void Lexer::mergeChunk(Lexer& chunk) {
+        const auto tokenBase = static_cast<uint32_t>(m_tokenBase + m_tokens.size());
+        const auto storageBase = static_cast<uint32_t>(m_rewrittenContents.size());
+        const auto literalBase = static_cast<uint32_t>(m_literals.size());
+
+        // Interning the names in their order of appearance gives the same symbols as a sequential lex.
+        std::vector<Symbol> symbols(chunk.m_chunkSymbols->getSize());
+
+        for (Symbol symbol = 0; symbol < symbols.size(); symbol++) {
+            symbols[symbol] = symbol < Symbol_Predefined ? symbol :
+                getSymbolTable().intern(chunk.m_chunkSymbols->getName(symbol));
+        }
+
+        for (auto content : chunk.m_rewrittenContents)
+            m_rewrittenContents.push_back(keepContent(std::string(content)));
+
+        for (auto literal : chunk.m_literals) {
+            if (literal.storage != 0)
+                literal.storage += storageBase;
+
+            m_literals.push_back(literal);
+        }
+
+        for (auto& error : chunk.m_chunkErrors)
+            reportError(error.first, std::move(error.second));
+
+        // The chunk supposed a '+' or '-' on its first token to be unary.
+        if (!m_isOperandExpected && chunk.m_firstOperandToken != std::string_view::npos) {
+            auto& token = chunk.m_tokens[chunk.m_firstOperandToken];
+
+            token.type = token.type == ParserToken_OperatorUnaryArithmeticPlus ? ParserToken_OperatorArithmeticPlus :
+                ParserToken_OperatorArithmeticMinus;
+        }
+
+        const auto operandStateToken = chunk.m_hasOperandState ? chunk.m_operandStateToken : chunk.m_tokens.size();
+
+        for (size_t i = 0; i < chunk.m_tokens.size(); i++) {
+            auto token = chunk.m_tokens[i];
+
+            if (token.type == ParserToken_Newline) {
+                if (i < operandStateToken) {
+                    token.lineState = (token.lineState & ~LexerLineState_OperandExpected) |
+                        (m_isOperandExpected ? LexerLineState_OperandExpected : 0);
+                }
+            } else if (token.type == ParserToken_Identifier) {
+                token.symbol = symbols[token.symbol];
+            } else if (token.type == ParserToken_LiteralValueInteger || token.type == ParserToken_LiteralValueDecimal) {
+                token.literal += literalBase;
+            } else if (token.storage != 0) {
+                token.storage += storageBase;
+            }
+
+            m_tokens.push_back(token);
+        }
+
+        for (auto trivia : chunk.m_trivia) {
+            trivia.token += tokenBase;
+            m_trivia.push_back(trivia);
+        }
+
+        if (chunk.m_hasOperandState)
+            m_isOperandExpected = chunk.m_isOperandExpected;
+
+        m_position = chunk.m_position;
+        m_textStart = chunk.m_textStart;
+        m_commentStart = chunk.m_commentStart;
+        m_text = std::move(chunk.m_text);
+        m_textQuote = chunk.m_textQuote;
+        m_isInText = chunk.m_isInText;
+        m_isTextCopied = chunk.m_isTextCopied;
+        m_isInCommentMultiLine = chunk.m_isInCommentMultiLine;
+        m_lastTokenAllowUnary = chunk.m_lastTokenAllowUnary;
+    }
+
+    void Lexer::decodeNumber(ParserToken& token, size_t offset, std::string_view content) {
+        LexerLiteral literal {};
+        auto digits = content;
+        const auto isNegative = !digits.empty() && digits[0] == '-';
+        std::string separatedDigits;
+
+        if (isNegative)
+            digits.remove_prefix(1);
+
+        if (digits.find('_') != std::string_view::npos) {
+            separatedDigits.reserve(digits.size());
+
+            for (auto character : digits) {
+                if (character != '_')
+                    separatedDigits += character;
+            }
+
+            digits = separatedDigits;
+        }
+
+        const auto end = digits.data() + digits.size();
+
+        if (token.type == ParserToken_LiteralValueDecimal) {
+            const auto result = std::from_chars(digits.data(), end, literal.decimal);
+
+            if (result.ec == std::errc::result_out_of_range)
+                reportError(offset, "floating-point literal '" + std::string(content) + "' is out of range");
+            else if (result.ec != std::errc() || result.ptr != end)
+                reportError(offset, "invalid floating-point literal '" + std::string(content) + "'");
+
+            if (isNegative)
+                literal.decimal = -literal.decimal;
+        } else {
+            auto base = 10;
+
+            if (digits.size() > 2 && digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X')) {
+                base = 16;
+                digits.remove_prefix(2);
+            } else if (digits.size() > 2 && digits[0] == '0' && (digits[1] == 'b' || digits[1] == 'B')) {
+                base = 2;
+                digits.remove_prefix(2);
+            }
+
+            uint64_t magnitude = 0;
+            const auto result = std::from_chars(digits.data(), end, magnitude, base);
+            const auto signedMaximum = static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+            const auto maximum = isNegative ? signedMaximum + 1 : std::numeric_limits<uint64_t>::max();
+
+            if (result.ec == std::errc::result_out_of_range || magnitude > maximum) {
+                reportError(offset, "integer literal '" + std::string(content) + "' does not fit in 64 bits");
+                magnitude = 0;
+            } else if (result.ec != std::errc() || result.ptr != end) {
+                reportError(offset, "invalid integer literal '" + std::string(content) + "'");
+            }
+
+            literal.integer = static_cast<int64_t>(isNegative ? 0 - magnitude : magnitude);
+            literal.isUnsigned = !isNegative && magnitude > signedMaximum;
+        }
+
+        token.literal = static_cast<uint32_t>(m_literals.size());
+        m_literals.push_back(literal);
+    }
+
+    void Lexer::reportError(size_t offset, std::string message) {
+        if (m_chunkSymbols) {
+            m_chunkErrors.emplace_back(offset, std::move(message));
+            return;
+        }
+
+        const auto position = m_source->getPosition(offset);
+
+        LOG_ERROR(position.line, ":", position.column, " lexer: ", message)
+    }
+
+    void Lexer::addToken(size_t offset, std::string_view content, LexerTokenEnum type, bool allowUnary) {
+        classifyToken(offset, content, type);
+
+        m_lastTokenAllowUnary = allowUnary;
+    }
+
+    void Lexer::addTrivia(size_t offset, size_t length) {
+        if (length == 0 || !m_isTriviaKept)
+            return;
+
+        const auto token = static_cast<uint32_t>(m_tokenBase + m_tokens.size());
+
+        // Spaces and the comment following them make a single run.
+        if (!m_trivia.empty() && m_trivia.back().token == token &&
+            m_trivia.back().offset + m_trivia.back().length == offset) {
+            m_trivia.back().length += static_cast<uint32_t>(length);
+        } else {
+            m_trivia.push_back({ static_cast<uint32_t>(offset), static_cast<uint32_t>(length), token });
+        }
+    }
+
+    void Lexer::takeTokens(std::vector<ParserToken>& tokens) {
+        m_tokenBase += m_tokens.size();
+
+        tokens.swap(m_tokens);
+        m_tokens.clear();
+    }
+
+    SourceEditDamage Lexer::relex(std::vector<ParserToken>& tokens, const SourceEdit& edit) {
+        const auto delta = static_cast<int64_t>(edit.insertedText.size()) - static_cast<int64_t>(edit.removedLength);
+        const auto isBefore = [](const ParserToken& token, int64_t offset) { return token.offset < offset; };
+        auto first = static_cast<size_t>(std::lower_bound(tokens.begin(), tokens.end(),
+            static_cast<int64_t>(edit.offset), isBefore) - tokens.begin());
+
+        // Restart after the last line break before the edit, in the state recorded on it.
+        while (first > 0 && tokens[first - 1].type != ParserToken_Newline)
+            --first;
+
+        const auto restart = first > 0 ? tokens[first - 1].offset + size_t(1) : size_t(0);
+        const auto lineState = first > 0 ? tokens[first - 1].lineState : uint32_t(LexerLineState_OperandExpected);
+        const auto isTriviaBefore = [](const LexerTrivia& trivia, int64_t offset) { return trivia.offset < offset; };
+        std::vector<LexerTrivia> trivia;
+
+        // The trivia of the lines lexed again are collected apart, then spliced like the tokens.
+        trivia.swap(m_trivia);
+        m_source->edit(edit);
+
+        m_tokens.clear();
+        m_tokenBase = first;
+        m_position = restart;
+        m_end = m_source->getSize();
+        m_commentStart = restart;
+        m_text.clear();
+        m_textQuote = 0;
+        m_isInText = false;
+        m_isTextCopied = false;
+        m_isInCommentMultiLine = (lineState & LexerLineState_CommentMultiLine) != 0;
+        m_isOperandExpected = (lineState & LexerLineState_OperandExpected) != 0;
+        m_lastTokenAllowUnary = true;
+
+        // Past the edit, the first newline found at the same place in the previous tokens with the same state
+        // means every following token is unchanged.
+        const auto editEnd = edit.offset + edit.insertedText.size();
+        auto last = tokens.size();
+        auto isSynchronized = false;
+
+        while (!isSynchronized && lexLine()) {
+            if (m_isInText || m_tokens.empty() || m_tokens.back().offset < editEnd)
+                continue;
+
+            const auto& newline = m_tokens.back();
+            const auto previousOffset = static_cast<int64_t>(newline.offset) - delta;
+            const auto previous = std::lower_bound(tokens.begin() + first, tokens.end(), previousOffset, isBefore);
+
+            if (previous != tokens.end() && previous->offset == previousOffset &&
+                previous->type == ParserToken_Newline && previous->lineState == newline.lineState) {
+                last = static_cast<size_t>(previous - tokens.begin()) + 1;
+                isSynchronized = true;
+            }
+        }
+
+        const SourceEditDamage damage { first, last - first, m_tokens.size() };
+        const auto tokenDelta = static_cast<int64_t>(damage.insertedCount) - static_cast<int64_t>(damage.removedCount);
+        const auto triviaFirst = static_cast<size_t>(std::lower_bound(trivia.begin(), trivia.end(),
+            static_cast<int64_t>(restart), isTriviaBefore) - trivia.begin());
+        auto triviaLast = trivia.size();
+
+        if (isSynchronized) {
+            triviaLast = static_cast<size_t>(std::lower_bound(trivia.begin() + triviaFirst, trivia.end(),
+                static_cast<int64_t>(tokens[last - 1].offset) + 1, isTriviaBefore) - trivia.begin());
+
+            for (auto i = triviaLast; i < trivia.size(); i++) {
+                trivia[i].offset = static_cast<uint32_t>(trivia[i].offset + delta);
+                trivia[i].token = static_cast<uint32_t>(trivia[i].token + tokenDelta);
+            }
+
+            for (auto i = last; i < tokens.size(); i++)
+                tokens[i].offset = static_cast<uint32_t>(tokens[i].offset + delta);
+        }
+
+        replaceRange(tokens, first, last, m_tokens);
+        replaceRange(trivia, triviaFirst, triviaLast, m_trivia);
+
+        m_trivia.swap(trivia);
+        m_tokens.clear();
+        m_tokenBase = 0;
+
+        return damage;
+    }
+
+    void Lexer::classifyToken(size_t offset, std::string_view content, LexerTokenEnum type) {
+        ParserToken token {};
+
+        token.offset = static_cast<uint32_t>(offset);
+        token.length = static_cast<uint32_t>(content.size());
+
+        switch (type) {
+            case LexerToken_Number:
+                if (content.find('.') != std::string_view::npos)
+                    token.type = ParserToken_LiteralValueDecimal;
+                else
+                    token.type = ParserToken_LiteralValueInteger;
+
+                decodeNumber(token, offset, content);
+                break;
+            case LexerToken_String:
+                token.type = ParserToken_LiteralValueString;
+                break;
+            case LexerToken_Character:
+                token.type = ParserToken_LiteralValueCharacter;
+                break;
+            case LexerToken_Operator:
+            case LexerToken_Separator:
+                token.type = findParserSpelling(content);
+
+                if (m_isOperandExpected && token.type == ParserToken_OperatorArithmeticPlus)
+                    token.type = ParserToken_OperatorUnaryArithmeticPlus;
+                else if (m_isOperandExpected && token.type == ParserToken_OperatorArithmeticMinus)
+                    token.type = ParserToken_OperatorUnaryArithmeticMinus;
+                break;
+            case LexerToken_Identifier:
+                // Keywords are told apart by their spelling and never reach the symbol table.
+                token.type = findParserSpelling(content);
+
+                if (token.type == ParserToken_Unknown) {
+                    token.type = ParserToken_Identifier;
+                    token.symbol = m_chunkSymbols ? m_chunkSymbols->intern(content) : getSymbolTable().intern(content);
+                }
+                break;
+            case LexerToken_Newline:
+                token.type = ParserToken_Newline;
+                m_tokens.push_back(token);
+                return;
+            default:
+                reportError(offset, "unknown token '" + std::string(content) + "'");
+
+                token.type = ParserToken_Unknown;
+                break;
+        }
+
+        if (!m_hasOperandState) {
+            m_hasOperandState = true;
+            m_operandStateToken = m_tokens.size();
+
+            if (token.type == ParserToken_OperatorUnaryArithmeticPlus ||
+                token.type == ParserToken_OperatorUnaryArithmeticMinus) {
+                m_firstOperandToken = m_tokens.size();
+            }
+        }
+
+        m_isOperandExpected = type != LexerToken_Number && type != LexerToken_Identifier &&
+            content != ")" && content != "++" && content != "--";
+
+        // Unknown operators and separators are dropped.
+        if (token.type == ParserToken_Unknown && (type == LexerToken_Operator || type == LexerToken_Separator))
+            return;
+
+        if (token.type != ParserToken_Identifier && !isSourceRange(content)) {
+            m_rewrittenContents.emplace_back(content);
+
+            if (type == LexerToken_Number)
+                m_literals.back().storage = static_cast<uint32_t>(m_rewrittenContents.size());
+            else
+                token.storage = static_cast<uint32_t>(m_rewrittenContents.size());
+        }
+
+        m_tokens.push_back(token);
+    }
+
+    std::string_view Lexer::keepContent(std::string content) {
+        return m_storage.emplace_back(std::move(content));
+    }
+
+    void Lexer::stateMachine(std::string_view expression) {
         LexerToken currentToken;
         std::vector<LexerToken> tokens;
         auto currentTransitionState = LexerToken_Reject;
         auto previousTransitionState = LexerToken_Reject;
-        std::string currentTokenExpression;
+        size_t currentTokenStart = 0;
 
         for (unsigned x = 0; x < expression.length();) {
             const auto currentCharacter = expression[x];
@@ -67,28 +787,27 @@ namespace Aryiele {
             currentTransitionState = static_cast<LexerTokenEnum>(LexerTable[currentTransitionState][column]);
 
             if (currentTransitionState == LexerToken_Reject) {
-                currentToken.content = currentTokenExpression;
+                currentToken.content = expression.substr(currentTokenStart, x - currentTokenStart);
                 currentToken.type = previousTransitionState;
-                currentTokenExpression = "";
+                currentTokenStart = x;
 
                 tokens.push_back(currentToken);
             }
             else {
-                currentTokenExpression += currentCharacter;
                 ++x;
             }
 
             previousTransitionState = currentTransitionState;
         }
 
-        if (!currentTokenExpression.empty()) {
-            currentToken.content = currentTokenExpression;
+        if (currentTokenStart < expression.length()) {
+            currentToken.content = expression.substr(currentTokenStart);
             currentToken.type = currentTransitionState;
 
             tokens.push_back(currentToken);
         }
         
-        m_tokens.insert(m_tokens.end(), tokens.begin(), tokens.end());
+        m_lexerTokens.insert(m_lexerTokens.end(), tokens.begin(), tokens.end());
     }
 
     void Lexer::stateComments() {
@@ -98,8 +817,7 @@ namespace Aryiele {
         auto isInCommentMultiLine = false;
         auto lengthInMultiline = 2;
 
-        for (auto& token : m_tokens) {
-            const auto lastToken = currentToken;
+        for (auto& token : m_lexerTokens) {
             currentToken = token;
 
             if (isInCommentSingleLine) {
@@ -137,9 +855,9 @@ namespace Aryiele {
             }
         }
 
-        m_tokens.clear();
+        m_lexerTokens.clear();
 
-        m_tokens = tokens;
+        m_lexerTokens = tokens;
     }
 
     void Lexer::stateStrings() {
@@ -149,8 +867,7 @@ namespace Aryiele {
         std::string currentText;
         auto isInText = false;
 
-        for (auto& token : m_tokens) {
-            const auto lastToken = currentToken;
+        for (auto& token : m_lexerTokens) {
             currentToken = token;
             
             if (isInText) {
@@ -160,7 +877,7 @@ namespace Aryiele {
                         currentText.pop_back();
                         currentText += inTextQuote;
                     } else {
-                        currentToken.content = currentText;
+                        currentToken.content = keepContent(currentText);
                         currentToken.type = currentText.size() == 1 ? LexerToken_Character : LexerToken_String;
 
                         tokens.emplace_back(currentToken);
@@ -180,9 +897,9 @@ namespace Aryiele {
             }
         }
 
-        m_tokens.clear();
+        m_lexerTokens.clear();
 
-        m_tokens = tokens;
+        m_lexerTokens = tokens;
     }
     
     void Lexer::stateNumbers() {
@@ -191,8 +908,7 @@ namespace Aryiele {
         std::string number;
         auto isInNumber = false;
         
-        for (auto& token : m_tokens) {
-            const auto lastToken = currentToken;
+        for (auto& token : m_lexerTokens) {
             currentToken = token;
     
             if (isInNumber) {
@@ -200,7 +916,7 @@ namespace Aryiele {
                     (currentToken.type == LexerToken_Number)) {
                     number += currentToken.content;
                 } else {
-                    tokens.emplace_back(LexerToken(number, LexerToken_Number));
+                    tokens.emplace_back(LexerToken(keepContent(number), LexerToken_Number));
                     tokens.emplace_back(currentToken);
     
                     isInNumber = false;
@@ -214,22 +930,22 @@ namespace Aryiele {
             }
         }
         
-        m_tokens.clear();
+        m_lexerTokens.clear();
         
-        m_tokens = tokens;
+        m_lexerTokens = tokens;
     
         
         currentToken = LexerToken();
         tokens = std::vector<LexerToken>();
         bool isUnary = false;
     
-        for (auto& token : m_tokens) {
+        for (auto& token : m_lexerTokens) {
             const auto lastToken = currentToken;
             currentToken = token;
             
             if (isUnary) {
                 if (currentToken.type == LexerToken_Number && lastToken.content == "-") {
-                    currentToken.content = "-" + currentToken.content;
+                    currentToken.content = keepContent("-" + std::string(currentToken.content));
                 } else {
                     tokens.emplace_back(lastToken);
                 }
@@ -244,17 +960,16 @@ namespace Aryiele {
             }
         }
     
-        m_tokens.clear();
+        m_lexerTokens.clear();
     
-        m_tokens = tokens;
+        m_lexerTokens = tokens;
     }
     
     void Lexer::stateSpaces() {
         LexerToken currentToken;
         std::vector<LexerToken> tokens;
     
-        for (auto& token : m_tokens) {
-            const auto lastToken = currentToken;
+        for (auto& token : m_lexerTokens) {
             currentToken = token;
             
             if (currentToken.type == LexerToken_Space) {
@@ -264,9 +979,9 @@ namespace Aryiele {
             }
         }
     
-        m_tokens.clear();
+        m_lexerTokens.clear();
     
-        m_tokens = tokens;
+        m_lexerTokens = tokens;
     }
     
     void Lexer::stateOperators() {
@@ -274,8 +989,7 @@ namespace Aryiele {
         std::vector<LexerToken> tokens;
         int dots = 0;
     
-        for (auto& token : m_tokens) {
-            const auto lastToken = currentToken;
+        for (auto& token : m_lexerTokens) {
             currentToken = token;
         
             if (dots > 0) {
@@ -302,9 +1016,9 @@ namespace Aryiele {
             }
         }
     
-        m_tokens.clear();
+        m_lexerTokens.clear();
     
-        m_tokens = tokens;
+        m_lexerTokens = tokens;
     }
     
     void Lexer::stateIdentifiers() {
@@ -313,8 +1027,7 @@ namespace Aryiele {
         bool inName = false;
         std::string identifier;
     
-        for (auto& token : m_tokens) {
-            const auto lastToken = currentToken;
+        for (auto& token : m_lexerTokens) {
             currentToken = token;
             
             if (inName) {
@@ -322,7 +1035,7 @@ namespace Aryiele {
                     (currentToken.content == "." && identifier.back() != '.')) {
                     identifier += currentToken.content;
                 } else {
-                    tokens.emplace_back(LexerToken(identifier, LexerToken_Identifier));
+                    tokens.emplace_back(LexerToken(keepContent(identifier), LexerToken_Identifier));
                     tokens.emplace_back(currentToken);
                     inName = false;
                     identifier = "";
@@ -337,31 +1050,40 @@ namespace Aryiele {
             }
         }
     
-        m_tokens.clear();
+        m_lexerTokens.clear();
+    
+        m_lexerTokens = tokens;
+    }
     
-        m_tokens = tokens;
+    void Lexer::stateClassify(std::string_view source) {
+        size_t offset = 0;
+
+        // Contents merged by the previous passes no longer point into the source, their offset is estimated.
+        for (auto& token : m_lexerTokens) {
+            if (isSourceRange(token.content))
+                offset = static_cast<size_t>(token.content.data() - source.data());
+
+            if (token.type == LexerToken_Space)
+                addTrivia(offset, 1);
+            else
+                classifyToken(offset, token.content, token.type);
+
+            offset += std::max<size_t>(token.content.size(), 1);
+        }
+
+        m_lexerTokens.clear();
+    }
+
+    bool Lexer::isSourceRange(std::string_view content) const {
+        const auto source = m_source->getView();
+        const auto begin = reinterpret_cast<uintptr_t>(source.data());
+        const auto position = reinterpret_cast<uintptr_t>(content.data());
+
+        return position >= begin && position + content.size() <= begin + source.size();
     }
     
     LexerTokenEnum Lexer::getTransitionTableColumn(char currentCharacter) {
-        if (currentCharacter == '{' || currentCharacter == '}' ||
-            currentCharacter == '[' || currentCharacter == ']' ||
-            currentCharacter == '(' || currentCharacter == ')' ||
-            currentCharacter == ';' || currentCharacter == ',' ||
-            currentCharacter == ':' || currentCharacter == '.') {
-            return LexerToken_Separator;
-        } else if (currentCharacter == '\"' || currentCharacter == '\'') {
-            return LexerToken_StringQuote;
-        } else if (isspace(currentCharacter)) {
-                return LexerToken_Space;
-        } else if (isdigit(currentCharacter)) {
-            return LexerToken_Number;
-        } else if (isalpha(currentCharacter) || currentCharacter == '_') {
-            return LexerToken_Identifier;
-        } else if (ispunct(currentCharacter)) {
-            return LexerToken_Operator;
-        }
-
-        return LexerToken_Unknown;
+        return LexerCharacterTable[static_cast<unsigned char>(currentCharacter)];
     }
     
     Lexer &getLexer() {
@@ -0,0 +1,249 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#include <cstring>
+#include <Aryiele/Lexer/LexerScanner.h>
+#include <Aryiele/Lexer/LexerTable.h>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define ARYIELE_LEXER_SSE2
+#include <immintrin.h>
+#if defined(__GNUC__)
+#define ARYIELE_LEXER_AVX2 __attribute__((target("avx2")))
+#elif defined(__AVX2__)
+#define ARYIELE_LEXER_AVX2
+#endif
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Aryiele {
+    namespace {
+#ifdef ARYIELE_LEXER_SSE2
+        unsigned int countTrailingZeros(unsigned int mask) {
+#if defined(_MSC_VER)
+            unsigned long index;
+
+            _BitScanForward(&index, mask);
+
+            return index;
+#else
+            return __builtin_ctz(mask);
+#endif
+        }
+
+        // Bytes are compared as signed, so every non-ASCII byte is below the ASCII ranges.
+        __m128i inRange(__m128i chunk, char low, char high) {
+            return _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8(low - 1)),
+                                 _mm_cmplt_epi8(chunk, _mm_set1_epi8(high + 1)));
+        }
+#endif
+
+#ifdef ARYIELE_LEXER_AVX2
+        ARYIELE_LEXER_AVX2 __m256i inRange(__m256i chunk, char low, char high) {
+            return _mm256_and_si256(_mm256_cmpgt_epi8(chunk, _mm256_set1_epi8(low - 1)),
+                                    _mm256_cmpgt_epi8(_mm256_set1_epi8(high + 1), chunk));
+        }
+
+        bool hasAVX2() {
+#if defined(__GNUC__)
+            __builtin_cpu_init();
+
+            return __builtin_cpu_supports("avx2");
+#else
+            return true;
+#endif
+        }
+
+        const bool isAVX2Supported = hasAVX2();
+#endif
+
+        // Each run gives the scalar test of a byte and its 16 and 32 bytes equivalents (all ones for bytes in the run).
+        struct SpaceRun {
+            static bool contains(unsigned char character) {
+                return character != '\n' && LexerCharacterTable[character] == LexerToken_Space;
+            }
+
+#ifdef ARYIELE_LEXER_SSE2
+            static __m128i classify(__m128i chunk) {
+                const auto blanks = _mm_andnot_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n')),
+                                                     inRange(chunk, '\t', '\r'));
+
+                return _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')), blanks);
+            }
+#endif
+
+#ifdef ARYIELE_LEXER_AVX2
+            ARYIELE_LEXER_AVX2 static __m256i classify(__m256i chunk) {
+                const auto blanks = _mm256_andnot_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\n')),
+                                                        inRange(chunk, '\t', '\r'));
+
+                return _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(' ')), blanks);
+            }
+#endif
+        };
+
+        struct WordRun {
+            static bool contains(unsigned char character) {
+                return LexerCharacterTable[character] == LexerToken_Identifier ||
+                       LexerCharacterTable[character] == LexerToken_Number;
+            }
+
+#ifdef ARYIELE_LEXER_SSE2
+            static __m128i classify(__m128i chunk) {
+                const auto letters = inRange(_mm_or_si128(chunk, _mm_set1_epi8(0x20)), 'a', 'z');
+
+                return _mm_or_si128(_mm_or_si128(letters, inRange(chunk, '0', '9')),
+                                    _mm_cmpeq_epi8(chunk, _mm_set1_epi8('_')));
+            }
+#endif
+
+#ifdef ARYIELE_LEXER_AVX2
+            ARYIELE_LEXER_AVX2 static __m256i classify(__m256i chunk) {
+                const auto letters = inRange(_mm256_or_si256(chunk, _mm256_set1_epi8(0x20)), 'a', 'z');
+
+                return _mm256_or_si256(_mm256_or_si256(letters, inRange(chunk, '0', '9')),
+                                       _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('_')));
+            }
+#endif
+        };
+
+        struct CommentRun {
+            static bool contains(unsigned char character) {
+                return character >= 0x80 || SpaceRun::contains(character) || WordRun::contains(character);
+            }
+
+#ifdef ARYIELE_LEXER_SSE2
+            static __m128i classify(__m128i chunk) {
+                const auto nonAscii = _mm_cmplt_epi8(chunk, _mm_setzero_si128());
+
+                return _mm_or_si128(_mm_or_si128(SpaceRun::classify(chunk), WordRun::classify(chunk)), nonAscii);
+            }
+#endif
+
+#ifdef ARYIELE_LEXER_AVX2
+            ARYIELE_LEXER_AVX2 static __m256i classify(__m256i chunk) {
+                const auto nonAscii = _mm256_cmpgt_epi8(_mm256_setzero_si256(), chunk);
+
+                return _mm256_or_si256(_mm256_or_si256(SpaceRun::classify(chunk), WordRun::classify(chunk)), nonAscii);
+            }
+#endif
+        };
+
+#ifdef ARYIELE_LEXER_SSE2
+        // Returns true and moves 'position' to the end of the run if it ends in the next 16 bytes.
+        template <typename Run>
+        bool findEndSSE2(const char* data, size_t& position) {
+            const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position));
+            const auto mask = static_cast<unsigned int>(_mm_movemask_epi8(Run::classify(chunk)));
+
+            if (mask != 0xFFFF) {
+                position += countTrailingZeros(~mask);
+
+                return true;
+            }
+
+            position += 16;
+
+            return false;
+        }
+#endif
+
+#ifdef ARYIELE_LEXER_AVX2
+        template <typename Run>
+        ARYIELE_LEXER_AVX2 bool findEndAVX2(const char* data, size_t& position, size_t size) {
+            while (position + 32 <= size) {
+                const auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + position));
+                const auto mask = static_cast<unsigned int>(_mm256_movemask_epi8(Run::classify(chunk)));
+
+                if (mask != 0xFFFFFFFF) {
+                    position += countTrailingZeros(~mask);
+
+                    return true;
+                }
+
+                position += 32;
+            }
+
+            return false;
+        }
+#endif
+
+        template <typename Run>
+        size_t skipRun(std::string_view source, size_t position) {
+            const auto data = source.data();
+            const auto size = source.size();
+
+#ifdef ARYIELE_LEXER_SSE2
+            // Most runs are short, only go wider once the first 16 bytes are all in the run.
+            if (position + 16 <= size && findEndSSE2<Run>(data, position))
+                return position;
+
+#ifdef ARYIELE_LEXER_AVX2
+            if (isAVX2Supported && findEndAVX2<Run>(data, position, size))
+                return position;
+#endif
+
+            while (position + 16 <= size) {
+                if (findEndSSE2<Run>(data, position))
+                    return position;
+            }
+#endif
+
+            while (position < size && Run::contains(data[position]))
+                ++position;
+
+            return position;
+        }
+    }
+
+    size_t LexerScanner::skipSpaces(std::string_view source, size_t position) {
+        return skipRun<SpaceRun>(source, position);
+    }
+
+    size_t LexerScanner::skipWordCharacters(std::string_view source, size_t position) {
+        return skipRun<WordRun>(source, position);
+    }
+
+    size_t LexerScanner::skipCommentText(std::string_view source, size_t position) {
+        return skipRun<CommentRun>(source, position);
+    }
+
+    size_t LexerScanner::skipLine(std::string_view source, size_t position) {
+        if (position >= source.size())
+            return source.size();
+
+        // memchr is already vectorized by the C library.
+        const auto lineBreak = static_cast<const char*>(std::memchr(source.data() + position, '\n',
+                                                                    source.size() - position));
+
+        return lineBreak ? lineBreak - source.data() : source.size();
+    }
+
+} /* Namespace Aryiele. */
@@ -28,7 +28,7 @@
 #include <Aryiele/Lexer/LexerToken.h>
 
 namespace Aryiele {
-    LexerToken::LexerToken(const std::string& content, const LexerTokenEnum type) :
+    LexerToken::LexerToken(std::string_view content, const LexerTokenEnum type) :
         content(content), type(type) {
 
     }
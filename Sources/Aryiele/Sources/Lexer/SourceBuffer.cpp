@@ -0,0 +1,143 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#ifndef PLATFORM_WINDOWS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <Aryiele/Lexer/SourceBuffer.h>
+
+namespace Aryiele {
+    SourceBuffer::~SourceBuffer() {
+        close();
+    }
+
+    bool SourceBuffer::open(const std::string& filepath) {
+        close();
+
+#ifndef PLATFORM_WINDOWS
+        auto descriptor = ::open(filepath.c_str(), O_RDONLY);
+
+        if (descriptor < 0)
+            return false;
+
+        struct stat status {};
+
+        if (fstat(descriptor, &status) == 0 && status.st_size > 0) {
+            auto mapping = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+            if (mapping != MAP_FAILED) {
+                m_data = static_cast<const char*>(mapping);
+                m_size = static_cast<size_t>(status.st_size);
+                m_isMapped = true;
+
+                ::close(descriptor);
+
+                return true;
+            }
+        }
+
+        ::close(descriptor);
+#endif
+
+        // Fallback for empty files, pipes and platforms without mmap: read the file once.
+        std::ifstream file(filepath.c_str(), std::ios::in | std::ios::binary);
+
+        if (file.fail())
+            return false;
+
+        m_content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        m_data = m_content.data();
+        m_size = m_content.size();
+
+        return true;
+    }
+
+    void SourceBuffer::close() {
+#ifndef PLATFORM_WINDOWS
+        if (m_isMapped)
+            munmap(const_cast<char*>(m_data), m_size);
+#endif
+
+        m_data = nullptr;
+        m_size = 0;
+        m_isMapped = false;
+        m_content.clear();
+        m_lineStarts.clear();
+    }
+
+    void SourceBuffer::edit(const SourceEdit& edit) {
+        if (m_isMapped) {
+            std::string content(m_data, m_size);
+
+            close();
+
+            m_content = std::move(content);
+        }
+
+        m_content.replace(edit.offset, edit.removedLength, edit.insertedText);
+        m_data = m_content.data();
+        m_size = m_content.size();
+        m_lineStarts.clear();
+    }
+
+    std::string_view SourceBuffer::getView() const {
+        return std::string_view(m_data, m_size);
+    }
+
+    const char* SourceBuffer::getData() const {
+        return m_data;
+    }
+
+    size_t SourceBuffer::getSize() const {
+        return m_size;
+    }
+
+    SourcePosition SourceBuffer::getPosition(size_t offset) const {
+        if (m_lineStarts.empty()) {
+            m_lineStarts.push_back(0);
+
+            for (auto data = m_data, end = m_data + m_size;
+                 (data = static_cast<const char*>(memchr(data, '\n', end - data))) != nullptr; ++data) {
+                m_lineStarts.push_back(static_cast<uint32_t>(data - m_data + 1));
+            }
+        }
+
+        offset = std::min(offset, m_size);
+
+        const auto line = std::upper_bound(m_lineStarts.begin(), m_lineStarts.end(), offset) - 1;
+
+        return { static_cast<uint32_t>(line - m_lineStarts.begin() + 1), static_cast<uint32_t>(offset - *line + 1) };
+    }
+
+} /* Namespace Aryiele. */
@@ -0,0 +1,127 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#include <Aryiele/Lexer/TokenStream.h>
+
+namespace Aryiele {
+    static_assert((TokenStream::Capacity & (TokenStream::Capacity - 1)) == 0, "capacity must be a power of two");
+
+    TokenStream::TokenStream(Lexer& lexer) : m_lexer(&lexer) {
+        m_endToken.offset = static_cast<uint32_t>(lexer.getSource()->getSize());
+        m_endToken.type = ParserToken_EOF;
+    }
+
+    TokenStream::TokenStream(std::vector<ParserToken> tokens) : m_pending(std::move(tokens)) {
+        m_pendingBegin = m_pending.data();
+        m_pendingEnd = m_pending.data() + m_pending.size();
+        m_endToken.offset = m_pending.empty() ? 0 : m_pending.back().offset;
+        m_endToken.type = ParserToken_EOF;
+    }
+
+    TokenStream::TokenStream(const ParserToken* begin, const ParserToken* end, uint32_t endOffset) :
+        m_pendingBegin(begin), m_pendingEnd(end) {
+        m_endToken.offset = endOffset;
+        m_endToken.type = ParserToken_EOF;
+    }
+
+    const ParserToken& TokenStream::peek(size_t n) {
+        if (!m_lexer)
+            return n < static_cast<size_t>(m_pendingEnd - m_pendingBegin) ? m_pendingBegin[n] : m_endToken;
+
+        fill(n + 1);
+
+        return m_buffer[(m_head + n) & (Capacity - 1)];
+    }
+
+    const ParserToken& TokenStream::next() {
+        m_position++;
+
+        if (!m_lexer)
+            return m_pendingBegin != m_pendingEnd ? *m_pendingBegin++ : m_endToken;
+
+        fill(1);
+
+        auto& token = m_buffer[m_head];
+
+        m_head = (m_head + 1) & (Capacity - 1);
+        m_size--;
+
+        return token;
+    }
+
+    size_t TokenStream::getPosition() const {
+        return m_position;
+    }
+
+    bool TokenStream::isBoundToLexer() const {
+        return m_lexer != nullptr;
+    }
+
+    const ParserToken* TokenStream::getPendingBegin() const {
+        return m_pendingBegin;
+    }
+
+    const ParserToken* TokenStream::getPendingEnd() const {
+        return m_pendingEnd;
+    }
+
+    uint32_t TokenStream::getEndOffset() const {
+        return m_endToken.offset;
+    }
+
+    void TokenStream::fill(size_t count) {
+        while (m_size < count) {
+            auto& token = m_buffer[(m_head + m_size) & (Capacity - 1)];
+
+            if (m_pendingBegin != m_pendingEnd || pull()) {
+                token = *m_pendingBegin++;
+            } else {
+                token = m_endToken;
+            }
+
+            m_size++;
+        }
+    }
+
+    bool TokenStream::pull() {
+        if (!m_lexer)
+            return false;
+
+        // A line can hold no token at all (inside a multi-line string).
+        while (m_lexer->lexLine()) {
+            m_lexer->takeTokens(m_pending);
+            m_pendingBegin = m_pending.data();
+            m_pendingEnd = m_pending.data() + m_pending.size();
+
+            if (!m_pending.empty())
+                return true;
+        }
+
+        return false;
+    }
+
+} /* Namespace Aryiele. */
@@ -25,9 +25,14 @@
 //                                                                                  //
 //==================================================================================//
 
+#include <atomic>
+#include <thread>
 #include <utility>
 #include <llvm/ADT/STLExtras.h>
 #include <Aryiele/Parser/Parser.h>
+#include <Aryiele/Parser/ParserPrecedence.h>
+#include <Aryiele/Lexer/Lexer.h>
+#include <Aryiele/AST/Nodes/NodeLiteralBoolean.h>
 #include <Aryiele/AST/Nodes/NodeLiteralNumberFloating.h>
 #include <Aryiele/AST/Nodes/NodeLiteralNumberInteger.h>
 #include <Aryiele/AST/Nodes/NodeLiteralString.h>
@@ -54,306 +59,279 @@
 
 namespace Aryiele {
     Parser::Parser() {
-        m_binaryOperatorPrecedence[ParserToken_OperatorQuestionMark] = 5;
-        m_binaryOperatorPrecedence[ParserToken_OperatorEqual] = 10;
-        m_binaryOperatorPrecedence[ParserToken_OperatorArithmeticPlusEqual] = 10;
-        m_binaryOperatorPrecedence[ParserToken_OperatorArithmeticMinusEqual] = 10;
-        m_binaryOperatorPrecedence[ParserToken_OperatorArithmeticMultiplyEqual] = 10;
-        m_binaryOperatorPrecedence[ParserToken_OperatorArithmeticDivideEqual] = 10;
-        m_binaryOperatorPrecedence[ParserToken_OperatorArithmeticRemainderEqual] = 10;
-        m_binaryOperatorPrecedence[ParserToken_OperatorLogicalAnd] = 20;
-        m_binaryOperatorPrecedence[ParserToken_OperatorLogicalOr] = 20;
-        m_binaryOperatorPrecedence[ParserToken_OperatorComparisonLessThan] = 30;
-        m_binaryOperatorPrecedence[ParserToken_OperatorComparisonGreaterThan] = 30;
-        m_binaryOperatorPrecedence[ParserToken_OperatorComparisonLessThanOrEqual] = 30;
-        m_binaryOperatorPrecedence[ParserToken_OperatorComparisonGreaterThanOrEqual] = 30;
-        m_binaryOperatorPrecedence[ParserToken_OperatorComparisonEqual] = 30;
-        m_binaryOperatorPrecedence[ParserToken_OperatorComparisonNotEqual] = 30;
-        m_binaryOperatorPrecedence[ParserToken_OperatorArithmeticPlus] = 40;
-        m_binaryOperatorPrecedence[ParserToken_OperatorArithmeticMinus] = 40;
-        m_binaryOperatorPrecedence[ParserToken_OperatorArithmeticRemainder] = 50;
-        m_binaryOperatorPrecedence[ParserToken_OperatorArithmeticMultiply] = 50;
-        m_binaryOperatorPrecedence[ParserToken_OperatorArithmeticDivide] = 50;
+        
     }
     
-    std::shared_ptr<NodeRoot> Parser::parse(const std::string& path, std::vector<ParserToken> tokens) {
-        m_tokens = std::move(tokens);
-        m_tokens.emplace_back("", ParserToken_EOF);
+    NodeRoot* Parser::parse(ASTContext& context, const std::string& path, std::vector<ParserToken> tokens) {
+        TokenStream stream(std::move(tokens));
+
+        return parse(context, path, stream);
+    }
+
+    NodeRoot* Parser::parse(ASTContext& context, const std::string& path, TokenStream& tokens) {
+        Node* node = nullptr;
         
-        while (true) {
-            getNextToken();
-            
-            if (m_currentToken.type == ParserToken_EOF) {
-                break;
-            } else if (m_currentToken.type == ParserToken_KeywordFunction) {
-                m_nodes.emplace_back(parseFunction());
-            } else if (m_currentToken.type == ParserToken_KeywordNamespace) {
-                m_nodes.emplace_back(parseNamespace());
-            } else if (m_currentToken.type == ParserToken_KeywordVar) {
-                m_nodes.emplace_back(parseVariableDeclaration());
-            } else if (m_currentToken.type == ParserToken_KeywordLet) {
-                m_nodes.emplace_back(parseVariableDeclaration(true));
-            }
+        m_nodes.clear();
+        
+        if (m_threadCount != 1 && !tokens.isBoundToLexer()) {
+            parseParallel(context, tokens);
+        } else {
+            while (parseTopLevel(context, tokens, node))
+                m_nodes.emplace_back(node);
         }
         
-        auto nodeRoot = std::make_shared<NodeRoot>(std::vector<std::shared_ptr<Node>>
-            {std::make_shared<NodeTopFile>(path, m_nodes)});
+        auto nodeRoot = context.create<NodeRoot>(std::vector<Node*>
+            {context.create<NodeTopFile>(path, m_nodes)});
+        
+        m_nodes.clear();
         
         setParent(nodeRoot);
         
         return nodeRoot;
     }
     
-    std::vector<ParserToken> Parser::convertTokens(const std::vector<LexerToken>& LexerTokens) {
-        auto tokens = std::vector<ParserToken>();
-        auto lastToken = LexerToken(std::string(), LexerToken_Unknown);
-
-        for (auto& token : LexerTokens) {
-            switch (token.type) {
-                case LexerToken_Number:
-                    if (token.content.find('.') != std::string::npos)
-                        tokens.emplace_back(token.content, ParserToken_LiteralValueDecimal);
-                    else
-                        tokens.emplace_back(token.content, ParserToken_LiteralValueInteger);
-                    break;
-                case LexerToken_String:
-                    tokens.emplace_back(token.content, ParserToken_LiteralValueString);
-                    break;
-                case LexerToken_Character:
-                    tokens.emplace_back(token.content, ParserToken_LiteralValueCharacter);
-                    break;
-                case LexerToken_Operator:
-                    // Operators.
-                    if (token.content == "=")
-                        tokens.emplace_back("", ParserToken_OperatorEqual);
-                    // Arithmetic Operators.
-                    else if (token.content == "+=")
-                        tokens.emplace_back("", ParserToken_OperatorArithmeticPlusEqual);
-                    else if (token.content == "-=")
-                        tokens.emplace_back("", ParserToken_OperatorArithmeticMinusEqual);
-                    else if (token.content == "*=")
-                        tokens.emplace_back("", ParserToken_OperatorArithmeticMultiplyEqual);
-                    else if (token.content == "/=")
-                        tokens.emplace_back("", ParserToken_OperatorArithmeticDivideEqual);
-                    else if (token.content == "%=")
-                        tokens.emplace_back("", ParserToken_OperatorArithmeticRemainderEqual);
-                    else if ((token.content == "+" &&
-                             lastToken.type != LexerToken_Number &&
-                             lastToken.type != LexerToken_Identifier) &&
-                             lastToken.content != ")" &&
-                             lastToken.content != "++" &&
-                             lastToken.content != "--")
-                        tokens.emplace_back("", ParserToken_OperatorUnaryArithmeticPlus);
-                    else if (token.content == "+")
-                        tokens.emplace_back("", ParserToken_OperatorArithmeticPlus);
-                    else if ((token.content == "-" &&
-                              lastToken.type != LexerToken_Number &&
-                              lastToken.type != LexerToken_Identifier) &&
-                              lastToken.content != ")" &&
-                              lastToken.content != "++" &&
-                              lastToken.content != "--")
-                        tokens.emplace_back("", ParserToken_OperatorUnaryArithmeticMinus);
-                    else if (token.content == "-")
-                        tokens.emplace_back("", ParserToken_OperatorArithmeticMinus);
-                    else if (token.content == "*")
-                        tokens.emplace_back("", ParserToken_OperatorArithmeticMultiply);
-                    else if (token.content == "/")
-                        tokens.emplace_back("", ParserToken_OperatorArithmeticDivide);
-                    else if (token.content == "%")
-                        tokens.emplace_back("", ParserToken_OperatorArithmeticRemainder);
-                    else if (token.content == "==")
-                        tokens.emplace_back("", ParserToken_OperatorComparisonEqual);
-                    else if (token.content == "!=")
-                        tokens.emplace_back("", ParserToken_OperatorComparisonNotEqual);
-                    else if (token.content == "<")
-                        tokens.emplace_back("", ParserToken_OperatorComparisonLessThan);
-                    else if (token.content == ">")
-                        tokens.emplace_back("", ParserToken_OperatorComparisonGreaterThan);
-                    else if (token.content == "<=")
-                        tokens.emplace_back("", ParserToken_OperatorComparisonLessThanOrEqual);
-                    else if (token.content == ">=")
-                        tokens.emplace_back("", ParserToken_OperatorComparisonGreaterThanOrEqual);
-                    else if (token.content == "&&")
-                        tokens.emplace_back("", ParserToken_OperatorLogicalAnd);
-                    else if (token.content == "||")
-                        tokens.emplace_back("", ParserToken_OperatorLogicalOr);
-                    else if (token.content == "!")
-                        tokens.emplace_back("", ParserToken_OperatorUnaryLogicalNot);
-                    else if (token.content == "++")
-                        tokens.emplace_back("", ParserToken_OperatorUnaryArithmeticIncrement);
-                    else if (token.content == "--")
-                        tokens.emplace_back("", ParserToken_OperatorUnaryArithmeticDecrement);
-                    else if (token.content == "?")
-                        tokens.emplace_back("", ParserToken_OperatorQuestionMark);
-                    break;
-                case LexerToken_Separator:
-                    // Separators
-                    if (token.content == "(")
-                        tokens.emplace_back("", ParserToken_SeparatorRoundBracketOpen);
-                    else if (token.content == ")")
-                        tokens.emplace_back("", ParserToken_SeparatorRoundBracketClosed);
-                    else if (token.content == "[")
-                        tokens.emplace_back("", ParserToken_SeparatorSquareBracketOpen);
-                    else if (token.content == "]")
-                        tokens.emplace_back("", ParserToken_SeparatorSquareBracketClosed);
-                    else if (token.content == "{")
-                        tokens.emplace_back("", ParserToken_SeparatorCurlyBracketOpen);
-                    else if (token.content == "}")
-                        tokens.emplace_back("", ParserToken_SeparatorCurlyBracketClosed);
-                    else if (token.content == ";")
-                        tokens.emplace_back("", ParserToken_SeparatorSemicolon);
-                    else if (token.content == ":")
-                        tokens.emplace_back("", ParserToken_SeparatorColon);
-                    else if (token.content == ",")
-                        tokens.emplace_back("", ParserToken_SeparatorComma);
-                    else if (token.content == ".")
-                        tokens.emplace_back("", ParserToken_SeparatorDot);
-                    else if (token.content == "...")
-                        tokens.emplace_back("", ParserToken_SeparatorTripleDot);
-                    break;
-                case LexerToken_Identifier:
-                    // Boolean
-                    if (token.content == "true" || token.content == "false")
-                        tokens.emplace_back(token.content, ParserToken_LiteralValueBoolean);
-                    // Keywords
-                    else if (token.content == "func")
-                        tokens.emplace_back("", ParserToken_KeywordFunction);
-                    else if (token.content == "var")
-                        tokens.emplace_back("", ParserToken_KeywordVar);
-                    else if (token.content == "let")
-                        tokens.emplace_back("", ParserToken_KeywordLet);
-                    else if (token.content == "for")
-                        tokens.emplace_back("", ParserToken_KeywordFor);
-                    else if (token.content == "by")
-                        tokens.emplace_back("", ParserToken_KeywordBy);
-                    else if (token.content == "do")
-                        tokens.emplace_back("", ParserToken_KeywordDo);
-                    else if (token.content == "while")
-                        tokens.emplace_back("", ParserToken_KeywordWhile);
-                    else if (token.content == "switch")
-                        tokens.emplace_back("", ParserToken_KeywordSwitch);
-                    else if (token.content == "case")
-                        tokens.emplace_back("", ParserToken_KeywordCase);
-                    else if (token.content == "return")
-                        tokens.emplace_back("", ParserToken_KeywordReturn);
-                    else if (token.content == "if")
-                        tokens.emplace_back("", ParserToken_KeywordIf);
-                    else if (token.content == "else")
-                        tokens.emplace_back("", ParserToken_KeywordElse);
-                    else if (token.content == "break")
-                        tokens.emplace_back("", ParserToken_KeywordBreak);
-                    else if (token.content == "continue")
-                        tokens.emplace_back("", ParserToken_KeywordContinue);
-                    else if (token.content == "namespace")
-                        tokens.emplace_back("", ParserToken_KeywordNamespace);
-                    else if (token.content == "default")
-                        tokens.emplace_back("", ParserToken_KeywordDefault);
-                    else if (token.content == "_")
-                        tokens.emplace_back("", ParserToken_KeywordEmpty);
-                    else
-                        tokens.emplace_back(token.content, ParserToken_Identifier);
-                    break;
-                case LexerToken_Space:
-                    tokens.emplace_back("", ParserToken_Space);
-                    break;
-                case LexerToken_Newline:
-                    tokens.emplace_back("", ParserToken_Newline);
-                    break;
-                default:
-                    tokens.emplace_back(token.content, ParserToken_Unknown);
-                    break;
-            }
-
-            if (token.type != LexerToken_Space && token.type != LexerToken_Newline) {
-                lastToken = token;
+    bool Parser::parseTopLevel(ASTContext& context, TokenStream& tokens, Node*& node) {
+        m_context = &context;
+        m_tokens = &tokens;
+        
+        while (true) {
+            getNextToken();
+            
+            if (m_currentToken->type == ParserToken_EOF) {
+                break;
+            } else if (m_currentToken->type == ParserToken_KeywordFunction) {
+                node = parseFunction();
+            } else if (m_currentToken->type == ParserToken_KeywordNamespace) {
+                node = parseNamespace();
+            } else if (m_currentToken->type == ParserToken_KeywordVar) {
+                node = parseVariableDeclaration();
+            } else if (m_currentToken->type == ParserToken_KeywordLet) {
+                node = parseVariableDeclaration(true);
+            } else {
+                continue;
             }
+            
+            m_context = nullptr;
+            m_tokens = nullptr;
+            m_currentToken = nullptr;
+            
+            return true;
         }
+        
+        m_context = nullptr;
+        m_tokens = nullptr;
+        m_currentToken = nullptr;
+        
+        return false;
+    }
     
-        tokens.emplace_back("", ParserToken_EOF);
+    const ParserToken& Parser::getCurrentToken() {
+        return *m_currentToken;
+    }
 
-        return tokens;
+    std::string_view Parser::getCurrentTokenContent() {
+        return getLexer().getContent(*m_currentToken);
     }
 
-    ParserToken Parser::getCurrentToken() {
-        return m_currentToken;
+    const ParserToken& Parser::getNextToken() {
+        m_currentToken = &m_tokens->next();
+
+        return *m_currentToken;
     }
 
-    ParserToken Parser::getNextToken(bool incrementCounter) {
-        if (incrementCounter) {
-            m_currentToken = m_tokens[++m_currentTokenIndex];
-    
-            if (m_currentToken.type == ParserToken_Newline) {
-                m_currentLine++;
-                m_currentColumn = 0;
-            } else {
-                if (m_currentToken.content.empty()) {
-                    m_currentColumn++;
-                } else {
-                    m_currentColumn += m_currentToken.content.size();
-                }
+    const ParserToken& Parser::peekToken(size_t n) {
+        return m_tokens->peek(n);
+    }
+
+    void Parser::setThreadCount(size_t threadCount) {
+        m_threadCount = threadCount;
+    }
+
+    void Parser::setLazyBodies(bool lazyBodies) {
+        m_isLazyBodies = lazyBodies;
+    }
+
+    void Parser::parseLazyBody(ASTContext& context, NodeTopFunction* node) {
+        if (node->lazyBody.empty())
+            return;
+
+        auto tokens = std::move(node->lazyBody);
+        const auto& lastToken = tokens.back();
+        TokenStream stream(tokens.data(), tokens.data() + tokens.size(), lastToken.offset + lastToken.length);
+
+        node->lazyBody.clear();
+
+        m_context = &context;
+        m_tokens = &stream;
+
+        node->body = parseBody();
+
+        addImplicitReturn(node->type, node->body);
+
+        m_context = nullptr;
+        m_tokens = nullptr;
+        m_currentToken = nullptr;
+
+        node->children = node->body;
+
+        setParent(node);
+    }
+
+    void Parser::parseParallel(ASTContext& context, TokenStream& tokens) {
+        struct Declaration {
+            size_t start;
+            // Index of the token following the declaration, where parseTopLevel would go on from.
+            size_t end = 0;
+            Node* node = nullptr;
+            bool isIncomplete = false;
+            std::vector<std::pair<size_t, std::string>> errors;
+        };
+
+        const auto begin = tokens.getPendingBegin();
+        const auto size = static_cast<size_t>(tokens.getPendingEnd() - begin);
+        std::vector<Declaration> declarations;
+        size_t depth = 0;
+
+        // Skimming: declarations start with a keyword outside of any braces.
+        for (size_t i = 0; i < size; i++) {
+            const auto type = begin[i].type;
+
+            if (type == ParserToken_SeparatorCurlyBracketOpen) {
+                depth++;
+            } else if (type == ParserToken_SeparatorCurlyBracketClosed) {
+                depth -= depth > 0 ? 1 : 0;
+            } else if (depth == 0 && isTopLevelKeyword(type)) {
+                declarations.push_back({ i, 0, nullptr, false, {} });
             }
-    
-            while (m_currentToken.type == ParserToken_Space) {
-                m_currentToken = m_tokens[++m_currentTokenIndex];
-        
-                if (m_currentToken.type == ParserToken_Newline) {
-                    m_currentLine++;
-                    m_currentColumn = 0;
-                } else {
-                    if (m_currentToken.content.empty()) {
-                        m_currentColumn++;
-                    } else {
-                        m_currentColumn += m_currentToken.content.size();
-                    }
-                }
+        }
+
+        auto threadCount = m_threadCount != 0 ? m_threadCount : std::thread::hardware_concurrency();
+
+        threadCount = std::max<size_t>(std::min<size_t>(threadCount, declarations.size()), 1);
+
+        std::vector<ASTContext> contexts(threadCount);
+        std::vector<std::thread> threads;
+        std::atomic<size_t> next { 0 };
+
+        // Declarations are handed out one at a time, the long ones do not hold back a whole share of the file.
+        const auto parseDeclarations = [&](ASTContext& chunkContext) {
+            Parser parser;
+
+            parser.m_isChunk = true;
+            parser.m_isLazyBodies = m_isLazyBodies;
+
+            for (auto i = next++; i < declarations.size(); i = next++) {
+                auto& declaration = declarations[i];
+                TokenStream stream(begin + declaration.start, begin + size, tokens.getEndOffset());
+
+                parser.parseTopLevel(chunkContext, stream, declaration.node);
+
+                declaration.end = std::min(declaration.start + stream.getPosition(), size);
+                declaration.isIncomplete = parser.m_isChunkIncomplete;
+                declaration.errors = std::move(parser.m_chunkErrors);
+
+                parser.m_isChunkIncomplete = false;
+                parser.m_chunkErrors.clear();
             }
-    
-            return m_currentToken;
-        } else {
-            auto counter = m_currentTokenIndex;
-            auto currentToken = m_tokens[++counter];
-    
-            while (currentToken.type == ParserToken_Space) {
-                currentToken = m_tokens[++counter];
+        };
+
+        for (size_t i = 1; i < threadCount; i++)
+            threads.emplace_back(parseDeclarations, std::ref(contexts[i]));
+
+        parseDeclarations(contexts[0]);
+
+        for (auto& thread : threads)
+            thread.join();
+
+        for (auto& chunkContext : contexts)
+            context.merge(chunkContext);
+
+        // Stitching: follow the declarations the way parseTopLevel goes from one to the next.
+        size_t position = 0;
+        size_t index = 0;
+
+        while (true) {
+            while (position < size && !isTopLevelKeyword(begin[position].type))
+                position++;
+
+            if (position == size)
+                break;
+
+            while (index < declarations.size() && declarations[index].start < position)
+                index++;
+
+            if (index < declarations.size() && declarations[index].start == position &&
+                !declarations[index].isIncomplete) {
+                auto& declaration = declarations[index];
+
+                for (auto& error : declaration.errors)
+                    reportError(error.first, std::move(error.second));
+
+                m_nodes.emplace_back(declaration.node);
+                position = declaration.end;
+
+                continue;
             }
-    
-            return currentToken;
+
+            TokenStream stream(begin + position, begin + size, tokens.getEndOffset());
+            Node* node = nullptr;
+
+            parseTopLevel(context, stream, node);
+
+            m_nodes.emplace_back(node);
+            position = std::min(position + stream.getPosition(), size);
         }
     }
-    
-    int Parser::getOperatorPrecedence(ParserTokenEnum binaryOperator) {
-        if(m_binaryOperatorPrecedence.find(binaryOperator) == m_binaryOperatorPrecedence.end())
-            return -1;
-        else
-            return m_binaryOperatorPrecedence[binaryOperator] <= 0 ? -1 : m_binaryOperatorPrecedence[binaryOperator];
+
+    void Parser::reportError(size_t offset, std::string message) {
+        if (m_isChunk) {
+            m_chunkErrors.emplace_back(offset, std::move(message));
+            return;
+        }
+
+        const auto position = getLexer().getSource()->getPosition(offset);
+
+        LOG_ERROR(position.line, ":", position.column, " ", message)
     }
 
-    std::shared_ptr<NodeTopFunction> Parser::parseFunction() {
-        std::string name;
-        std::string type;
+    Symbol Parser::internSymbol(std::string_view name) {
+        if (!m_isChunk)
+            return getSymbolTable().intern(name);
+
+        const auto symbol = getSymbolTable().find(name);
+
+        if (symbol == Symbol_Empty)
+            m_isChunkIncomplete = true;
+
+        return symbol;
+    }
+    
+    NodeTopFunction* Parser::parseFunction() {
+        Symbol name = Symbol_Empty;
+        Symbol type = Symbol_Empty;
         std::vector<Argument> arguments;
 
         getNextToken();
         
-        if (m_currentToken.type == ParserToken_Identifier) {
-            name = m_currentToken.content;
+        if (m_currentToken->type == ParserToken_Identifier) {
+            name = m_currentToken->symbol;
         } else {
             PARSER_ERROR("Expected an identifier.")
         }
 
         getNextToken();
 
-        if (m_currentToken.type != ParserToken_SeparatorRoundBracketOpen) {
+        if (m_currentToken->type != ParserToken_SeparatorRoundBracketOpen) {
             PARSER_ERROR("Expected an opened round bracket.")
         }
 
         while (true) {
             getNextToken();
 
-            if (m_currentToken.type == ParserToken_SeparatorRoundBracketClosed)
+            if (m_currentToken->type == ParserToken_SeparatorRoundBracketClosed)
                 break;
-            else if (m_currentToken.type == ParserToken_Identifier) {
-                auto identifier = m_currentToken.content;
+            else if (m_currentToken->type == ParserToken_Identifier) {
+                auto identifier = m_currentToken->symbol;
 
                 getNextToken();
                 PARSER_CHECKTOKEN(ParserToken_SeparatorColon)
@@ -361,9 +339,9 @@ namespace Aryiele {
                 getNextToken();
                 PARSER_CHECKTOKEN(ParserToken_Identifier)
 
-                arguments.emplace_back(Argument(identifier, m_currentToken.content));
+                arguments.emplace_back(Argument(identifier, m_currentToken->symbol));
             }
-            else if (m_currentToken.type == ParserToken_SeparatorComma) {
+            else if (m_currentToken->type == ParserToken_SeparatorComma) {
                 continue;
             }
             else {
@@ -373,88 +351,116 @@ namespace Aryiele {
 
         getNextToken();
         
-        if (m_currentToken.type == ParserToken_SeparatorColon) {
+        if (m_currentToken->type == ParserToken_SeparatorColon) {
             PARSER_CHECKTOKEN(ParserToken_SeparatorColon)
     
             getNextToken();
     
-            if (m_currentToken.type == ParserToken_Identifier)
-                type = m_currentToken.content;
+            if (m_currentToken->type == ParserToken_Identifier)
+                type = m_currentToken->symbol;
             else {
                 PARSER_ERROR("Expected a type name")
             }
     
             getNextToken();
             
-            while (m_currentToken.type == ParserToken_Newline) {
+            while (m_currentToken->type == ParserToken_Newline) {
                 getNextToken();
             }
     
             PARSER_CHECKTOKEN(ParserToken_SeparatorCurlyBracketOpen)
-        } else if (m_currentToken.type == ParserToken_SeparatorCurlyBracketOpen) {
-            type = "Void";
+        } else if (m_currentToken->type == ParserToken_SeparatorCurlyBracketOpen) {
+            type = Symbol_Void;
         } else {
             PARSER_ERROR("expected either identifier or opened curly bracket")
         }
         
-        auto expressions = parseBody();
-        
-        if (type == "Void") {
-            bool hasReturn = false;
-            
-            for (auto& statement : expressions) {
-                if (statement->getType() == Node_StatementReturn) {
-                    hasReturn = true;
+        if (m_isLazyBodies) {
+            std::vector<ParserToken> body;
+            size_t depth = 1;
+
+            while (depth > 0) {
+                getNextToken();
+
+                if (m_currentToken->type == ParserToken_EOF) {
+                    PARSER_REPORT("unexpected end of file, expected '}'")
+
+                    body.clear();
+                    break;
+                } else if (m_currentToken->type == ParserToken_SeparatorCurlyBracketOpen) {
+                    depth++;
+                } else if (m_currentToken->type == ParserToken_SeparatorCurlyBracketClosed) {
+                    depth--;
                 }
+
+                body.emplace_back(*m_currentToken);
             }
-            
-            if (!hasReturn) {
-                expressions.emplace_back(std::make_shared<NodeStatementReturn>());
-            }
+
+            auto function = m_context->create<NodeTopFunction>(name, type, arguments, std::vector<Node*>());
+
+            function->lazyBody = std::move(body);
+
+            return function;
         }
 
-        return std::make_shared<NodeTopFunction>(name, type, arguments, expressions);
+        auto expressions = parseBody();
+        
+        addImplicitReturn(type, expressions);
+
+        return m_context->create<NodeTopFunction>(name, type, arguments, expressions);
+    }
+
+    void Parser::addImplicitReturn(Symbol type, std::vector<Node*>& body) {
+        if (type != Symbol_Void)
+            return;
+
+        for (auto& statement : body) {
+            if (statement->getType() == Node_StatementReturn)
+                return;
+        }
+
+        body.emplace_back(m_context->create<NodeStatementReturn>());
     }
     
-    std::shared_ptr<Node> Parser::parseNamespace() {
-        auto identifier = std::string();
-        std::vector<std::shared_ptr<Node>> nodes;
+    Node* Parser::parseNamespace() {
+        Symbol identifier = Symbol_Empty;
+        std::vector<Node*> nodes;
         
         getNextToken();
         
-        if (m_currentToken.type != ParserToken_Identifier) {
+        if (m_currentToken->type != ParserToken_Identifier) {
             PARSER_ERROR("expected identifier in namespace declaration")
         }
         
-        identifier = m_currentToken.content;
+        identifier = m_currentToken->symbol;
         
         getNextToken();
         
-        if (m_currentToken.type != ParserToken_SeparatorCurlyBracketOpen) {
+        if (m_currentToken->type != ParserToken_SeparatorCurlyBracketOpen) {
             PARSER_ERROR("expected opened curly bracket after namespace declaration")
         }
         
         while (true) {
             getNextToken();
             
-            while (m_currentToken.type == ParserToken_Newline) {
+            while (m_currentToken->type == ParserToken_Newline) {
                 getNextToken();
             }
             
-            if (m_currentToken.type == ParserToken_KeywordFunction) {
+            if (m_currentToken->type == ParserToken_KeywordFunction) {
                 nodes.emplace_back(parseFunction());
-            } else if (m_currentToken.type == ParserToken_KeywordNamespace) {
+            } else if (m_currentToken->type == ParserToken_KeywordNamespace) {
                 nodes.emplace_back(parseNamespace());
             } else {
                 break;
             }
         }
         
-        return std::make_shared<NodeTopNamespace>(identifier, nodes);
+        return m_context->create<NodeTopNamespace>(identifier, nodes);
     }
 
-    std::shared_ptr<Node> Parser::parsePrimary() {
-        switch (m_currentToken.type) {
+    Node* Parser::parsePrimary() {
+        switch (m_currentToken->type) {
             case ParserToken_LiteralValueInteger:
                 return parseInteger();
             case ParserToken_LiteralValueDecimal:
@@ -465,8 +471,6 @@ namespace Aryiele {
                 return parseCharacter();
             case ParserToken_LiteralValueBoolean:
                 return parseBoolean();
-            case ParserToken_SeparatorRoundBracketOpen:
-                return parseParenthese();
             case ParserToken_KeywordReturn:
                 return parseReturn();
             case ParserToken_KeywordIf:
@@ -493,109 +497,131 @@ namespace Aryiele {
                 return parseContinue();
             case ParserToken_SeparatorSquareBracketOpen:
                 return parseArray();
-            case ParserToken_OperatorUnaryArithmeticMinus:
-            case ParserToken_OperatorUnaryArithmeticPlus:
-            case ParserToken_OperatorUnaryArithmeticIncrement:
-            case ParserToken_OperatorUnaryArithmeticDecrement:
-            case ParserToken_OperatorUnaryLogicalNot:
-                return parseUnaryOperation();
             default:
                 return nullptr;
         }
     }
 
-    std::shared_ptr<Node> Parser::parseExpression() {
-        auto leftExpression = parsePrimary();
-    
-        if (!leftExpression) {
-            return nullptr;
-        }
-    
-        if (m_currentToken.type == ParserToken_OperatorUnaryArithmeticIncrement ||
-            m_currentToken.type == ParserToken_OperatorUnaryArithmeticDecrement) {
-            auto unaryExpression = std::make_shared<NodeOperationUnary>(m_currentToken.type, leftExpression, false);
-            getNextToken();
-            return parseBinaryOperation(0, unaryExpression);
-        }
-        
-        return parseBinaryOperation(0, leftExpression);
-    }
-    
-    std::shared_ptr<Node> Parser::parseTernaryOperation(std::shared_ptr<Node> condition) {
-        getNextToken();
-    
-        auto leftExpression = parseExpression();
+    Node* Parser::parseExpression() {
+        const auto base = m_pendingOperations.size();
+        uint8_t power = 0;
         
-        if (m_currentToken.type != ParserToken_SeparatorColon) {
-            PARSER_ERROR("expected ':' in ternary operation")
-        }
-        
-        getNextToken();
-        
-        auto rightExpression = parseExpression();
+        const auto fail = [&]() -> Node* {
+            m_pendingOperations.resize(base);
+            
+            return nullptr;
+        };
         
-        return std::make_shared<NodeOperationTernary>(condition, leftExpression, rightExpression);
-    }
-    
-    std::shared_ptr<Node> Parser::parseBinaryOperation(int expressionPrecedence, std::shared_ptr<Node> leftExpression) {
         while (true) {
-            if (m_currentToken.type == ParserToken_OperatorQuestionMark) {
-                return parseTernaryOperation(leftExpression);
+            // Prefix operators and parentheses each start an expression of their own.
+            while (true) {
+                const auto type = m_currentToken->type;
+                
+                if (ParserPrecedences[type].prefix != 0) {
+                    m_pendingOperations.push_back({ ParserPending_Unary, type, power, nullptr, nullptr });
+                    power = ParserPrecedences[type].prefix;
+                } else if (type == ParserToken_SeparatorRoundBracketOpen) {
+                    m_pendingOperations.push_back({ ParserPending_Parenthese, type, power, nullptr, nullptr });
+                    power = 0;
+                } else {
+                    break;
+                }
+                
+                getNextToken();
             }
             
-            int tokenPrecedence = getOperatorPrecedence(m_currentToken.type);
-    
-            if (tokenPrecedence < expressionPrecedence)
-                return leftExpression;
-    
-            auto operationType = m_currentToken.type;
+            auto expression = parsePrimary();
             
-            getNextToken();
+            if (!expression)
+                return fail();
             
-            auto rightExpression = parsePrimary();
-
-            if (!rightExpression)
-                return nullptr;
-
-            int nextPrecedence = getOperatorPrecedence(m_currentToken.type);
-
-            if (tokenPrecedence < nextPrecedence) {
-                rightExpression = parseBinaryOperation(tokenPrecedence + 1, std::move(rightExpression));
-
-                if (!rightExpression)
-                    return nullptr;
+            // Fold the operations that end here, until one needs an operand on its right.
+            while (true) {
+                const auto type = m_currentToken->type;
+                const auto& precedence = ParserPrecedences[type];
+                
+                if (precedence.left != 0 && precedence.left >= power) {
+                    getNextToken();
+                    
+                    if (precedence.right == 0) {
+                        expression = m_context->create<NodeOperationUnary>(type, expression, false);
+                        
+                        continue;
+                    }
+                    
+                    if (type == ParserToken_OperatorQuestionMark) {
+                        m_pendingOperations.push_back({ ParserPending_TernaryThen, type, power, expression, nullptr });
+                        power = 0;
+                    } else {
+                        m_pendingOperations.push_back({ ParserPending_Binary, type, power, nullptr, expression });
+                        power = precedence.right;
+                    }
+                    
+                    break;
+                }
+                
+                if (m_pendingOperations.size() == base)
+                    return expression;
+                
+                const auto pending = m_pendingOperations.back();
+                
+                m_pendingOperations.pop_back();
+                power = pending.power;
+                
+                if (pending.type == ParserPending_TernaryThen) {
+                    if (m_currentToken->type != ParserToken_SeparatorColon) {
+                        PARSER_REPORT("expected ':' in ternary operation")
+                        
+                        return fail();
+                    }
+                    
+                    getNextToken();
+                    
+                    m_pendingOperations.push_back({ ParserPending_TernaryElse, pending.operation, power,
+                        pending.condition, expression });
+                    power = ParserPrecedences[ParserToken_OperatorQuestionMark].right;
+                    
+                    break;
+                }
+                
+                switch (pending.type) {
+                    case ParserPending_Unary:
+                        expression = m_context->create<NodeOperationUnary>(pending.operation, expression);
+                        break;
+                    case ParserPending_Parenthese:
+                        if (m_currentToken->type != ParserToken_SeparatorRoundBracketClosed) {
+                            PARSER_REPORT("expected ')'")
+                            
+                            return fail();
+                        }
+                        
+                        getNextToken();
+                        break;
+                    case ParserPending_Binary:
+                        expression = m_context->create<NodeOperationBinary>(pending.operation, pending.lhs, expression);
+                        break;
+                    default:
+                        expression = m_context->create<NodeOperationTernary>(pending.condition, pending.lhs, expression);
+                        break;
+                }
             }
-
-            leftExpression = std::make_shared<NodeOperationBinary>(operationType, std::move(leftExpression), rightExpression);
         }
     }
-    
-    std::shared_ptr<Node> Parser::parseUnaryOperation() {
-        if (m_currentToken.type != ParserToken_OperatorUnaryArithmeticPlus &&
-            m_currentToken.type != ParserToken_OperatorUnaryArithmeticMinus &&
-            m_currentToken.type != ParserToken_OperatorUnaryArithmeticIncrement &&
-            m_currentToken.type != ParserToken_OperatorUnaryArithmeticDecrement &&
-            m_currentToken.type != ParserToken_OperatorUnaryLogicalNot) {
-            return parsePrimary();
-        }
-        
-        auto type = m_currentToken.type;
-        
-        getNextToken();
-        
-        auto operand = parseUnaryOperation();
-        
-        return std::make_shared<NodeOperationUnary>(type, operand);
-    }
 
-    std::vector<std::shared_ptr<Node>> Parser::parseBody() {
-        std::vector<std::shared_ptr<Node>> expressions;
+    std::vector<Node*> Parser::parseBody() {
+        std::vector<Node*> expressions;
 
         while (true) {
             getNextToken();
             
-            if (m_currentToken.type == ParserToken_SeparatorCurlyBracketClosed)
+            if (m_currentToken->type == ParserToken_SeparatorCurlyBracketClosed)
+                break;
+
+            // The stream returns EOF forever, an unclosed body would never end.
+            if (m_currentToken->type == ParserToken_EOF) {
+                PARSER_REPORT("unexpected end of file, expected '}'")
                 break;
+            }
 
             auto expression = parseExpression();
 
@@ -606,15 +632,20 @@ namespace Aryiele {
         return expressions;
     }
     
-    std::vector<std::shared_ptr<Node>> Parser::parseCase() {
-        std::vector<std::shared_ptr<Node>> expressions;
+    std::vector<Node*> Parser::parseCase() {
+        std::vector<Node*> expressions;
     
         while (true) {
             getNextToken();
         
-            if (m_currentToken.type == ParserToken_SeparatorCurlyBracketClosed ||
-                m_currentToken.type == ParserToken_KeywordCase ||
-                m_currentToken.type == ParserToken_KeywordDefault) {
+            if (m_currentToken->type == ParserToken_SeparatorCurlyBracketClosed ||
+                m_currentToken->type == ParserToken_KeywordCase ||
+                m_currentToken->type == ParserToken_KeywordDefault) {
+                break;
+            }
+        
+            if (m_currentToken->type == ParserToken_EOF) {
+                PARSER_REPORT("unexpected end of file, expected '}'")
                 break;
             }
         
@@ -628,92 +659,95 @@ namespace Aryiele {
         return expressions;
     }
 
-    std::shared_ptr<Node> Parser::parseInteger() {
-        auto result = std::make_shared<NodeLiteralNumberInteger>(std::stoi(m_currentToken.content));
+    Node* Parser::parseInteger() {
+        auto result = m_context->create<NodeLiteralNumberInteger>(getLexer().getInteger(*m_currentToken),
+                                                                  getLexer().isUnsignedInteger(*m_currentToken));
 
         getNextToken();
 
         return result;
     }
 
-    std::shared_ptr<Node> Parser::parseDouble() {
-        auto result = std::make_shared<NodeLiteralNumberFloating>(std::stod(m_currentToken.content));
+    Node* Parser::parseDouble() {
+        auto result = m_context->create<NodeLiteralNumberFloating>(getLexer().getDecimal(*m_currentToken));
 
         getNextToken();
 
         return result;
     }
     
-    std::shared_ptr<Node> Parser::parseString() {
-        auto result = std::make_shared<NodeLiteralString>(m_currentToken.content);
+    Node* Parser::parseString() {
+        auto result = m_context->create<NodeLiteralString>(std::string(getCurrentTokenContent()));
         
         getNextToken();
         
         return result;
     }
     
-    std::shared_ptr<Node> Parser::parseCharacter() {
-        auto result = std::make_shared<NodeLiteralCharacter>(m_currentToken.content);
+    Node* Parser::parseCharacter() {
+        auto result = m_context->create<NodeLiteralCharacter>(std::string(getCurrentTokenContent()));
         
         getNextToken();
         
         return result;
     }
     
-    std::shared_ptr<Node> Parser::parseBoolean() {
-        auto result = std::make_shared<NodeLiteralNumberFloating>(m_currentToken.content == "true");
+    Node* Parser::parseBoolean() {
+        auto result = m_context->create<NodeLiteralBoolean>(getCurrentTokenContent() == "true");
         
         getNextToken();
         
         return result;
     }
     
-    std::shared_ptr<Node> Parser::parseArray() {
+    Node* Parser::parseArray() {
         getNextToken();
-        std::vector<std::shared_ptr<Node>> elements;
+        std::vector<Node*> elements;
         
         while (true) {
-            if (m_currentToken.type == ParserToken_SeparatorSquareBracketClosed) {
+            if (m_currentToken->type == ParserToken_SeparatorSquareBracketClosed) {
                 break;
-            } else if (m_currentToken.type == ParserToken_SeparatorComma) {
+            } else if (m_currentToken->type == ParserToken_SeparatorComma) {
                 getNextToken();
+            } else if (auto element = parseExpression()) {
+                elements.emplace_back(element);
             } else {
-                elements.emplace_back(parseExpression());
+                return nullptr;
             }
         }
         
-        return std::make_shared<NodeLiteralArray>(elements);
+        return m_context->create<NodeLiteralArray>(elements);
     }
     
-    std::shared_ptr<Node> Parser::parseArrayCall() {
+    Node* Parser::parseArrayCall() {
         getNextToken();
         
         auto expression = parseExpression();
-        std::shared_ptr<Node> subexpression = nullptr;
+        Node* subexpression = nullptr;
         
         getNextToken();
         
-        if (m_currentToken.type == ParserToken_SeparatorDot) {
+        if (m_currentToken->type == ParserToken_SeparatorDot) {
             getNextToken();
     
             subexpression = parseExpression();
         }
     
-        return std::make_shared<NodeStatementArrayCall>(expression, subexpression);
+        return m_context->create<NodeStatementArrayCall>(expression, subexpression);
     }
 
-    std::shared_ptr<Node> Parser::parseIdentifier() {
-        auto identifier = m_currentToken.content;
-        std::shared_ptr<Node> subExpression = nullptr;
+    Node* Parser::parseIdentifier() {
+        auto identifier = m_currentToken->symbol;
+        Node* subExpression = nullptr;
         
         getNextToken();
         
-        if (m_currentToken.type == ParserToken_SeparatorRoundBracketOpen) {
+        if (m_currentToken->type == ParserToken_SeparatorRoundBracketOpen) {
             getNextToken();
 
-            std::vector<std::shared_ptr<Node>> arguments;
+            std::vector<Node*> arguments;
 
-            if (m_currentToken.type != ParserToken_SeparatorRoundBracketClosed) {
+            if (m_currentToken->type != ParserToken_SeparatorRoundBracketClosed) {
                 while (true) {
                     if (auto arg = parseExpression()) {
                         arguments.emplace_back(arg);
@@ -721,11 +755,11 @@ namespace Aryiele {
                         return nullptr;
                     }
 
-                    if (m_currentToken.type == ParserToken_SeparatorRoundBracketClosed) {
+                    if (m_currentToken->type == ParserToken_SeparatorRoundBracketClosed) {
                         break;
                     }
 
-                    if (m_currentToken.type != ParserToken_SeparatorComma) {
+                    if (m_currentToken->type != ParserToken_SeparatorComma) {
                         PARSER_ERROR("Expected ')' or ',' in argument list")
                     }
 
@@ -735,23 +769,23 @@ namespace Aryiele {
 
             getNextToken();
             
-            if (m_currentToken.type == ParserToken_SeparatorDot) {
+            if (m_currentToken->type == ParserToken_SeparatorDot) {
                 getNextToken();
     
                 subExpression = parseExpression();
-            } else if (m_currentToken.type == ParserToken_SeparatorSquareBracketOpen) {
+            } else if (m_currentToken->type == ParserToken_SeparatorSquareBracketOpen) {
                 subExpression = parseArrayCall();
             }
             
-            return std::make_shared<NodeStatementFunctionCall>(identifier, arguments, subExpression);
-        } else if (m_currentToken.type == ParserToken_SeparatorSquareBracketOpen) {
+            return m_context->create<NodeStatementFunctionCall>(identifier, arguments, subExpression);
+        } else if (m_currentToken->type == ParserToken_SeparatorSquareBracketOpen) {
             subExpression = parseArrayCall();
         }
         
-        return std::make_shared<NodeStatementVariable>(identifier, subExpression);
+        return m_context->create<NodeStatementVariable>(identifier, subExpression);
     }
 
-    std::shared_ptr<Node> Parser::parseParenthese() {
+    Node* Parser::parseParenthese() {
         getNextToken();
         
         auto expression = parseExpression();
@@ -761,22 +795,22 @@ namespace Aryiele {
         return expression;
     }
 
-    std::shared_ptr<Node> Parser::parseReturn() {
+    Node* Parser::parseReturn() {
         getNextToken();
         
-        if (m_currentToken.type == ParserToken_SeparatorSemicolon || m_currentToken.type == ParserToken_Newline) {
-            return std::make_shared<NodeStatementReturn>(nullptr);
+        if (m_currentToken->type == ParserToken_SeparatorSemicolon || m_currentToken->type == ParserToken_Newline) {
+            return m_context->create<NodeStatementReturn>(nullptr);
         }
     
-        return std::make_shared<NodeStatementReturn>(parseExpression());
+        return m_context->create<NodeStatementReturn>(parseExpression());
     }
 
-    std::shared_ptr<Node> Parser::parseIf() {
+    Node* Parser::parseIf() {
         getNextToken();
         
-        std::shared_ptr<Node> condition;
+        Node* condition = nullptr;
         
-        if (m_currentToken.type == ParserToken_SeparatorRoundBracketOpen) {
+        if (m_currentToken->type == ParserToken_SeparatorRoundBracketOpen) {
             condition = parseParenthese();
         } else {
             condition = parseExpression();
@@ -792,13 +826,13 @@ namespace Aryiele {
 
         PARSER_CHECKTOKEN(ParserToken_SeparatorCurlyBracketClosed)
 
-        std::vector<std::shared_ptr<Node>> elseBody;
+        std::vector<Node*> elseBody;
         
-        if (getNextToken(false).type == ParserToken_KeywordElse) {
+        if (peekToken().type == ParserToken_KeywordElse) {
             getNextToken();
             getNextToken();
     
-            if (m_currentToken.type == ParserToken_KeywordIf) {
+            if (m_currentToken->type == ParserToken_KeywordIf) {
                 elseBody.emplace_back(parseIf());
 
                 PARSER_CHECKTOKEN(ParserToken_SeparatorCurlyBracketClosed)
@@ -812,22 +846,22 @@ namespace Aryiele {
             }
         }
 
-        return std::make_shared<NodeStatementIf>(condition, ifBody, elseBody);
+        return m_context->create<NodeStatementIf>(condition, ifBody, elseBody);
     }
     
-    std::shared_ptr<Node> Parser::parseFor() {
-        std::shared_ptr<Node> incrementationValue;
+    Node* Parser::parseFor() {
+        Node* incrementationValue = nullptr;
         
         getNextToken();
         
-        if (m_currentToken.type == ParserToken_SeparatorRoundBracketOpen) {
+        if (m_currentToken->type == ParserToken_SeparatorRoundBracketOpen) {
             getNextToken();
         }
     
-        std::shared_ptr<Node> variable = nullptr;
+        Node* variable = nullptr;
         
-        if (m_currentToken.type != ParserToken_KeywordEmpty) {
-            if (getNextToken(false).type == ParserToken_OperatorEqual) {
+        if (m_currentToken->type != ParserToken_KeywordEmpty) {
+            if (peekToken().type == ParserToken_OperatorEqual) {
                 variable = parseVariableDeclaration(false, false, false);
             } else {
                 variable = parseIdentifier();
@@ -836,33 +870,33 @@ namespace Aryiele {
             getNextToken();
         }
     
-        if (m_currentToken.type != ParserToken_KeywordWhile) {
+        if (m_currentToken->type != ParserToken_KeywordWhile) {
             PARSER_ERROR("expected 'while' in for declaration")
         }
         
         getNextToken();
     
-        if (!isLiteralOrIdentifier(m_currentToken.type)) {
+        if (!isLiteralOrIdentifier(m_currentToken->type)) {
             PARSER_ERROR("expected literal value or identifier in for declaration")
         }
         
         auto condition = parseExpression();
         
-        if (m_currentToken.type == ParserToken_KeywordBy) {
+        if (m_currentToken->type == ParserToken_KeywordBy) {
             getNextToken();
     
-            if (!isLiteralOrIdentifier(m_currentToken.type)) {
+            if (!isLiteralOrIdentifier(m_currentToken->type)) {
                 PARSER_ERROR("expected literal value or identifier in by in for declaration")
             }
     
             incrementationValue = parseExpression();
         }
     
-        if (m_currentToken.type == ParserToken_SeparatorRoundBracketClosed) {
+        if (m_currentToken->type == ParserToken_SeparatorRoundBracketClosed) {
             getNextToken();
         }
         
-        if (m_currentToken.type != ParserToken_SeparatorCurlyBracketOpen) {
+        if (m_currentToken->type != ParserToken_SeparatorCurlyBracketOpen) {
             PARSER_ERROR("expected '{' in for declaration")
         }
     
@@ -871,15 +905,15 @@ namespace Aryiele {
         PARSER_CHECKTOKEN(ParserToken_SeparatorCurlyBracketClosed)
         
         if (variable) {
-            return std::make_shared<NodeStatementFor>(variable, condition, incrementationValue, body);
+            return m_context->create<NodeStatementFor>(variable, condition, incrementationValue, body);
         }
         
-        return std::make_shared<NodeStatementFor>(nullptr, condition, incrementationValue, body);
+        return m_context->create<NodeStatementFor>(nullptr, condition, incrementationValue, body);
     }
     
-    std::shared_ptr<Node> Parser::parseWhile(bool doOnce) {
-        std::vector<std::shared_ptr<Node>> body;
-        std::shared_ptr<Node> condition;
+    Node* Parser::parseWhile(bool doOnce) {
+        std::vector<Node*> body;
+        Node* condition = nullptr;
     
         getNextToken();
         
@@ -898,13 +932,13 @@ namespace Aryiele {
             
             getNextToken();
     
-            if (m_currentToken.type == ParserToken_SeparatorRoundBracketOpen) {
+            if (m_currentToken->type == ParserToken_SeparatorRoundBracketOpen) {
                 condition = parseParenthese();
             } else {
                 condition = parseExpression();
             }
         } else {
-            if (m_currentToken.type == ParserToken_SeparatorRoundBracketOpen) {
+            if (m_currentToken->type == ParserToken_SeparatorRoundBracketOpen) {
                 condition = parseParenthese();
             } else {
                 condition = parseExpression();
@@ -919,33 +953,33 @@ namespace Aryiele {
             PARSER_CHECKTOKEN(ParserToken_SeparatorCurlyBracketClosed)
         }
         
-        return std::make_shared<NodeStatementWhile>(doOnce, condition, body);
+        return m_context->create<NodeStatementWhile>(doOnce, condition, body);
     }
     
-    std::shared_ptr<Node> Parser::parseBlock() {
-        return std::make_shared<NodeStatementBlock>(parseBody());
+    Node* Parser::parseBlock() {
+        return m_context->create<NodeStatementBlock>(parseBody());
     }
     
-    std::shared_ptr<Node> Parser::parseBreak() {
+    Node* Parser::parseBreak() {
         getNextToken();
         
-        return std::make_shared<NodeStatementBreak>();
+        return m_context->create<NodeStatementBreak>();
     }
     
-    std::shared_ptr<Node> Parser::parseContinue() {
+    Node* Parser::parseContinue() {
         getNextToken();
         
-        return std::make_shared<NodeStatementContinue>();
+        return m_context->create<NodeStatementContinue>();
     }
     
-    std::shared_ptr<Node> Parser::parseSwitch() {
-        std::shared_ptr<Node> expression;
-        std::vector<std::shared_ptr<Node>> cases;
-        std::shared_ptr<NodeStatementCase> defaultCase = nullptr;
+    Node* Parser::parseSwitch() {
+        Node* expression = nullptr;
+        std::vector<Node*> cases;
+        NodeStatementCase* defaultCase = nullptr;
         
         getNextToken();
     
-        if (m_currentToken.type == ParserToken_SeparatorRoundBracketOpen) {
+        if (m_currentToken->type == ParserToken_SeparatorRoundBracketOpen) {
             expression = parseParenthese();
         } else {
             expression = parseExpression();
@@ -956,18 +990,18 @@ namespace Aryiele {
         getNextToken();
         
         while (true) {
-            if (m_currentToken.type == ParserToken_SeparatorCurlyBracketClosed) {
+            if (m_currentToken->type == ParserToken_SeparatorCurlyBracketClosed) {
                 break;
-            } else if (m_currentToken.type == ParserToken_Newline) {
+            } else if (m_currentToken->type == ParserToken_Newline) {
                 getNextToken();
-            } else if (m_currentToken.type == ParserToken_KeywordCase) {
-                std::shared_ptr<Node> expressionCase = nullptr;
-                std::vector<std::shared_ptr<Node>> bodyCase = std::vector<std::shared_ptr<Node>>();
+            } else if (m_currentToken->type == ParserToken_KeywordCase) {
+                Node* expressionCase = nullptr;
+                std::vector<Node*> bodyCase = std::vector<Node*>();
                 
                 getNextToken();
                 
     
-                if (m_currentToken.type == ParserToken_SeparatorRoundBracketOpen) {
+                if (m_currentToken->type == ParserToken_SeparatorRoundBracketOpen) {
                     expressionCase = parseParenthese();
                 } else {
                     expressionCase = parseExpression();
@@ -979,12 +1013,12 @@ namespace Aryiele {
     
                 bodyCase = parseCase();
                 
-                cases.emplace_back(std::make_shared<NodeStatementCase>(expressionCase, bodyCase));
-            } else if (m_currentToken.type == ParserToken_KeywordDefault) {
+                cases.emplace_back(m_context->create<NodeStatementCase>(expressionCase, bodyCase));
+            } else if (m_currentToken->type == ParserToken_KeywordDefault) {
                 if (defaultCase) {
                     PARSER_ERROR("default already defined in switch")
                 } else {
-                    std::vector<std::shared_ptr<Node>> bodyCase = std::vector<std::shared_ptr<Node>>();
+                    std::vector<Node*> bodyCase = std::vector<Node*>();
                     
                     getNextToken();
                     
@@ -994,18 +1028,18 @@ namespace Aryiele {
                     
                     bodyCase = parseCase();
                     
-                    cases.insert(cases.begin(), std::make_shared<NodeStatementCase>(nullptr, bodyCase));
+                    cases.insert(cases.begin(), m_context->create<NodeStatementCase>(nullptr, bodyCase));
                 }
             } else {
                 PARSER_ERROR("unexpected token in switch declaration")
             }
         }
         
-        return std::make_shared<NodeStatementSwitch>(expression, cases);
+        return m_context->create<NodeStatementSwitch>(expression, cases);
     }
     
-    std::shared_ptr<Node> Parser::parseVariableDeclaration(bool constant, bool passVar, bool multiple) {
-        std::vector<std::shared_ptr<Variable>> variables;
+    Node* Parser::parseVariableDeclaration(bool constant, bool passVar, bool multiple) {
+        std::vector<Variable*> variables;
 
         while (true) {
             if (passVar) {
@@ -1014,21 +1048,21 @@ namespace Aryiele {
             
             PARSER_CHECKTOKEN(ParserToken_Identifier)
 
-            auto identifier = m_currentToken.content;
-            auto type = std::string();
-            std::shared_ptr<Node> value = nullptr;
+            auto identifier = m_currentToken->symbol;
+            Symbol type = Symbol_Empty;
+            Node* value = nullptr;
             
             getNextToken();
             
-            if (m_currentToken.type == ParserToken_SeparatorColon) {
+            if (m_currentToken->type == ParserToken_SeparatorColon) {
                 getNextToken();
                 
-                if (m_currentToken.type == ParserToken_Identifier) {
-                    type = m_currentToken.content;
-                } else if (m_currentToken.type == ParserToken_SeparatorSquareBracketOpen) {
+                if (m_currentToken->type == ParserToken_Identifier) {
+                    type = m_currentToken->symbol;
+                } else if (m_currentToken->type == ParserToken_SeparatorSquareBracketOpen) {
                     getNextToken();
     
-                    type = "[" + m_currentToken.content + "]";
+                    type = internSymbol("[" + std::string(getCurrentTokenContent()) + "]");
                     
                     getNextToken();
                 } else {
@@ -1038,50 +1072,63 @@ namespace Aryiele {
                 getNextToken();
             }
 
-            if (m_currentToken.type == ParserToken_OperatorEqual) {
+            if (m_currentToken->type == ParserToken_OperatorEqual) {
                 getNextToken();
                 
                 value = parseExpression();
-            } else if (m_currentToken.type == ParserToken_OperatorArithmeticPlusEqual ||
-                m_currentToken.type == ParserToken_OperatorArithmeticMinusEqual ||
-                m_currentToken.type == ParserToken_OperatorArithmeticMultiplyEqual ||
-                m_currentToken.type == ParserToken_OperatorArithmeticDivideEqual ||
-                m_currentToken.type == ParserToken_OperatorArithmeticRemainderEqual) {
+            } else if (m_currentToken->type == ParserToken_OperatorArithmeticPlusEqual ||
+                m_currentToken->type == ParserToken_OperatorArithmeticMinusEqual ||
+                m_currentToken->type == ParserToken_OperatorArithmeticMultiplyEqual ||
+                m_currentToken->type == ParserToken_OperatorArithmeticDivideEqual ||
+                m_currentToken->type == ParserToken_OperatorArithmeticRemainderEqual) {
                 PARSER_ERROR("expected initializer before using differents assignment operators")
-            } else if (type.empty() && value == nullptr) {
+            } else if (type == Symbol_Empty && value == nullptr) {
                 PARSER_ERROR("variable declaration has empty type and value")
             }
     
-            if (!type.empty() || value != nullptr) {
-                variables.emplace_back(std::make_shared<Variable>(identifier, type, constant, value));
+            if (type != Symbol_Empty || value != nullptr) {
+                variables.emplace_back(m_context->create<Variable>(identifier, type, constant, value));
             }
             
-            if (!multiple || m_currentToken.type != ParserToken_SeparatorComma) {
+            if (!multiple || m_currentToken->type != ParserToken_SeparatorComma) {
                 break;
             }
         }
 
-        return std::make_shared<NodeStatementVariableDeclaration>(variables);
+        return m_context->create<NodeStatementVariableDeclaration>(variables);
     }
     
     bool Parser::isLiteral(ParserTokenEnum type) {
-        return m_currentToken.type == ParserToken_LiteralValueInteger ||
-               m_currentToken.type == ParserToken_LiteralValueDecimal ||
-               m_currentToken.type == ParserToken_LiteralValueString ||
-               m_currentToken.type == ParserToken_LiteralValueCharacter ||
-               m_currentToken.type == ParserToken_LiteralValueBoolean;
+        return type == ParserToken_LiteralValueInteger ||
+               type == ParserToken_LiteralValueDecimal ||
+               type == ParserToken_LiteralValueString ||
+               type == ParserToken_LiteralValueCharacter ||
+               type == ParserToken_LiteralValueBoolean;
     }
     
-    bool Parser::isLiteralOrIdentifier(ParserTokenEnum type) {
-        return m_currentToken.type == ParserToken_Identifier || isLiteral(type);
+    bool Parser::isTopLevelKeyword(ParserTokenEnum type) {
+        return type == ParserToken_KeywordFunction || type == ParserToken_KeywordNamespace ||
+            type == ParserToken_KeywordVar || type == ParserToken_KeywordLet;
     }
     
-    bool Parser::setParent(std::shared_ptr<Node> node) {
-        for (auto& child : node->children) {
-            if (child) {
-                child->parent = node;
+    bool Parser::isLiteralOrIdentifier(ParserTokenEnum type) {
+        return type == ParserToken_Identifier || isLiteral(type);
+    }
     
-                setParent(child);
+    void Parser::setParent(Node* node) {
+        // Expression chains can be as deep as they are long, no recursion.
+        std::vector<Node*> nodes { node };
+        
+        while (!nodes.empty()) {
+            node = nodes.back();
+            nodes.pop_back();
+            
+            for (auto& child : node->children) {
+                if (child) {
+                    child->parent = node;
+                    
+                    nodes.push_back(child);
+                }
             }
         }
     }
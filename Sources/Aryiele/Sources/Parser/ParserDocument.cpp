@@ -0,0 +1,145 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#include <algorithm>
+#include <Aryiele/Parser/ParserDocument.h>
+#include <Aryiele/Parser/Parser.h>
+#include <Aryiele/Lexer/Lexer.h>
+#include <Aryiele/Lexer/TokenStream.h>
+
+namespace Aryiele {
+    bool ParserDocument::open(const std::string& filepath) {
+        if (!getLexer().open(filepath))
+            return false;
+
+        while (getLexer().lexLine()) {}
+
+        getLexer().takeTokens(m_tokens);
+
+        m_path = filepath;
+        m_declarations.clear();
+        m_context.clear();
+
+        TokenStream tokens(m_tokens.data(), m_tokens.data() + m_tokens.size(),
+            static_cast<uint32_t>(getLexer().getSource()->getSize()));
+        Node* node = nullptr;
+        std::vector<Node*> nodes;
+
+        while (getParser().parseTopLevel(m_context, tokens, node)) {
+            m_declarations.push_back({ std::min(tokens.getPosition(), m_tokens.size()), node });
+            nodes.emplace_back(node);
+        }
+
+        m_file = m_context.create<NodeTopFile>(m_path, nodes);
+        m_root = m_context.create<NodeRoot>(std::vector<Node*> { m_file });
+        m_reparsedCount = m_declarations.size();
+
+        Parser::setParent(m_root);
+
+        return true;
+    }
+
+    SourceEditDamage ParserDocument::edit(const SourceEdit& edit) {
+        const auto damage = getLexer().relex(m_tokens, edit);
+        const auto tokenDelta = static_cast<int64_t>(damage.insertedCount) - static_cast<int64_t>(damage.removedCount);
+        const auto damageEnd = damage.first + damage.insertedCount;
+        const auto isBefore = [](const Declaration& declaration, int64_t end) {
+            return static_cast<int64_t>(declaration.end) < end;
+        };
+
+        // The parser looks one token ahead, so a declaration ending right before the damage is parsed again too.
+        const auto first = static_cast<size_t>(std::lower_bound(m_declarations.begin(), m_declarations.end(),
+            static_cast<int64_t>(damage.first), isBefore) - m_declarations.begin());
+        const auto start = first > 0 ? m_declarations[first - 1].end : size_t(0);
+        auto last = m_declarations.size();
+
+        TokenStream tokens(m_tokens.data() + start, m_tokens.data() + m_tokens.size(),
+            static_cast<uint32_t>(getLexer().getSource()->getSize()));
+        Node* node = nullptr;
+        std::vector<Declaration> declarations;
+
+        // Parse until a declaration ends past the damage where a previous one ended: the rest is unchanged.
+        while (getParser().parseTopLevel(m_context, tokens, node)) {
+            const auto end = std::min(start + tokens.getPosition(), m_tokens.size());
+
+            declarations.push_back({ end, node });
+
+            if (end < damageEnd)
+                continue;
+
+            const auto previousEnd = static_cast<int64_t>(end) - tokenDelta;
+            const auto previous = std::lower_bound(m_declarations.begin() + first, m_declarations.end(),
+                previousEnd, isBefore);
+
+            if (previous != m_declarations.end() && static_cast<int64_t>(previous->end) == previousEnd) {
+                last = static_cast<size_t>(previous - m_declarations.begin()) + 1;
+                break;
+            }
+        }
+
+        for (auto i = last; i < m_declarations.size(); i++)
+            m_declarations[i].end = static_cast<size_t>(static_cast<int64_t>(m_declarations[i].end) + tokenDelta);
+
+        m_declarations.erase(m_declarations.begin() + first, m_declarations.begin() + last);
+        m_declarations.insert(m_declarations.begin() + first, declarations.begin(), declarations.end());
+
+        std::vector<Node*> nodes;
+
+        for (auto& declaration : declarations) {
+            if (declaration.node) {
+                declaration.node->parent = m_file;
+
+                Parser::setParent(declaration.node);
+            }
+
+            nodes.emplace_back(declaration.node);
+        }
+
+        // The file node keeps its declarations twice, as its body and as its children.
+        m_file->body.erase(m_file->body.begin() + first, m_file->body.begin() + last);
+        m_file->body.insert(m_file->body.begin() + first, nodes.begin(), nodes.end());
+        m_file->children.erase(m_file->children.begin() + first, m_file->children.begin() + last);
+        m_file->children.insert(m_file->children.begin() + first, nodes.begin(), nodes.end());
+
+        m_reparsedCount = declarations.size();
+
+        return damage;
+    }
+
+    NodeRoot* ParserDocument::getRoot() const {
+        return m_root;
+    }
+
+    const std::vector<ParserToken>& ParserDocument::getTokens() const {
+        return m_tokens;
+    }
+
+    size_t ParserDocument::getReparsedCount() const {
+        return m_reparsedCount;
+    }
+
+} /* Namespace Aryiele. */
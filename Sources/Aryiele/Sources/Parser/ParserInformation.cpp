@@ -30,7 +30,7 @@
 namespace Aryiele {
     ParserInformation::ParserInformation(const std::shared_ptr<ParserInformation> parent, const std::string name,
                                          const std::vector<std::shared_ptr<ParserInformation>> children) :
-            parent(parent), name(name), children(children) {
+            parent(parent.get()), name(name), children(children) {
 
     }
 
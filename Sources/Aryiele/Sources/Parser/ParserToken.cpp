@@ -28,11 +28,6 @@
 #include <Aryiele/Parser/ParserToken.h>
 
 namespace Aryiele {
-    ParserToken::ParserToken(const std::string &content, Aryiele::ParserTokenEnum type) :
-        content(content), type(type) {
-
-    }
-    
     std::string ParserToken::getTypeName(ParserTokenEnum type) {
         switch (type) {
             case ParserToken_LiteralValueInteger:
@@ -157,8 +152,6 @@ namespace Aryiele {
             case ParserToken_KeywordEmpty:
                  return "KeywordEmpty";
                 
-            case ParserToken_Space:
-                return "Space";
             case ParserToken_Newline:
                 return "Newline";
             case ParserToken_EOF:
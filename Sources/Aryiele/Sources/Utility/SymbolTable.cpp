@@ -0,0 +1,81 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#include <Aryiele/Utility/SymbolTable.h>
+
+namespace Aryiele {
+    namespace {
+        const char* predefinedNames[] = {
+            "",
+            "Int8", "Int16", "Int32", "Int64", "Int", "UInt8", "UInt16", "UInt32", "UInt64", "UInt", "Float",
+            "Double", "String", "Character", "Void", "Boolean"
+        };
+
+        static_assert(sizeof(predefinedNames) / sizeof(predefinedNames[0]) == Symbol_Predefined,
+            "predefined symbol names do not match SymbolEnum");
+    }
+
+    SymbolTable::SymbolTable() {
+        m_symbols.reserve(1024);
+
+        for (auto name : predefinedNames)
+            intern(name);
+    }
+
+    Symbol SymbolTable::intern(std::string_view name) {
+        auto symbol = m_symbols.find(name);
+
+        if (symbol != m_symbols.end())
+            return symbol->second;
+
+        const auto& storedName = m_names.emplace_back(name);
+        const auto id = static_cast<Symbol>(m_names.size() - 1);
+
+        m_symbols.emplace(storedName, id);
+
+        return id;
+    }
+
+    Symbol SymbolTable::find(std::string_view name) const {
+        auto symbol = m_symbols.find(name);
+
+        return symbol != m_symbols.end() ? symbol->second : Symbol_Empty;
+    }
+
+    const std::string& SymbolTable::getName(Symbol symbol) const {
+        return m_names[symbol];
+    }
+
+    size_t SymbolTable::getSize() const {
+        return m_names.size();
+    }
+
+    SymbolTable &getSymbolTable() {
+        return SymbolTable::getInstance();
+    }
+
+} /* Namespace Aryiele. */
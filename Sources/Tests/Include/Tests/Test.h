@@ -0,0 +1,85 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#ifndef ARYIELE_TESTS_TEST_H
+#define ARYIELE_TESTS_TEST_H
+
+#include <string>
+#include <Aryiele/Common.h>
+#include <Aryiele/AST/ASTContext.h>
+#include <Aryiele/AST/Nodes/Node.h>
+#include <Aryiele/AST/Nodes/NodeRoot.h>
+#include <Aryiele/AST/Nodes/NodeTopFunction.h>
+
+namespace Tests {
+    using TestFunction = void (*)();
+
+    // Register a test of the executable, main runs them in the order they are registered (see TEST).
+    struct TestRegistration {
+        TestRegistration(const char* name, TestFunction function);
+    };
+
+    // Count a failed check of the running test (see CHECK).
+    void fail(const char* file, int line, const char* expression);
+    // Errors logged since the running test started.
+    int getErrorCount();
+    // Lex and parse a source, written to a file of its own as the lexer reads files.
+    Aryiele::NodeRoot* parse(Aryiele::ASTContext& context, const std::string& source);
+    // Function declared in a file or a namespace of the tree, null when there is none.
+    Aryiele::NodeTopFunction* findFunction(Aryiele::Node* node, const std::string& name);
+
+    // First node of the kind in the subtree, depth-first, null when there is none.
+    template<typename T>
+    T* findNode(Aryiele::Node* node) {
+        if (!node)
+            return nullptr;
+
+        if (auto result = Aryiele::dyn_cast<T>(node))
+            return result;
+
+        for (auto& child : node->children) {
+            if (auto result = findNode<T>(child))
+                return result;
+        }
+
+        return nullptr;
+    }
+
+} /* Namespace Tests. */
+
+#define TEST(name) \
+    static void name(); \
+    static ::Tests::TestRegistration name##Registration(#name, &name); \
+    static void name()
+
+#define CHECK(expression) \
+    do { \
+        if (!(expression)) \
+            ::Tests::fail(__FILE__, __LINE__, #expression); \
+    } while (false)
+
+#endif /* ARYIELE_TESTS_TEST_H. */
@@ -0,0 +1,153 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <Aryiele/AST/ASTCache.h>
+#include <Aryiele/AST/Nodes/NodeLiteralNumberInteger.h>
+#include <Aryiele/AST/Nodes/NodeOperationBinary.h>
+#include <Aryiele/AST/Nodes/NodeStatementCase.h>
+#include <Aryiele/AST/Nodes/NodeStatementReturn.h>
+#include <Aryiele/AST/Nodes/NodeStatementSwitch.h>
+#include <Aryiele/AST/Nodes/NodeTopFile.h>
+#include <Tests/Test.h>
+
+using namespace Aryiele;
+
+namespace {
+    const uint64_t SourceHash = 42;
+
+    std::string getCachePath() {
+        return (std::filesystem::temp_directory_path() / "aryiele-test.ast").string();
+    }
+
+    // Write the tree to the cache and read it back in a context of its own, null on a miss.
+    bool isLoaded(NodeRoot* nodeRoot, void (*damage)(std::string& file) = nullptr) {
+        const auto path = getCachePath();
+
+        if (!ASTCache::write(path, SourceHash, nodeRoot))
+            return false;
+
+        if (damage) {
+            std::string file;
+
+            {
+                std::ifstream stream(path, std::ios::binary);
+
+                file.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+            }
+
+            damage(file);
+
+            std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+
+            stream.write(file.data(), file.size());
+        }
+
+        ASTContext context;
+        auto result = ASTCache::read(context, path, SourceHash);
+
+        remove(path.c_str());
+
+        return result != nullptr;
+    }
+}
+
+TEST(UnchangedCacheIsLoaded) {
+    ASTContext context;
+    auto nodeRoot = Tests::parse(context, "func main(): Int32 { return 1 + 2; }");
+
+    CHECK(isLoaded(nodeRoot));
+}
+
+TEST(FlippedRecordByteIsAMiss) {
+    ASTContext context;
+    auto nodeRoot = Tests::parse(context, "func main(): Int32 { return 1 + 2; }");
+
+    // The record of the literal 2, which would otherwise load as a 3.
+    CHECK(!isLoaded(nodeRoot, [](std::string& file) {
+        const std::string literal { static_cast<char>(Node_LiteralNumberInteger), 2, 0, 0, 0, 0, 0, 0, 0 };
+        const auto record = file.rfind(literal);
+
+        CHECK(record != std::string::npos);
+
+        if (record != std::string::npos)
+            file[record + 1] ^= 1;
+    }));
+}
+
+TEST(FlippedSymbolByteIsAMiss) {
+    ASTContext context;
+    auto nodeRoot = Tests::parse(context, "func main(): Int32 { return 1 + 2; }");
+
+    // The first symbol follows the header and its size, main would otherwise load as lain.
+    CHECK(!isLoaded(nodeRoot, [](std::string& file) {
+        file[36] ^= 1;
+    }));
+}
+
+TEST(MissingOperandIsAMiss) {
+    ASTContext context;
+    auto nodeRoot = Tests::parse(context, "func main(): Int32 { return 1 + 2; }");
+    auto operation = Tests::findNode<NodeOperationBinary>(nodeRoot);
+
+    CHECK(operation);
+
+    if (operation)
+        operation->rhs = nullptr;
+
+    CHECK(!isLoaded(nodeRoot));
+}
+
+TEST(SwitchCaseOfAnotherKindIsAMiss) {
+    ASTContext context;
+    auto nodeRoot = Tests::parse(context, "func main(): Int32 { switch (1) { case 1: return 1; default: return 2; } "
+                                          "return 0; }");
+    auto statement = Tests::findNode<NodeStatementSwitch>(nodeRoot);
+
+    CHECK(statement && statement->cases.size() == 2);
+
+    if (statement && !statement->cases.empty())
+        statement->cases[0] = context.create<NodeLiteralNumberInteger>(1);
+
+    CHECK(!isLoaded(nodeRoot));
+}
+
+TEST(StatementAtTopLevelIsAMiss) {
+    ASTContext context;
+    auto nodeRoot = Tests::parse(context, "func main(): Int32 { return 0; }");
+    auto file = Tests::findNode<NodeTopFile>(nodeRoot);
+
+    CHECK(file);
+
+    if (file)
+        file->body.push_back(context.create<NodeStatementReturn>());
+
+    CHECK(!isLoaded(nodeRoot));
+}
@@ -0,0 +1,133 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#include <llvm/Support/raw_ostream.h>
+#include <Aryiele/CodeGenerator/CodeGenerator.h>
+#include <Tests/Test.h>
+
+using namespace Aryiele;
+
+namespace {
+    // The IR generated for a function of a source, empty when it has errors.
+    std::string generateFunction(const std::string& source, const std::string& name) {
+        ASTContext context;
+        auto nodeRoot = Tests::parse(context, source);
+        std::string result;
+
+        if (!nodeRoot || Tests::getErrorCount() != 0)
+            return result;
+
+        CodeGenerator::start("CodeGeneratorTests");
+        getCodeGenerator().generateCode(context, nodeRoot);
+
+        auto function = getCodeGenerator().getModule()->getFunction(name);
+
+        if (function && Tests::getErrorCount() == 0) {
+            llvm::raw_string_ostream stream(result);
+
+            function->print(stream);
+            stream.flush();
+        }
+
+        CodeGenerator::shutdown();
+
+        return result;
+    }
+
+    bool contains(const std::string& ir, const std::string& text) {
+        return ir.find(text) != std::string::npos;
+    }
+}
+
+TEST(UInt8DivisionIsUnsignedAtItsWidth) {
+    auto ir = generateFunction("func f(a: UInt8, b: UInt8): UInt8 { return a / b; }", "f");
+
+    CHECK(contains(ir, "udiv i8"));
+    CHECK(!contains(ir, "i16"));
+    CHECK(!contains(ir, "sdiv"));
+}
+
+TEST(UInt16RemainderIsUnsignedAtItsWidth) {
+    auto ir = generateFunction("func f(a: UInt16, b: UInt16): UInt16 { return a % b; }", "f");
+
+    CHECK(contains(ir, "urem i16"));
+    CHECK(!contains(ir, "i32"));
+    CHECK(!contains(ir, "srem"));
+}
+
+TEST(UInt32ComparisonsAreUnsigned) {
+    auto lessIR = generateFunction("func f(a: UInt32, b: UInt32): Boolean { return a < b; }", "f");
+    auto greaterIR = generateFunction("func f(a: UInt32, b: UInt32): Boolean { return a > b; }", "f");
+
+    CHECK(contains(lessIR, "icmp ult i32"));
+    CHECK(contains(greaterIR, "icmp ugt i32"));
+    CHECK(!contains(lessIR + greaterIR, "i64"));
+    CHECK(!contains(lessIR + greaterIR, "icmp s"));
+}
+
+TEST(NarrowerUnsignedIsZeroExtended) {
+    auto ir = generateFunction("func f(a: UInt8, b: UInt32): UInt32 { return a + b; }", "f");
+
+    CHECK(contains(ir, "zext i8"));
+    CHECK(contains(ir, "add i32"));
+    CHECK(!contains(ir, "sext"));
+    CHECK(!contains(ir, "i64"));
+}
+
+TEST(UInt64IsNotWidened) {
+    auto ir = generateFunction("func f(a: UInt64, b: UInt64): UInt64 { return a / b; }", "f");
+
+    CHECK(contains(ir, "udiv i64"));
+    CHECK(!contains(ir, "i128"));
+}
+
+TEST(UInt64LiteralAboveInt64IsNotTruncated) {
+    auto decimalIR = generateFunction("func f(): UInt64 { var m: UInt64 = 18446744073709551615; return m; }", "f");
+    auto hexadecimalIR = generateFunction("func f(): UInt64 { return 0xFFFFFFFFFFFFFFFF; }", "f");
+
+    CHECK(contains(decimalIR, "store i64 -1"));
+    CHECK(contains(hexadecimalIR, "ret i64 -1"));
+}
+
+TEST(InferredVariableIsInt32) {
+    auto ir = generateFunction("func f(): Int32 { var y = 5 + 5; y = 1000; return y; }", "f");
+
+    CHECK(contains(ir, "alloca i32"));
+    CHECK(contains(ir, "store i32 1000"));
+}
+
+TEST(LiteralArithmeticIsComputedAtTheWidthOfTheVariable) {
+    auto ir = generateFunction("func f(): Int32 { var x: Int32 = 100 * 100; return x; }", "f");
+
+    CHECK(contains(ir, "store i32 10000"));
+}
+
+TEST(FunctionSeesGlobalDeclaredAfterIt) {
+    auto ir = generateFunction("func f(): Int32 { return g; }\nvar g: Int32 = 5;", "f");
+
+    CHECK(contains(ir, "@g"));
+}
@@ -0,0 +1,221 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#include <Aryiele/AST/ConstantFolder.h>
+#include <Aryiele/AST/Resolver.h>
+#include <Aryiele/AST/Type.h>
+#include <Aryiele/AST/TypeChecker.h>
+#include <Aryiele/AST/Nodes/NodeLiteralBoolean.h>
+#include <Aryiele/AST/Nodes/NodeLiteralNumberFloating.h>
+#include <Aryiele/AST/Nodes/NodeLiteralNumberInteger.h>
+#include <Aryiele/AST/Nodes/NodeOperationBinary.h>
+#include <Aryiele/AST/Nodes/NodeOperationTernary.h>
+#include <Aryiele/AST/Nodes/NodeStatementBlock.h>
+#include <Aryiele/AST/Nodes/NodeStatementIf.h>
+#include <Aryiele/AST/Nodes/NodeStatementReturn.h>
+#include <Aryiele/AST/Nodes/NodeStatementVariableDeclaration.h>
+#include <Aryiele/CodeGenerator/CodeGenerator.h>
+#include <Tests/Test.h>
+
+using namespace Aryiele;
+
+namespace {
+    // Parse, resolve, check and fold a source declaring main, null when it has errors.
+    NodeTopFunction* foldMain(ASTContext& context, const std::string& source) {
+        auto nodeRoot = Tests::parse(context, source);
+
+        if (!nodeRoot || Tests::getErrorCount() != 0)
+            return nullptr;
+
+        Resolver().resolve(nodeRoot);
+
+        if (!TypeChecker().check(context, nodeRoot))
+            return nullptr;
+
+        ConstantFolder().fold(context, nodeRoot);
+
+        return Tests::findFunction(nodeRoot, "main");
+    }
+
+    // Whether generating the source logs errors, the code generator folding the tree once it is checked.
+    bool isRejected(const std::string& source) {
+        const auto errorCount = Tests::getErrorCount();
+        ASTContext context;
+        auto nodeRoot = Tests::parse(context, source);
+
+        if (nodeRoot && Tests::getErrorCount() == errorCount) {
+            CodeGenerator::start("ConstantFolderTests");
+            getCodeGenerator().generateCode(context, nodeRoot);
+            CodeGenerator::shutdown();
+        }
+
+        return Tests::getErrorCount() != errorCount;
+    }
+
+    // Initializer of the first variable of a declaration.
+    Node* getInitializer(Node* node) {
+        auto declaration = dyn_cast<NodeStatementVariableDeclaration>(node);
+
+        return declaration && !declaration->variables.empty() ? declaration->variables[0]->expression : nullptr;
+    }
+
+    // Value assigned by the first assignment of the subtree, -1 when there is none.
+    int64_t getAssignedValue(Node* node) {
+        auto assignment = Tests::findNode<NodeOperationBinary>(node);
+        auto value = assignment ? dyn_cast<NodeLiteralNumberInteger>(assignment->rhs) : nullptr;
+
+        return value ? value->value : -1;
+    }
+}
+
+TEST(BooleanKeywordsAreBooleanLiterals) {
+    ASTContext context;
+    auto nodeRoot = Tests::parse(context, "func main(): Int32 { var a: Boolean = true; var b: Boolean = false; "
+                                          "return 0; }");
+    auto function = Tests::findFunction(nodeRoot, "main");
+
+    CHECK(function && function->body.size() == 3);
+
+    if (!function || function->body.size() != 3)
+        return;
+
+    auto a = dyn_cast<NodeLiteralBoolean>(getInitializer(function->body[0]));
+    auto b = dyn_cast<NodeLiteralBoolean>(getInitializer(function->body[1]));
+
+    CHECK(a && a->value);
+    CHECK(b && !b->value);
+}
+
+TEST(IfTrueIsReplacedByItsBody) {
+    ASTContext context;
+    auto function = foldMain(context, "func main(): Int32 { var x: Int32 = 0; if (true) { x = 1; } else { x = 2; } "
+                                      "return x; }");
+
+    CHECK(function);
+    CHECK(!Tests::findNode<NodeStatementIf>(function));
+    CHECK(getAssignedValue(Tests::findNode<NodeStatementBlock>(function)) == 1);
+}
+
+TEST(IfFalseIsReplacedByItsElseBody) {
+    ASTContext context;
+    auto function = foldMain(context, "func main(): Int32 { var x: Int32 = 0; if (false) { x = 1; } else { x = 2; } "
+                                      "return x; }");
+
+    CHECK(function);
+    CHECK(!Tests::findNode<NodeStatementIf>(function));
+    CHECK(getAssignedValue(Tests::findNode<NodeStatementBlock>(function)) == 2);
+}
+
+TEST(LogicalOperationsOnBooleanKeywordsAreFolded) {
+    ASTContext context;
+    auto function = foldMain(context, "func main(): Int32 { var x: Int32 = 0; if (true && !false) { x = 1; } "
+                                      "return x; }");
+
+    CHECK(function);
+    CHECK(!Tests::findNode<NodeStatementIf>(function));
+    CHECK(getAssignedValue(Tests::findNode<NodeStatementBlock>(function)) == 1);
+}
+
+TEST(TernaryOnBooleanKeywordIsReplacedByItsBranch) {
+    ASTContext context;
+    auto function = foldMain(context, "func main(): Int32 { return false ? 1 : 2; }");
+    auto statement = function ? Tests::findNode<NodeStatementReturn>(function) : nullptr;
+    auto value = statement ? dyn_cast<NodeLiteralNumberInteger>(statement->expression) : nullptr;
+
+    CHECK(value && value->value == 2);
+}
+
+TEST(IfOnVariableIsKept) {
+    ASTContext context;
+    auto function = foldMain(context, "func main(): Int32 { var b: Boolean = true; var x: Int32 = 0; "
+                                      "if (b) { x = 1; } return x; }");
+
+    CHECK(function);
+    CHECK(Tests::findNode<NodeStatementIf>(function));
+}
+
+TEST(WiderLiteralIsNotNarrowed) {
+    ASTContext context;
+    auto function = foldMain(context, "func main(): Int32 { return 1 + 1000; }");
+    auto statement = function ? Tests::findNode<NodeStatementReturn>(function) : nullptr;
+    auto value = statement ? dyn_cast<NodeLiteralNumberInteger>(statement->expression) : nullptr;
+
+    CHECK(value && value->value == 1001);
+}
+
+TEST(DecimalLiteralsAreFoldedInDoublePrecision) {
+    ASTContext context;
+    auto function = foldMain(context, "func main(): Int32 { var d: Double = 0.1 + 0.2; return 0; }");
+    auto value = function ? dyn_cast<NodeLiteralNumberFloating>(getInitializer(function->body[0])) : nullptr;
+
+    CHECK(value && value->value == 0.1 + 0.2);
+}
+
+TEST(BooleanArithmeticIsRejected) {
+    CHECK(isRejected("func main(): Int32 { var x: Int32 = true + 1; return x; }"));
+}
+
+TEST(BooleanEqualityIsFolded) {
+    ASTContext context;
+    auto function = foldMain(context, "func main(): Int32 { var b: Boolean = true == false; return 0; }");
+    auto value = function ? dyn_cast<NodeLiteralBoolean>(getInitializer(function->body[0])) : nullptr;
+
+    CHECK(value && !value->value);
+}
+
+TEST(TernaryOnBooleanOrderingIsRejected) {
+    CHECK(isRejected("func main(): Int32 { return (true < false) ? 1 : 2; }"));
+}
+
+TEST(TernaryWithBranchOfAnotherTypeIsRejected) {
+    CHECK(isRejected("func main(): Int32 { var x: Int32 = true ? 1 : \"s\"; return x; }"));
+}
+
+TEST(TernaryBranchTakesTheCommonType) {
+    ASTContext context;
+    auto function = foldMain(context, "func main(): Int32 { var d: Double = true ? 1 : 2.5; return 0; }");
+    auto value = function ? dyn_cast<NodeLiteralNumberFloating>(getInitializer(function->body[0])) : nullptr;
+
+    CHECK(value && value->value == 1.0);
+}
+
+TEST(CastOfLiteralIsFolded) {
+    ASTContext context;
+    auto function = foldMain(context, "func main(): Int32 { var d: Double = 1 + 2; return 0; }");
+    auto value = function ? dyn_cast<NodeLiteralNumberFloating>(getInitializer(function->body[0])) : nullptr;
+
+    CHECK(value && value->value == 3.0 && value->valueType == &Type::Double);
+}
+
+TEST(DeadIfBodyIsStillResolvedAndChecked) {
+    CHECK(!isRejected("func main(): Int32 { if (false) { var s: Int32 = 1; } return 0; }"));
+    CHECK(isRejected("func main(): Int32 { if (false) { var s: String = 1 + undefinedVar; } return 0; }"));
+}
+
+TEST(DeadReturnOfAnotherTypeIsRejected) {
+    CHECK(isRejected("func main(): Int32 { if (false) { return \"s\"; } return 0; }"));
+}
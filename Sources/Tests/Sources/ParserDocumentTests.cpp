@@ -0,0 +1,226 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <Aryiele/AST/Nodes/NodeTopFile.h>
+#include <Aryiele/Lexer/Lexer.h>
+#include <Aryiele/Parser/Parser.h>
+#include <Aryiele/Parser/ParserDocument.h>
+#include <Aryiele/Parser/ParserInformation.h>
+#include <Tests/Test.h>
+
+using namespace Aryiele;
+
+namespace {
+    const std::string Source =
+        "/* Declarations edited at random. */\n"
+        "func add(a: Int32, b: Int32): Int32 {\n"
+        "    return a + b;\n"
+        "}\n"
+        "\n"
+        "func main(): Int32 {\n"
+        "    var x: Int32 = -1; // Unary minus.\n"
+        "    var s: String = \"a \\\"quoted\\\" string\";\n"
+        "    if (x < 2) {\n"
+        "        x = add(x, 0x1F)\n"
+        "            - 3;\n"
+        "    }\n"
+        "    return x;\n"
+        "}\n"
+        "\n"
+        "func f(): Double { return 1.5 * 2.0; }\n";
+
+    // Texts inserted by the random edits, opening and closing comments, strings, blocks and declarations.
+    const char* Insertions[] = { "", " ", "\n", "x", "1", "-", "+", "(", ")", "{", "}", ";", "/*", "*/", "//", "\"",
+        "return 0;\n", "func g(): Int32 { return 2; }\n" };
+
+    // Tokens and declarations of a source, as lexed and parsed.
+    struct Snapshot {
+        std::vector<std::string> tokens;
+        std::vector<std::string> declarations;
+        bool isLinked;
+    };
+
+    std::string getPath(const std::string& name) {
+        return (std::filesystem::temp_directory_path() / ("aryiele-test-" + name + ".ac")).string();
+    }
+
+    std::vector<std::string> describeTokens(const std::vector<ParserToken>& tokens) {
+        std::vector<std::string> result;
+
+        for (auto& token : tokens) {
+            result.push_back(ParserToken::getTypeName(token.type) + " " + std::to_string(token.offset) + " '" +
+                std::string(getLexer().getContent(token)) + "'");
+
+            // The state the lexer restarts from after the newline.
+            if (token.type == ParserToken_Newline)
+                result.back() += " " + std::to_string(token.lineState);
+        }
+
+        return result;
+    }
+
+    void describeInformation(const ParserInformation& information, size_t depth, std::string& result) {
+        result.append(depth * 2, ' ').append(information.name).append("\n");
+
+        for (auto& child : information.children)
+            describeInformation(*child, depth + 1, result);
+    }
+
+    // Dump of the declarations of the file, the file node itself being named after the path.
+    Snapshot describeTree(NodeRoot* root, std::vector<std::string> tokens) {
+        Snapshot snapshot { std::move(tokens), {}, true };
+        auto file = root && !root->body.empty() ? dyn_cast<NodeTopFile>(root->body[0]) : nullptr;
+
+        if (!file)
+            return snapshot;
+
+        for (auto& declaration : file->body) {
+            std::string description = "null";
+
+            if (declaration) {
+                auto information = std::make_shared<ParserInformation>();
+
+                declaration->dumpAST(information);
+                description.clear();
+                describeInformation(*information, 0, description);
+            }
+
+            snapshot.declarations.push_back(description);
+        }
+
+        std::vector<Node*> nodes { root };
+
+        while (!nodes.empty()) {
+            auto node = nodes.back();
+
+            nodes.pop_back();
+
+            for (auto& child : node->children) {
+                if (!child)
+                    continue;
+
+                snapshot.isLinked = snapshot.isLinked && child->parent == node;
+                nodes.push_back(child);
+            }
+        }
+
+        return snapshot;
+    }
+
+    // Open the source as a document and apply the first editCount edits of a random sequence to it, the edited
+    // source is returned too.
+    Snapshot editDocument(const std::string& path, unsigned seed, size_t editCount, std::string& source) {
+        std::mt19937 random(seed);
+        ParserDocument document;
+
+        source = Source;
+
+        {
+            std::ofstream file(path, std::ios::binary);
+
+            file << source;
+        }
+
+        document.open(path);
+
+        for (size_t i = 0; i < editCount; i++) {
+            SourceEdit edit { random() % (source.size() + 1), random() % 3,
+                Insertions[random() % std::size(Insertions)] };
+
+            edit.removedLength = std::min(edit.removedLength, source.size() - edit.offset);
+            source.replace(edit.offset, edit.removedLength, edit.insertedText);
+            document.edit(edit);
+        }
+
+        return describeTree(document.getRoot(), describeTokens(document.getTokens()));
+    }
+
+    Snapshot parseSource(const std::string& path, const std::string& source) {
+        {
+            std::ofstream file(path, std::ios::binary);
+
+            file << source;
+        }
+
+        ASTContext context;
+        auto tokens = getLexer().lex(path);
+        auto description = describeTokens(tokens);
+
+        return describeTree(getParser().parse(context, path, std::move(tokens)), std::move(description));
+    }
+}
+
+TEST(EditedDocumentMatchesFullParse) {
+    const auto documentPath = getPath("document");
+    const auto sourcePath = getPath("document-source");
+    auto isSame = true;
+
+    // Every prefix of each sequence, the document cannot be compared while the lexer lexes something else.
+    for (unsigned seed = 0; seed < 20 && isSame; seed++) {
+        for (size_t editCount = 1; editCount <= 10 && isSame; editCount++) {
+            std::string source;
+            auto edited = editDocument(documentPath, seed, editCount, source);
+            auto parsed = parseSource(sourcePath, source);
+
+            CHECK(edited.tokens == parsed.tokens);
+            CHECK(edited.declarations == parsed.declarations);
+            CHECK(edited.isLinked);
+
+            isSame = edited.tokens == parsed.tokens && edited.declarations == parsed.declarations && edited.isLinked;
+        }
+    }
+
+    remove(documentPath.c_str());
+    remove(sourcePath.c_str());
+}
+
+TEST(EditInFunctionReparsesItAlone) {
+    const auto path = getPath("document");
+    ParserDocument document;
+
+    {
+        std::ofstream file(path, std::ios::binary);
+
+        file << Source;
+    }
+
+    CHECK(document.open(path) && Tests::getErrorCount() == 0);
+
+    const auto offset = Source.find("a + b");
+    const auto damage = document.edit({ offset, 1, "b" });
+
+    CHECK(document.getReparsedCount() == 1);
+    CHECK(damage.removedCount == damage.insertedCount);
+    CHECK(getLexer().getContent(document.getTokens()[damage.first]) == "return");
+
+    remove(path.c_str());
+}
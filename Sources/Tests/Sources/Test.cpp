@@ -0,0 +1,141 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include <Vanir/Logger/Logger.h>
+#include <Aryiele/Lexer/Lexer.h>
+#include <Aryiele/Parser/Parser.h>
+#include <Aryiele/Utility/SymbolTable.h>
+#include <Tests/Test.h>
+
+namespace Tests {
+    namespace {
+        struct Test {
+            const char* name;
+            TestFunction function;
+        };
+
+        // Function-local, the registrations run before main in any order of the translation units.
+        std::vector<Test>& getTests() {
+            static std::vector<Test> tests;
+
+            return tests;
+        }
+
+        size_t failureCount = 0;
+        int errorCount = 0;
+        std::vector<std::string> sourcePaths;
+    }
+
+    TestRegistration::TestRegistration(const char* name, TestFunction function) {
+        getTests().push_back({ name, function });
+    }
+
+    void fail(const char* file, int line, const char* expression) {
+        failureCount++;
+
+        std::cerr << file << ":" << line << ": check failed: " << expression << std::endl;
+    }
+
+    int getErrorCount() {
+        return ::Vanir::Logger::errorCount - errorCount;
+    }
+
+    Aryiele::NodeRoot* parse(Aryiele::ASTContext& context, const std::string& source) {
+        // The lexer keeps the file mapped as long as the tokens live: each source gets a file of its own.
+        auto path = (std::filesystem::temp_directory_path() /
+            ("aryiele-test-" + std::to_string(sourcePaths.size()) + ".ac")).string();
+
+        {
+            std::ofstream file(path, std::ios::binary);
+
+            file << source;
+        }
+
+        sourcePaths.push_back(path);
+
+        auto tokens = Aryiele::getLexer().lex(path);
+
+        return Aryiele::getParser().parse(context, path, std::move(tokens));
+    }
+
+    Aryiele::NodeTopFunction* findFunction(Aryiele::Node* node, const std::string& name) {
+        if (!node)
+            return nullptr;
+
+        if (auto function = Aryiele::dyn_cast<Aryiele::NodeTopFunction>(node))
+            return Aryiele::getSymbolTable().getName(function->identifier) == name ? function : nullptr;
+
+        for (auto& child : node->children) {
+            if (auto function = findFunction(child, name))
+                return function;
+        }
+
+        return nullptr;
+    }
+
+} /* Namespace Tests. */
+
+int main() {
+    Vanir::Logger::startNoLog();
+    Aryiele::SymbolTable::start();
+    Aryiele::Lexer::start();
+    Aryiele::Parser::start();
+
+    size_t failedCount = 0;
+
+    for (auto& test : Tests::getTests()) {
+        const auto previousFailureCount = Tests::failureCount;
+
+        Tests::errorCount = ::Vanir::Logger::errorCount;
+
+        test.function();
+
+        const auto isPassed = Tests::failureCount == previousFailureCount;
+
+        failedCount += isPassed ? 0 : 1;
+
+        std::cout << (isPassed ? "[  OK  ] " : "[ FAIL ] ") << test.name << std::endl;
+    }
+
+    std::cout << Tests::getTests().size() - failedCount << "/" << Tests::getTests().size() << " tests passed"
+              << std::endl;
+
+    Aryiele::Parser::shutdown();
+    Aryiele::Lexer::shutdown();
+    Aryiele::SymbolTable::shutdown();
+    Vanir::Logger::stop();
+
+    for (auto& path : Tests::sourcePaths)
+        remove(path.c_str());
+
+    return failedCount == 0 ? 0 : 1;
+}
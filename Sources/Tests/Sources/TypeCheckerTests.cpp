@@ -0,0 +1,274 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#include <Aryiele/AST/Resolver.h>
+#include <Aryiele/AST/Type.h>
+#include <Aryiele/AST/TypeChecker.h>
+#include <Aryiele/AST/Nodes/NodeLiteralNumberFloating.h>
+#include <Aryiele/AST/Nodes/NodeOperationBinary.h>
+#include <Aryiele/AST/Nodes/NodeOperationCast.h>
+#include <Aryiele/AST/Nodes/NodeStatementReturn.h>
+#include <Aryiele/AST/Nodes/NodeStatementVariableDeclaration.h>
+#include <Tests/Test.h>
+
+using namespace Aryiele;
+
+namespace {
+    // Parse, resolve and check a source, null when it could not be parsed or checked.
+    NodeRoot* check(ASTContext& context, const std::string& source) {
+        auto nodeRoot = Tests::parse(context, source);
+
+        if (!nodeRoot || Tests::getErrorCount() != 0)
+            return nullptr;
+
+        Resolver().resolve(nodeRoot);
+
+        return TypeChecker().check(context, nodeRoot) ? nodeRoot : nullptr;
+    }
+
+    // Whether the source is parsed but checking it logs an error.
+    bool isRejected(const std::string& source) {
+        ASTContext context;
+        const auto errorCount = Tests::getErrorCount();
+        auto nodeRoot = Tests::parse(context, source);
+
+        if (!nodeRoot || Tests::getErrorCount() != errorCount)
+            return false;
+
+        Resolver().resolve(nodeRoot);
+
+        return !TypeChecker().check(context, nodeRoot);
+    }
+
+    // First variable declared in the function.
+    Variable* findVariable(NodeTopFunction* function) {
+        auto declaration = function ? Tests::findNode<NodeStatementVariableDeclaration>(function) : nullptr;
+
+        return declaration && !declaration->variables.empty() ? declaration->variables[0] : nullptr;
+    }
+
+    // Expression returned first in the function.
+    Node* findReturned(NodeTopFunction* function) {
+        auto statement = function ? Tests::findNode<NodeStatementReturn>(function) : nullptr;
+
+        return statement ? statement->expression : nullptr;
+    }
+
+    // Whether the operand of the operation was cast to its type, or used as it is.
+    bool isCast(Node* operand, const Type* type) {
+        return isa<NodeOperationCast>(operand) && operand->valueType == type;
+    }
+}
+
+TEST(ZeroFloatingLiteralIsDouble) {
+    ASTContext context;
+    auto variable = findVariable(Tests::findFunction(check(context,
+        "func main(): Int32 { var d: Double = 0.0; return 0; }"), "main"));
+
+    CHECK(variable && isa<NodeLiteralNumberFloating>(variable->expression));
+    CHECK(variable && variable->expression->valueType == &Type::Double);
+}
+
+TEST(NegativeFloatingLiteralIsDouble) {
+    ASTContext context;
+    auto variable = findVariable(Tests::findFunction(check(context,
+        "func main(): Int32 { var d: Double = -1.5; return 0; }"), "main"));
+
+    CHECK(variable && variable->valueType == &Type::Double);
+    CHECK(variable && !isa<NodeOperationCast>(variable->expression));
+    CHECK(variable && variable->expression->valueType == &Type::Double);
+}
+
+TEST(DoubleInitializerIsNotRoundedToFloat) {
+    ASTContext context;
+    auto variable = findVariable(Tests::findFunction(check(context,
+        "func main(): Int32 { var d: Double = 0.1; return 0; }"), "main"));
+
+    CHECK(variable && isa<NodeLiteralNumberFloating>(variable->expression));
+    CHECK(variable && variable->expression->valueType == &Type::Double);
+}
+
+TEST(FloatInitializerIsFloatLiteral) {
+    ASTContext context;
+    auto variable = findVariable(Tests::findFunction(check(context,
+        "func main(): Int32 { var f: Float = 0.1; return 0; }"), "main"));
+
+    CHECK(variable && isa<NodeLiteralNumberFloating>(variable->expression));
+    CHECK(variable && variable->expression->valueType == &Type::Float);
+}
+
+TEST(InferredFloatingVariableIsDouble) {
+    ASTContext context;
+    auto variable = findVariable(Tests::findFunction(check(context,
+        "func main(): Int32 { var d = 2.5; return 0; }"), "main"));
+
+    CHECK(variable && variable->valueType == &Type::Double);
+}
+
+TEST(NarrowerLhsIsWidened) {
+    ASTContext context;
+    auto operation = dyn_cast<NodeOperationBinary>(findReturned(Tests::findFunction(check(context,
+        "func f(a: Int8, b: Int64): Int64 { return a + b; }"), "f")));
+
+    CHECK(operation && operation->valueType == &Type::Int64);
+    CHECK(operation && isCast(operation->lhs, &Type::Int64));
+    CHECK(operation && !isa<NodeOperationCast>(operation->rhs));
+}
+
+TEST(NarrowerRhsIsWidened) {
+    ASTContext context;
+    auto operation = dyn_cast<NodeOperationBinary>(findReturned(Tests::findFunction(check(context,
+        "func f(a: Int8, b: Int64): Int64 { return b - a; }"), "f")));
+
+    CHECK(operation && operation->valueType == &Type::Int64);
+    CHECK(operation && !isa<NodeOperationCast>(operation->lhs));
+    CHECK(operation && isCast(operation->rhs, &Type::Int64));
+}
+
+TEST(IntegerIsConvertedToFloating) {
+    ASTContext context;
+    auto operation = dyn_cast<NodeOperationBinary>(findReturned(Tests::findFunction(check(context,
+        "func f(a: Float, b: Int64): Float { return b * a; }"), "f")));
+
+    CHECK(operation && operation->valueType == &Type::Float);
+    CHECK(operation && isCast(operation->lhs, &Type::Float));
+}
+
+TEST(DecimalLiteralComputedWithFloatIsFloat) {
+    ASTContext context;
+    auto operation = dyn_cast<NodeOperationBinary>(findReturned(Tests::findFunction(check(context,
+        "func f(a: Float): Float { return a * 0.5; }"), "f")));
+
+    CHECK(operation && operation->valueType == &Type::Float);
+    CHECK(operation && isa<NodeLiteralNumberFloating>(operation->rhs) && operation->rhs->valueType == &Type::Float);
+}
+
+TEST(SameWidthOperandsAreUnsigned) {
+    ASTContext context;
+    auto operation = dyn_cast<NodeOperationBinary>(findReturned(Tests::findFunction(check(context,
+        "func f(a: Int32, b: UInt32): UInt32 { return a / b; }"), "f")));
+
+    CHECK(operation && operation->valueType == &Type::UInt32);
+    CHECK(operation && isCast(operation->lhs, &Type::UInt32));
+}
+
+TEST(ComparisonWidensOperands) {
+    ASTContext context;
+    auto operation = dyn_cast<NodeOperationBinary>(findReturned(Tests::findFunction(check(context,
+        "func f(a: Int8): Boolean { return a < 1000; }"), "f")));
+
+    CHECK(operation && operation->valueType == &Type::Boolean);
+    CHECK(operation && isCast(operation->lhs, &Type::Int32));
+    CHECK(operation && operation->rhs->valueType == &Type::Int32);
+}
+
+TEST(InferredIntegerVariableIsInt32) {
+    ASTContext context;
+    auto variable = findVariable(Tests::findFunction(check(context,
+        "func main(): Int32 { var y = 5 + 5; return y; }"), "main"));
+
+    CHECK(variable && variable->valueType == &Type::Int32);
+}
+
+TEST(InferredVariableOfLargeLiteralIsInt64) {
+    ASTContext context;
+    auto variable = findVariable(Tests::findFunction(check(context,
+        "func main(): Int32 { var y = 3000000000; return 0; }"), "main"));
+
+    CHECK(variable && variable->valueType == &Type::Int64);
+}
+
+TEST(LiteralArithmeticIsInt32) {
+    ASTContext context;
+    auto variable = findVariable(Tests::findFunction(check(context,
+        "func main(): Int32 { var x: Int32 = 100 * 100; return 0; }"), "main"));
+    auto operation = variable ? dyn_cast<NodeOperationBinary>(variable->expression) : nullptr;
+
+    CHECK(operation && operation->valueType == &Type::Int32);
+    CHECK(operation && !isa<NodeOperationCast>(operation->lhs) && !isa<NodeOperationCast>(operation->rhs));
+}
+
+TEST(LiteralComputedWithNarrowerIntegerTakesItsType) {
+    ASTContext context;
+    auto operation = dyn_cast<NodeOperationBinary>(findReturned(Tests::findFunction(check(context,
+        "func f(a: Int8): Int8 { return a + 1; }"), "f")));
+
+    CHECK(operation && operation->valueType == &Type::Int8);
+    CHECK(operation && !isa<NodeOperationCast>(operation->rhs) && operation->rhs->valueType == &Type::Int8);
+}
+
+TEST(LiteralAboveInt64IsUInt64) {
+    ASTContext context;
+    auto variable = findVariable(Tests::findFunction(check(context,
+        "func main(): Int32 { var m = 9223372036854775808; return 0; }"), "main"));
+
+    CHECK(variable && variable->valueType == &Type::UInt64);
+}
+
+TEST(OutOfRangeIntegerLiteralIsRejected) {
+    CHECK(isRejected("func main(): Int32 { var b: UInt8 = 300; return 0; }"));
+    CHECK(isRejected("func main(): Int32 { var y: Int8 = 1; y = 1000; return 0; }"));
+    CHECK(isRejected("func main(): Int32 { var u: UInt32 = -1; return 0; }"));
+    CHECK(isRejected("func main(): Int32 { var i: Int64 = 18446744073709551615; return 0; }"));
+    CHECK(!isRejected("func main(): Int32 { var b: UInt8 = 255; var y: Int8 = -128; return 0; }"));
+}
+
+TEST(FunctionsOfNamespacesAreChecked) {
+    ASTContext context;
+    auto operation = dyn_cast<NodeOperationBinary>(findReturned(Tests::findFunction(check(context,
+        "namespace n { func f(a: Int8, b: Int64): Int64 { return a + b; } }"), "f")));
+
+    CHECK(operation && operation->valueType == &Type::Int64);
+    CHECK(operation && isCast(operation->lhs, &Type::Int64));
+}
+
+TEST(StringIsNotConverted) {
+    ASTContext context;
+    auto nodeRoot = Tests::parse(context, "func f(): String { return 1; }");
+
+    Resolver().resolve(nodeRoot);
+
+    CHECK(!TypeChecker().check(context, nodeRoot));
+}
+
+TEST(BooleanArithmeticIsRejected) {
+    ASTContext context;
+    auto nodeRoot = Tests::parse(context, "func f(): Int32 { var x: Int32 = true + 1; return x; }");
+
+    Resolver().resolve(nodeRoot);
+
+    CHECK(!TypeChecker().check(context, nodeRoot));
+}
+
+TEST(TernaryWithStringBranchIsRejected) {
+    ASTContext context;
+    auto nodeRoot = Tests::parse(context, "func f(): Int32 { return true ? 1 : \"s\"; }");
+
+    Resolver().resolve(nodeRoot);
+
+    CHECK(!TypeChecker().check(context, nodeRoot));
+}
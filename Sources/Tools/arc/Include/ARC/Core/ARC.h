@@ -31,6 +31,7 @@
 #include <Vanir/CLI/CLI.h>
 #include <Aryiele/Common.h>
 #include <Aryiele/Lexer/Lexer.h>
+#include <Aryiele/Lexer/TokenStream.h>
 #include <Aryiele/Parser/Parser.h>
 #include <ARC/Core/BuildType.h>
 #include <ARC/Utility/Logger.h>
@@ -50,10 +51,14 @@ namespace ARC {
     class ARC {
     public:
         static int run(int argc, char *argv[]);
-        static std::vector<Aryiele::LexerToken> doLexerPass(const std::string& filepath);
-        static std::shared_ptr<Aryiele::NodeRoot> doParserPass(const std::string& path,
-            std::vector<Aryiele::LexerToken> lexerTokens);
-        static void doCodeGeneratorPass(std::shared_ptr<Aryiele::NodeRoot> nodeRoot);
+        static std::vector<Aryiele::ParserToken> doLexerPass(const std::string& filepath);
+        static Aryiele::NodeRoot* doParserPass(Aryiele::ASTContext& context, const std::string& path,
+            Aryiele::TokenStream& tokens);
+        // The AST of the input from its cache, null when there is none or the input changed since.
+        static Aryiele::NodeRoot* readASTCache(Aryiele::ASTContext& context, uint64_t& sourceHash);
+        static void writeASTCache(Aryiele::NodeRoot* nodeRoot, uint64_t sourceHash, double parseTime);
+        static std::string getASTCacheFilepath();
+        static void doCodeGeneratorPass(Aryiele::ASTContext& context, Aryiele::NodeRoot* nodeRoot);
         static void doObjectGeneratorPass();
         static void doExecutableGeneratorPass();
         static void dumpASTInformations(const std::shared_ptr<Aryiele::ParserInformation>& node, std::string indent = "");
@@ -64,6 +69,11 @@ namespace ARC {
         static void commandActivateVerboseMode(const std::string& s = "");
         static void commandKeepAllFiles(const std::string& s = "");
         static void commandDefineBuildType(const std::string& s = "");
+        static void commandDefineLexerMode(const std::string& s = "");
+        static void commandDefineLexerThreads(const std::string& s = "");
+        static void commandDefineParserThreads(const std::string& s = "");
+        static void commandLazyBodies(const std::string& s = "");
+        static void commandUseASTCache(const std::string& s = "");
         static void commandOptionNotFound(const std::string& s = "");
         static std::string getOptionValue(const std::string& option);
 
@@ -78,6 +88,11 @@ namespace ARC {
         static bool m_verboseMode;
         static bool m_keepAllFiles;
         static BuildType m_buildType;
+        static Aryiele::LexerMode m_lexerMode;
+        static size_t m_lexerThreadCount;
+        static size_t m_parserThreadCount;
+        static bool m_lazyBodies;
+        static bool m_useASTCache;
         static bool m_doLexerPass;
         static bool m_doParserPass;
         static bool m_doCodeGeneratorPass;
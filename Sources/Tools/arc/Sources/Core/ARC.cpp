@@ -34,12 +34,16 @@
 #include <utility>
 #include <cstdio>
 #include <memory>
+#include <chrono>
 #include <llvm/Bitcode/BitcodeWriter.h>
 #include <llvm/Bitcode/BitcodeReader.h>
 #include <Vanir/FileSystem/FileSystem.h>
 #include <Aryiele/Common.h>
 #include <Aryiele/Lexer/Lexer.h>
+#include <Aryiele/Lexer/SourceBuffer.h>
+#include <Aryiele/Utility/SymbolTable.h>
 #include <Aryiele/Parser/Parser.h>
+#include <Aryiele/AST/ASTCache.h>
 #include <Aryiele/CodeGenerator/CodeGenerator.h>
 #include <ARC/Core/ARC.h>
 
@@ -63,6 +67,24 @@ namespace ARC {
     bool ARC::m_doCodeGeneratorPass = true;
 
     BuildType ARC::m_buildType = BuildType_Executable;
+    Aryiele::LexerMode ARC::m_lexerMode = Aryiele::LexerMode_SinglePass;
+    size_t ARC::m_lexerThreadCount = 0;
+    size_t ARC::m_parserThreadCount = 1;
+    bool ARC::m_lazyBodies = false;
+    bool ARC::m_useASTCache = false;
+    
+    namespace {
+        const char* getLexerModeName(Aryiele::LexerMode mode) {
+            switch (mode) {
+                case Aryiele::LexerMode_SinglePass:
+                    return "single-pass";
+                case Aryiele::LexerMode_MultiPass:
+                    return "multi-pass";
+                default:
+                    return "parallel";
+            }
+        }
+    }
     
     int ARC::run(const int argc, char *argv[]) {
 #ifdef _WIN32
@@ -117,6 +139,43 @@ namespace ARC {
 #endif
                 }))
             }));
+        m_options.emplace_back(
+            std::vector<std::string>({"-l", "--lexer-mode"}),
+            &ARC::commandDefineLexerMode,
+            std::vector<std::string>({"Choose the lexer engine (default is single):"}),
+            Vanir::CLIOptionType_OptionWithValue,
+            "<mode>",
+            std::vector<Vanir::CLIArgument>({
+                Vanir::CLIArgument(
+                    std::vector<std::string>({"single"}),
+                    std::vector<std::string>({"Fused single-pass streaming lexer."})),
+                Vanir::CLIArgument(
+                    std::vector<std::string>({"multi"}),
+                    std::vector<std::string>({"Legacy seven-pass lexer."})),
+                Vanir::CLIArgument(
+                    std::vector<std::string>({"parallel"}),
+                    std::vector<std::string>({"Single-pass lexer on chunks of the file lexed", "on several threads."}))
+            }));
+        m_options.emplace_back(
+            std::vector<std::string>({"-j", "--lexer-threads"}),
+            &ARC::commandDefineLexerThreads,
+            std::vector<std::string>({"Use <n> threads in the parallel lexer", "(default is every hardware thread)."}),
+            Vanir::CLIOptionType_OptionWithValue,
+            "<n>");
+        m_options.emplace_back(
+            std::vector<std::string>({"-p", "--parser-threads"}),
+            &ARC::commandDefineParserThreads,
+            std::vector<std::string>({"Parse the top-level declarations on <n> threads", "(default is 1, 0 is every hardware thread)."}),
+            Vanir::CLIOptionType_OptionWithValue,
+            "<n>");
+        m_options.emplace_back(
+            std::vector<std::string>({"-L", "--lazy-bodies"}),
+            &ARC::commandLazyBodies,
+            std::vector<std::string>({"Parse function bodies once called, starting from main,", "functions never called are not compiled."}));
+        m_options.emplace_back(
+            std::vector<std::string>({"-c", "--ast-cache"}),
+            &ARC::commandUseASTCache,
+            std::vector<std::string>({"Keep the AST next to the output ('.ast') and load it", "instead of lexing and parsing an unchanged input."}));
 
 #ifdef FINAL_RELEASE
         if(argc < 2) {
@@ -142,7 +201,7 @@ namespace ARC {
         }
 
         m_inputFilepath = result.result;
-
+        
 #ifndef FINAL_RELEASE
         if (m_inputFilepath.empty())
             m_inputFilepath = "../../example-1.ac";
@@ -157,23 +216,56 @@ namespace ARC {
                 Vanir::Logger::resetCounters();
                 
                 if (m_doLexerPass) {
+                    Aryiele::SymbolTable::start();
                     Aryiele::Lexer::start();
                     
-                    auto lexerPass = doLexerPass(m_inputFilepath);
+                    Aryiele::ASTContext astContext;
+                    Aryiele::NodeRoot* parserPass = nullptr;
+                    std::unique_ptr<Aryiele::TokenStream> lexerPass;
+                    uint64_t sourceHash = 0;
+                    auto startTime = std::chrono::steady_clock::now();
+                    
+                    // An unchanged file is loaded from its AST cache, it is neither lexed nor parsed.
+                    if (m_doParserPass && m_useASTCache)
+                        parserPass = readASTCache(astContext, sourceHash);
+                    
+                    if (!parserPass) {
+                        // Unless the whole token stream is needed up front (or split between parser threads), the
+                        // parser pulls it from the lexer line by line.
+                        if (m_doParserPass && !m_verboseMode &&
+                            m_lexerMode == Aryiele::LexerMode_SinglePass && m_parserThreadCount == 1) {
+                            if (!Aryiele::getLexer().open(m_inputFilepath, false)) {
+                                LOG_ERROR(m_inputFilepath, ": cannot read file")
+                            }
+                            
+                            lexerPass = std::make_unique<Aryiele::TokenStream>(Aryiele::getLexer());
+                        } else {
+                            lexerPass = std::make_unique<Aryiele::TokenStream>(doLexerPass(m_inputFilepath));
+                        }
+                    }
     
                     ARC_RUN_CHECKERRORS()
     
                     if (m_doParserPass) {
                         Aryiele::Parser::start();
+                        Aryiele::getParser().setThreadCount(m_parserThreadCount);
+                        Aryiele::getParser().setLazyBodies(m_lazyBodies);
                         
-                        auto parserPass = doParserPass(m_inputFilepath, lexerPass);
-    
-                        ARC_RUN_CHECKERRORS()
+                        if (!parserPass) {
+                            parserPass = doParserPass(astContext, m_inputFilepath, *lexerPass);
+                            
+                            ARC_RUN_CHECKERRORS()
+                            
+                            if (m_useASTCache) {
+                                writeASTCache(parserPass, sourceHash,
+                                    std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count());
+                            }
+                        }
     
                         if (m_doCodeGeneratorPass) {
                             Aryiele::CodeGenerator::start(::Vanir::FileSystem::getFilePath(m_inputFilepath));
                             
-                            doCodeGeneratorPass(parserPass);
+                            doCodeGeneratorPass(astContext, parserPass);
     
                             ARC_RUN_CHECKERRORS()
     
@@ -198,6 +290,7 @@ namespace ARC {
                     }
     
                     Aryiele::Lexer::shutdown();
+                    Aryiele::SymbolTable::shutdown();
                 }
             }
         }
@@ -207,47 +300,42 @@ namespace ARC {
         return 0;
     }
     
-    std::vector<Aryiele::LexerToken> ARC::doLexerPass(const std::string& filepath) {
+    std::vector<Aryiele::ParserToken> ARC::doLexerPass(const std::string& filepath) {
         auto lexer = Aryiele::Lexer::getInstancePtr();
         
-        auto lexerTokens = lexer->lex(filepath);
+        lexer->setThreadCount(m_lexerThreadCount);
         
-        for (auto& token : lexerTokens) {
-            if (m_verboseMode) {
-                LOG_VERBOSE("lexer: ", token.content, (!token.content.empty() ? " => " : ""), Aryiele::LexerToken::getTypeName(token.type))
-            }
+        auto startTime = std::chrono::steady_clock::now();
+        auto lexerTokens = lexer->lex(filepath, m_lexerMode);
+        auto elapsedTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        
+        if (m_verboseMode) {
+            LOG_VERBOSE("lexer: ", getLexerModeName(m_lexerMode), ": ",
+                lexerTokens.size(), " tokens in ", elapsedTime * 1000.0, " ms (",
+                static_cast<long long>(lexerTokens.size() / std::max(elapsedTime, 1e-9)), " tokens/s)")
             
-            if (token.type == Aryiele::LexerToken_Unknown) {
-                LOG_ERROR("lexer: unknown token")
+            for (auto& token : lexerTokens) {
+                auto content = lexer->getContent(token);
+                
+                LOG_VERBOSE("lexer: ", content, (!content.empty() ? " => " : ""),
+                    Aryiele::ParserToken::getTypeName(token.type))
             }
         }
         
         return lexerTokens;
     }
     
-    std::shared_ptr<Aryiele::NodeRoot> ARC::doParserPass(const std::string& path,
-        std::vector<Aryiele::LexerToken> lexerTokens) {
+    Aryiele::NodeRoot* ARC::doParserPass(Aryiele::ASTContext& context, const std::string& path,
+        Aryiele::TokenStream& tokens) {
         auto parser = Aryiele::Parser::getInstancePtr();
         
-        auto parserTokens = Aryiele::Parser::convertTokens(std::move(lexerTokens));
-        
-        for (auto& token : parserTokens) {
-            if (m_verboseMode) {
-                LOG_VERBOSE("parser: ", token.content, (!token.content.empty() ? " => " : ""),
-                    Aryiele::ParserToken::getTypeName(token.type))
-            }
-            
-            if (token.type == Aryiele::ParserToken_Unknown) {
-                LOG_ERROR("parser: unknown token")
-            }
-        }
-        
-        auto node = parser->parse(path, parserTokens);
+        auto node = parser->parse(context, path, tokens);
     
         if (m_verboseMode) {
+            LOG_VERBOSE("parser: ", context.getObjectCount(), " nodes in ", context.getReservedSize() / 1024, " KB")
+            
             auto dumpNode = std::make_shared<Aryiele::ParserInformation>(nullptr, "");
         
-            // TODO: Small memory leak coming from here (see valgrind)
             node->dumpAST(dumpNode);
         
             dumpASTInformations(dumpNode, " ");
@@ -258,15 +346,65 @@ namespace ARC {
         return node;
     }
     
-    void ARC::doCodeGeneratorPass(std::shared_ptr<Aryiele::NodeRoot> nodeRoot) {
+    Aryiele::NodeRoot* ARC::readASTCache(Aryiele::ASTContext& context, uint64_t& sourceHash) {
+        auto startTime = std::chrono::steady_clock::now();
+        Aryiele::SourceBuffer source;
+        
+        if (!source.open(m_inputFilepath))
+            return nullptr;
+        
+        sourceHash = Aryiele::ASTCache::hashSource(source.getView());
+        
+        auto filepath = getASTCacheFilepath();
+        auto node = Aryiele::ASTCache::read(context, filepath, sourceHash);
+        auto elapsedTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        
+        if (m_verboseMode) {
+            if (node) {
+                LOG_VERBOSE("ast cache: ", filepath, ": ", context.getObjectCount(), " nodes loaded in ",
+                    elapsedTime * 1000.0, " ms")
+            } else {
+                LOG_VERBOSE("ast cache: ", filepath, ": missing or out of date")
+            }
+        }
+        
+        return node;
+    }
+    
+    void ARC::writeASTCache(Aryiele::NodeRoot* nodeRoot, uint64_t sourceHash, double parseTime) {
+        auto startTime = std::chrono::steady_clock::now();
+        auto filepath = getASTCacheFilepath();
+        
+        if (!Aryiele::ASTCache::write(filepath, sourceHash, nodeRoot)) {
+            if (m_verboseMode) {
+                LOG_VERBOSE("ast cache: ", filepath, ": not written (lazy function bodies or no write access)")
+            }
+            
+            return;
+        }
+        
+        auto elapsedTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        
+        if (m_verboseMode) {
+            LOG_VERBOSE("ast cache: ", filepath, ": lexed and parsed in ", parseTime * 1000.0, " ms, written in ",
+                elapsedTime * 1000.0, " ms")
+        }
+    }
+    
+    std::string ARC::getASTCacheFilepath() {
+        return Vanir::FileSystem::getFilePath(m_outputFilepath.empty() ? m_inputFilepath : m_outputFilepath) + ".ast";
+    }
+    
+    void ARC::doCodeGeneratorPass(Aryiele::ASTContext& context, Aryiele::NodeRoot* nodeRoot) {
         auto codeGenerator = Aryiele::CodeGenerator::getInstancePtr();
         
-        codeGenerator->generateCode(std::move(nodeRoot));
+        codeGenerator->generateCode(context, nodeRoot);
         
         if (::Vanir::Logger::errorCount > 0) {
             LOG_ERROR("code generation failed with ", ::Vanir::Logger::errorCount, " errors")
         } else {
             if (m_verboseMode) {
+                LOG_VERBOSE("constant folder: ", codeGenerator->getEliminatedNodeCount(), " nodes eliminated")
                 LOG_VERBOSE("code generated with success")
             }
             
@@ -431,6 +569,59 @@ namespace ARC {
         }
     }
     
+    void ARC::commandDefineLexerMode(const std::string& s) {
+        auto result = getOptionValue(s);
+        
+        if (!result.empty()) {
+            if (result == "single") {
+                m_lexerMode = Aryiele::LexerMode_SinglePass;
+            }
+            else if (result == "multi") {
+                m_lexerMode = Aryiele::LexerMode_MultiPass;
+            }
+            else if (result == "parallel") {
+                m_lexerMode = Aryiele::LexerMode_Parallel;
+            }
+            else {
+                ULOG_WARNING("arc: unknown lexer mode value: ", s)
+            }
+        }
+    }
+    
+    void ARC::commandDefineLexerThreads(const std::string& s) {
+        auto result = getOptionValue(s);
+        
+        if (!result.empty()) {
+            if (result.find_first_not_of("0123456789") == std::string::npos && result.size() < 4) {
+                m_lexerThreadCount = std::stoul(result);
+            }
+            else {
+                ULOG_WARNING("arc: invalid lexer thread count: ", s)
+            }
+        }
+    }
+    
+    void ARC::commandDefineParserThreads(const std::string& s) {
+        auto result = getOptionValue(s);
+        
+        if (!result.empty()) {
+            if (result.find_first_not_of("0123456789") == std::string::npos && result.size() < 4) {
+                m_parserThreadCount = std::stoul(result);
+            }
+            else {
+                ULOG_WARNING("arc: invalid parser thread count: ", s)
+            }
+        }
+    }
+    
+    void ARC::commandLazyBodies(const std::string& s) {
+        m_lazyBodies = true;
+    }
+    
+    void ARC::commandUseASTCache(const std::string& s) {
+        m_useASTCache = true;
+    }
+    
     void ARC::commandOptionNotFound(const std::string& s) {
         ULOG("arc: unknown command line argument '", s, "'. Try: 'arc --help'")
         ULOG("arc: did you mean '", Vanir::CLI::findClosestOption(s, m_options), "'?")
@@ -0,0 +1,95 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#ifndef ARYIELE_CORE_ARCBENCH_H
+#define ARYIELE_CORE_ARCBENCH_H
+
+#include <Vanir/CLI/CLI.h>
+#include <Aryiele/Common.h>
+#include <Aryiele/Lexer/Lexer.h>
+#include <Aryiele/Lexer/TokenStream.h>
+#include <Aryiele/Parser/Parser.h>
+#include <ARCBench/Utility/Logger.h>
+
+#define ARCBENCH_VERSION "0.0.1"
+
+namespace ARCBench {
+    // Measures the passes of the compiler, each mode checking that the paths it compares agree, exits with 1 when
+    // one of them does not.
+    class ARCBench {
+    public:
+        static int run(int argc, char *argv[]);
+        // Lex the input with both lexers, compare their token streams and report their throughput.
+        static void compareLexerModes(const std::string& path);
+        // Lex a generated file with the single-pass and multi-pass lexers and report the allocations of each.
+        static void countLexerAllocations();
+        static void compareASTLayouts(const std::string& path);
+        // Parse the file again and again, from its tokens and streamed from the lexer, and report the best times.
+        static void benchmarkParser(const std::string& path);
+        // Open the file as a document, insert and remove single spaces at random, and report the latency of the edits.
+        static void replayEdits(const std::string& path);
+        // Parse generated expressions, long and deeply nested, and report the time of each.
+        static void stressParser();
+        // Analyse generated loops and ifs, deeply nested, and report the time of the walks it replaces and its own.
+        static void stressReturnAnalysis();
+        static void commandShowHelp(const std::string& s = "");
+        static void commandShowVersion(const std::string& s = "");
+        static void commandDefineLexerMode(const std::string& s = "");
+        static void commandDefineLexerThreads(const std::string& s = "");
+        static void commandDefineParserThreads(const std::string& s = "");
+        static void commandCompareLexerModes(const std::string& s = "");
+        static void commandCountLexerAllocations(const std::string& s = "");
+        static void commandCompareASTLayouts(const std::string& s = "");
+        static void commandBenchmarkParser(const std::string& s = "");
+        static void commandReplayEdits(const std::string& s = "");
+        static void commandStressParser(const std::string& s = "");
+        static void commandStressReturnAnalysis(const std::string& s = "");
+        static void commandOptionNotFound(const std::string& s = "");
+        static std::string getOptionValue(const std::string& option);
+        // Read the unsigned value of an option into count, false with a warning when it is not a number of at most
+        // maximumSize digits.
+        static bool getOptionCount(const std::string& option, size_t maximumSize, const std::string& name,
+            size_t& count);
+
+    private:
+        static std::vector<Vanir::CLIOption> m_options;
+        static std::string m_inputFilepath;
+        static Aryiele::LexerMode m_lexerMode;
+        static size_t m_lexerThreadCount;
+        static size_t m_parserThreadCount;
+        static bool m_compareLexerModes;
+        static size_t m_allocationLineCount;
+        static bool m_compareASTLayouts;
+        static size_t m_parserBenchmarkCount;
+        static size_t m_editCount;
+        static size_t m_stressOperandCount;
+        static size_t m_stressReturnDepth;
+    };
+
+} /* Namespace ARCBench. */
+
+#endif /* ARYIELE_CORE_ARCBENCH_H. */
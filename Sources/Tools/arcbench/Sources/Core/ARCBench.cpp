@@ -0,0 +1,861 @@
+//==================================================================================//
+//                                                                                  //
+//  Copyright (c) 2019 Hugo Kindel <kindelhugo.pro@gmail.com>                       //
+//                                                                                  //
+//  This file is part of the Aryiele project.                                       //
+//  Licensed under MIT License:                                                     //
+//                                                                                  //
+//  Permission is hereby granted, free of charge, to any person obtaining           //
+//  a copy of this software and associated documentation files (the "Software"),    //
+//  to deal in the Software without restriction, including without limitation       //
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,        //
+//  and/or sell copies of the Software, and to permit persons to whom the           //
+//  Software is furnished to do so, subject to the following conditions:            //
+//                                                                                  //
+//  The above copyright notice and this permission notice shall be included in      //
+//  all copies or substantial portions of the Software.                             //
+//                                                                                  //
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR      //
+//  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,        //
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE     //
+//  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER          //
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,   //
+//  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE   //
+//  SOFTWARE.                                                                       //
+//                                                                                  //
+//==================================================================================//
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <thread>
+#include <Vanir/FileSystem/FileSystem.h>
+#include <Aryiele/Common.h>
+#include <Aryiele/Lexer/Lexer.h>
+#include <Aryiele/Utility/SymbolTable.h>
+#include <Aryiele/Parser/Parser.h>
+#include <Aryiele/Parser/ParserDocument.h>
+#include <Aryiele/AST/FlatAST.h>
+#include <Aryiele/AST/ReturnAnalysis.h>
+#include <Aryiele/AST/Variable.h>
+#include <Aryiele/AST/Nodes/NodeLiteralArray.h>
+#include <Aryiele/AST/Nodes/NodeStatementVariableDeclaration.h>
+#include <ARCBench/Core/ARCBench.h>
+#include <ARCBench/Utility/AllocationCounter.h>
+
+namespace ARCBench {
+    std::vector<Vanir::CLIOption> ARCBench::m_options;
+    std::string ARCBench::m_inputFilepath;
+    Aryiele::LexerMode ARCBench::m_lexerMode = Aryiele::LexerMode_SinglePass;
+    size_t ARCBench::m_lexerThreadCount = 0;
+    size_t ARCBench::m_parserThreadCount = 1;
+    bool ARCBench::m_compareLexerModes = false;
+    size_t ARCBench::m_allocationLineCount = 0;
+    bool ARCBench::m_compareASTLayouts = false;
+    size_t ARCBench::m_parserBenchmarkCount = 0;
+    size_t ARCBench::m_editCount = 0;
+    size_t ARCBench::m_stressOperandCount = 0;
+    size_t ARCBench::m_stressReturnDepth = 0;
+    
+    namespace {
+        const char* getLexerModeName(Aryiele::LexerMode mode) {
+            switch (mode) {
+                case Aryiele::LexerMode_SinglePass:
+                    return "single-pass";
+                case Aryiele::LexerMode_MultiPass:
+                    return "multi-pass";
+                default:
+                    return "parallel";
+            }
+        }
+        
+        double getElapsedTime(std::chrono::steady_clock::time_point startTime) {
+            return std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        }
+        
+        // Lex and parse a file, null when it cannot be parsed.
+        Aryiele::NodeRoot* parseFile(Aryiele::ASTContext& context, const std::string& path) {
+            auto tokens = Aryiele::getLexer().lex(path);
+            Aryiele::TokenStream stream(std::move(tokens));
+            
+            return Aryiele::getParser().parse(context, path, stream);
+        }
+        
+        // Count the nodes of each kind the way FlatAST lays them out, null children included.
+        void countNodeKinds(Aryiele::Node* node, std::vector<size_t>& counts) {
+            if (!node) {
+                counts[Aryiele::Node_Error]++;
+                
+                return;
+            }
+            
+            counts[node->getType()]++;
+            
+            if (node->getType() == Aryiele::Node_StatementVariableDeclaration) {
+                for (auto& variable : static_cast<Aryiele::NodeStatementVariableDeclaration*>(node)->variables)
+                    countNodeKinds(variable->expression, counts);
+            } else if (node->getType() == Aryiele::Node_LiteralArray) {
+                for (auto& element : static_cast<Aryiele::NodeLiteralArray*>(node)->elements)
+                    countNodeKinds(element, counts);
+            } else {
+                for (auto& child : node->children)
+                    countNodeKinds(child, counts);
+            }
+        }
+        
+        void collectNodes(Aryiele::Node* node, std::vector<Aryiele::Node*>& nodes) {
+            if (!node)
+                return;
+            
+            nodes.push_back(node);
+            
+            if (node->getType() == Aryiele::Node_StatementVariableDeclaration) {
+                for (auto& variable : static_cast<Aryiele::NodeStatementVariableDeclaration*>(node)->variables)
+                    collectNodes(variable->expression, nodes);
+            } else if (node->getType() == Aryiele::Node_LiteralArray) {
+                for (auto& element : static_cast<Aryiele::NodeLiteralArray*>(node)->elements)
+                    collectNodes(element, nodes);
+            } else {
+                for (auto& child : node->children)
+                    collectNodes(child, nodes);
+            }
+        }
+    }
+    
+    int ARCBench::run(const int argc, char *argv[]) {
+#ifdef _WIN32
+        FILE* stream;
+        freopen_s(&stream, "CONOUT$", "w+", stdout);
+#endif
+        
+        Vanir::Logger::startNoLog();
+        
+        m_options.emplace_back(
+            std::vector<std::string>({"-h", "--help"}),
+            &ARCBench::commandShowHelp,
+            std::vector<std::string>({"Display this information."}));
+        m_options.emplace_back(
+            std::vector<std::string>({"-V", "--version"}),
+            &ARCBench::commandShowVersion,
+            std::vector<std::string>({"Display version information."}));
+        m_options.emplace_back(
+            std::vector<std::string>({"-l", "--lexer-mode"}),
+            &ARCBench::commandDefineLexerMode,
+            std::vector<std::string>({"Choose the lexer compared to the other one (default is single):"}),
+            Vanir::CLIOptionType_OptionWithValue,
+            "<mode>",
+            std::vector<Vanir::CLIArgument>({
+                Vanir::CLIArgument(
+                    std::vector<std::string>({"single"}),
+                    std::vector<std::string>({"Fused single-pass streaming lexer,", "compared to the multi-pass one."})),
+                Vanir::CLIArgument(
+                    std::vector<std::string>({"multi"}),
+                    std::vector<std::string>({"Legacy seven-pass lexer,", "compared to the single-pass one."})),
+                Vanir::CLIArgument(
+                    std::vector<std::string>({"parallel"}),
+                    std::vector<std::string>({"Single-pass lexer on chunks of the file lexed", "on several threads, also timed from 1 to <n> threads."}))
+            }));
+        m_options.emplace_back(
+            std::vector<std::string>({"-j", "--lexer-threads"}),
+            &ARCBench::commandDefineLexerThreads,
+            std::vector<std::string>({"Use up to <n> threads in the parallel lexer", "(default is every hardware thread)."}),
+            Vanir::CLIOptionType_OptionWithValue,
+            "<n>");
+        m_options.emplace_back(
+            std::vector<std::string>({"-p", "--parser-threads"}),
+            &ARCBench::commandDefineParserThreads,
+            std::vector<std::string>({"Also time the parser from 2 to <n> threads", "(default is 1, 0 is every hardware thread)."}),
+            Vanir::CLIOptionType_OptionWithValue,
+            "<n>");
+        m_options.emplace_back(
+            std::vector<std::string>({"-c", "--lexer-compare"}),
+            &ARCBench::commandCompareLexerModes,
+            std::vector<std::string>({"Lex the input with both lexers, compare their", "token streams and report their throughput."}));
+        m_options.emplace_back(
+            std::vector<std::string>({"-m", "--count-allocations"}),
+            &ARCBench::commandCountLexerAllocations,
+            std::vector<std::string>({"Lex a generated file of <n> lines with both lexers", "and report the allocations of each."}),
+            Vanir::CLIOptionType_OptionWithValue,
+            "<n>");
+        m_options.emplace_back(
+            std::vector<std::string>({"-a", "--ast-compare"}),
+            &ARCBench::commandCompareASTLayouts,
+            std::vector<std::string>({"Copy the AST of the input to the flat layout, compare", "both and report the time of a full walk of each."}));
+        m_options.emplace_back(
+            std::vector<std::string>({"-b", "--bench-parser"}),
+            &ARCBench::commandBenchmarkParser,
+            std::vector<std::string>({"Parse the input <n> times, from its lexed tokens", "and streamed from the lexer, and report the best times."}),
+            Vanir::CLIOptionType_OptionWithValue,
+            "<n>");
+        m_options.emplace_back(
+            std::vector<std::string>({"-e", "--replay-edits"}),
+            &ARCBench::commandReplayEdits,
+            std::vector<std::string>({"Open the input as a document, insert and remove <n> spaces", "at random and report the latency of the edits."}),
+            Vanir::CLIOptionType_OptionWithValue,
+            "<n>");
+        m_options.emplace_back(
+            std::vector<std::string>({"-x", "--stress-parser"}),
+            &ARCBench::commandStressParser,
+            std::vector<std::string>({"Time the parser on generated expressions of <n>", "operands or nesting levels."}),
+            Vanir::CLIOptionType_OptionWithValue,
+            "<n>");
+        m_options.emplace_back(
+            std::vector<std::string>({"-r", "--stress-returns"}),
+            &ARCBench::commandStressReturnAnalysis,
+            std::vector<std::string>({"Time the return-flow analysis on generated loops and ifs", "nested <n> levels deep."}),
+            Vanir::CLIOptionType_OptionWithValue,
+            "<n>");
+        
+        auto result = Vanir::CLI::parse(argc, argv, m_options, false);
+        
+        if (!result.errors.empty()) {
+            LOG_WARNING("command interpretation had ", result.errors.size(), " errors")
+            for (auto e : result.errors) {
+                LOG_WARNING(Vanir::CLIParsingResult::errorToString(e))
+            }
+        }
+        
+        m_inputFilepath = result.result;
+        
+        Vanir::Logger::resetCounters();
+        
+        Aryiele::SymbolTable::start();
+        Aryiele::Lexer::start();
+        Aryiele::Parser::start();
+        
+        if (m_compareLexerModes || m_compareASTLayouts || m_parserBenchmarkCount > 0 || m_editCount > 0) {
+            if (m_inputFilepath.empty()) {
+                LOG_ERROR("no input file")
+            } else if (!Vanir::FileSystem::fileExist(m_inputFilepath)) {
+                LOG_ERROR(m_inputFilepath, ": no such file or directory")
+            } else {
+                if (m_compareLexerModes)
+                    compareLexerModes(m_inputFilepath);
+                
+                if (m_compareASTLayouts)
+                    compareASTLayouts(m_inputFilepath);
+                
+                if (m_parserBenchmarkCount > 0)
+                    benchmarkParser(m_inputFilepath);
+                
+                if (m_editCount > 0)
+                    replayEdits(m_inputFilepath);
+            }
+        }
+        
+        if (m_allocationLineCount > 0)
+            countLexerAllocations();
+        
+        if (m_stressOperandCount > 0)
+            stressParser();
+        
+        if (m_stressReturnDepth > 0)
+            stressReturnAnalysis();
+        
+        Aryiele::Parser::shutdown();
+        Aryiele::Lexer::shutdown();
+        Aryiele::SymbolTable::shutdown();
+        
+        // A measurement whose paths disagree, or which could not run, logged an error.
+        const auto hasFailed = ::Vanir::Logger::errorCount > 0;
+        
+        Vanir::Logger::stop();
+        
+        return hasFailed ? 1 : 0;
+    }
+    
+    void ARCBench::compareLexerModes(const std::string& path) {
+        auto lexer = Aryiele::Lexer::getInstancePtr();
+        auto otherMode = m_lexerMode == Aryiele::LexerMode_SinglePass ?
+            Aryiele::LexerMode_MultiPass : Aryiele::LexerMode_SinglePass;
+        std::vector<std::pair<Aryiele::ParserTokenEnum, std::string>> otherTokens;
+        
+        lexer->setThreadCount(m_lexerThreadCount);
+        
+        // Token contents only live until the next lex: run the other mode first and copy it.
+        {
+            auto startTime = std::chrono::steady_clock::now();
+            auto tokens = lexer->lex(path, otherMode);
+            auto elapsedTime = getElapsedTime(startTime);
+            
+            LOG_INFO("lexer: ", getLexerModeName(otherMode), ": ", tokens.size(), " tokens in ", elapsedTime * 1000.0,
+                " ms (", static_cast<long long>(tokens.size() / std::max(elapsedTime, 1e-9)), " tokens/s)")
+            
+            otherTokens.reserve(tokens.size());
+            
+            for (auto& token : tokens)
+                otherTokens.emplace_back(Aryiele::ParserTokenEnum(token.type), std::string(lexer->getContent(token)));
+        }
+        
+        // Scaling of the parallel lexer, doubling the threads up to the requested count.
+        if (m_lexerMode == Aryiele::LexerMode_Parallel) {
+            auto maximumThreadCount = m_lexerThreadCount != 0 ? m_lexerThreadCount :
+                std::max<size_t>(std::thread::hardware_concurrency(), 1);
+            auto singleThreadTime = 0.0;
+            
+            for (size_t threadCount = 1;; threadCount = std::min(threadCount * 2, maximumThreadCount)) {
+                lexer->setThreadCount(threadCount);
+                
+                auto startTime = std::chrono::steady_clock::now();
+                auto tokens = lexer->lex(path, m_lexerMode);
+                auto elapsedTime = getElapsedTime(startTime);
+                
+                if (threadCount == 1)
+                    singleThreadTime = elapsedTime;
+                
+                if (tokens.size() != otherTokens.size()) {
+                    LOG_ERROR("lexer: parallel: ", threadCount, " threads: ", tokens.size(), " tokens instead of ",
+                        otherTokens.size())
+                }
+                
+                LOG_INFO("lexer: parallel: ", threadCount, " threads: ", tokens.size(), " tokens in ",
+                    elapsedTime * 1000.0, " ms (x", singleThreadTime / std::max(elapsedTime, 1e-9), ")")
+                
+                if (threadCount == maximumThreadCount)
+                    break;
+            }
+            
+            lexer->setThreadCount(m_lexerThreadCount);
+        }
+        
+        auto startTime = std::chrono::steady_clock::now();
+        auto tokens = lexer->lex(path, m_lexerMode);
+        auto elapsedTime = getElapsedTime(startTime);
+        
+        LOG_INFO("lexer: ", getLexerModeName(m_lexerMode), ": ", tokens.size(), " tokens in ", elapsedTime * 1000.0,
+            " ms (", static_cast<long long>(tokens.size() / std::max(elapsedTime, 1e-9)), " tokens/s)")
+        
+        auto count = std::min(tokens.size(), otherTokens.size());
+        auto i = size_t(0);
+        
+        while (i < count && tokens[i].type == otherTokens[i].first && lexer->getContent(tokens[i]) == otherTokens[i].second)
+            i++;
+        
+        if (i == count && tokens.size() == otherTokens.size()) {
+            LOG_INFO("lexer: token streams are identical")
+        } else if (i == count) {
+            LOG_ERROR("lexer: token streams differ in length (", tokens.size(), " and ", otherTokens.size(), ")")
+        } else {
+            LOG_ERROR("lexer: token streams differ at token ", i, ": '", lexer->getContent(tokens[i]), "' (",
+                Aryiele::ParserToken::getTypeName(tokens[i].type), ") and '", otherTokens[i].second, "' (",
+                Aryiele::ParserToken::getTypeName(otherTokens[i].first), ")")
+        }
+    }
+    
+    void ARCBench::countLexerAllocations() {
+        const auto n = m_allocationLineCount;
+        const auto path = (std::filesystem::temp_directory_path() / "arcbench-allocations.ac").string();
+        
+        // Declarations mixing every kind of token, with escaped strings and decimals the lexer rewrites.
+        {
+            std::ofstream file(path, std::ios::binary);
+            
+            for (size_t i = 0; i < n; i++) {
+                if (i % 1000 == 0)
+                    file << (i == 0 ? "" : "    return 0;\n}\n") << "func f" << i / 1000 << "(): Int32 {\n";
+                
+                switch (i % 4) {
+                    case 0:
+                        file << "    var a" << i << ": Int32 = (" << i << " + 7) * 3 - " << i % 10 << "; // a" << i
+                            << "\n";
+                        break;
+                    case 1:
+                        file << "    var s" << i << ": String = \"line\\t" << i << "\\n\";\n";
+                        break;
+                    case 2:
+                        file << "    var d" << i << ": Double = " << i << ".25 / 2.0 + a" << i - 2 << ";\n";
+                        break;
+                    default:
+                        file << "    if a" << i - 3 << " >= " << i << " && !false { a" << i - 3 << " = 0; }\n";
+                        break;
+                }
+            }
+            
+            file << "    return 0;\n}\n";
+        }
+        
+        auto lexer = Aryiele::Lexer::getInstancePtr();
+        
+        for (auto mode : { Aryiele::LexerMode_SinglePass, Aryiele::LexerMode_MultiPass }) {
+            // Each mode interns the identifiers again, an allocation for each of them.
+            Aryiele::SymbolTable::shutdown();
+            Aryiele::SymbolTable::start();
+            
+            auto allocationCount = getAllocationCount();
+            auto tokens = lexer->lex(path, mode);
+            
+            allocationCount = getAllocationCount() - allocationCount;
+            
+            LOG_INFO("lexer: ", getLexerModeName(mode), ": ", n, " lines, ", tokens.size(), " tokens, ",
+                allocationCount, " allocations (", Aryiele::getSymbolTable().getSize() - Aryiele::Symbol_Predefined,
+                " identifiers interned)")
+        }
+        
+        remove(path.c_str());
+    }
+    
+    void ARCBench::compareASTLayouts(const std::string& path) {
+        const auto walkCount = 10;
+        const auto kindCount = static_cast<size_t>(Aryiele::Node_StatementWhile) + 1;
+        
+        Aryiele::ASTContext context;
+        auto nodeRoot = parseFile(context, path);
+        
+        if (!nodeRoot) {
+            LOG_ERROR("parser: ", path, ": cannot parse file")
+            
+            return;
+        }
+        
+        auto startTime = std::chrono::steady_clock::now();
+        Aryiele::FlatAST flatAST;
+        
+        flatAST.build(nodeRoot);
+        
+        LOG_INFO("parser: flat AST: ", flatAST.getSize(), " nodes built in ", getElapsedTime(startTime) * 1000.0, " ms")
+        
+        std::vector<size_t> treeCounts(kindCount);
+        std::vector<size_t> flatCounts(kindCount);
+        auto treeTime = 0.0;
+        auto flatTime = 0.0;
+        
+        // Best of several walks, each counting the nodes of every kind.
+        for (auto i = 0; i < walkCount; i++) {
+            std::fill(treeCounts.begin(), treeCounts.end(), 0);
+            std::fill(flatCounts.begin(), flatCounts.end(), 0);
+            
+            startTime = std::chrono::steady_clock::now();
+            countNodeKinds(nodeRoot, treeCounts);
+            
+            auto middleTime = std::chrono::steady_clock::now();
+            
+            for (auto kind : flatAST.getKinds())
+                flatCounts[kind]++;
+            
+            auto endTime = std::chrono::steady_clock::now();
+            auto elapsedTreeTime = std::chrono::duration<double>(middleTime - startTime).count();
+            auto elapsedFlatTime = std::chrono::duration<double>(endTime - middleTime).count();
+            
+            treeTime = i == 0 ? elapsedTreeTime : std::min(treeTime, elapsedTreeTime);
+            flatTime = i == 0 ? elapsedFlatTime : std::min(flatTime, elapsedFlatTime);
+        }
+        
+        if (treeCounts == flatCounts) {
+            LOG_INFO("parser: node tree and flat AST are identical")
+        } else {
+            LOG_ERROR("parser: node tree and flat AST differ")
+        }
+        
+        LOG_INFO("parser: walk: node tree ", treeTime * 1000.0, " ms, flat AST ", flatTime * 1000.0, " ms (x",
+            treeTime / std::max(flatTime, 1e-9), ")")
+    }
+    
+    void ARCBench::benchmarkParser(const std::string& path) {
+        auto parser = Aryiele::Parser::getInstancePtr();
+        auto lexer = Aryiele::Lexer::getInstancePtr();
+        auto tokens = lexer->lex(path);
+        auto streamedTime = 0.0;
+        
+        // Every parse must build as many nodes as the first one, whatever the tokens come from.
+        size_t nodeCount = 0;
+        
+        const auto checkNodeCount = [&](const Aryiele::ASTContext& context, const char* name) {
+            if (nodeCount == 0)
+                nodeCount = context.getObjectCount();
+            else if (context.getObjectCount() != nodeCount) {
+                LOG_ERROR("parser: ", name, ": ", context.getObjectCount(), " nodes instead of ", nodeCount)
+            }
+        };
+        
+        // Best time of the parses of the lexed tokens.
+        const auto timeParse = [&](const char* name) {
+            auto bestTime = 0.0;
+            
+            for (size_t i = 0; i < m_parserBenchmarkCount; i++) {
+                Aryiele::ASTContext context;
+                Aryiele::TokenStream stream(tokens.data(), tokens.data() + tokens.size(),
+                    tokens.empty() ? 0 : tokens.back().offset);
+                
+                auto startTime = std::chrono::steady_clock::now();
+                
+                parser->parse(context, path, stream);
+                
+                auto elapsedTime = getElapsedTime(startTime);
+                
+                bestTime = i == 0 ? elapsedTime : std::min(bestTime, elapsedTime);
+                
+                checkNodeCount(context, name);
+            }
+            
+            return bestTime;
+        };
+        
+        parser->setThreadCount(1);
+        
+        const auto replayedTime = timeParse("replayed");
+        
+        for (size_t i = 0; i < m_parserBenchmarkCount; i++) {
+            Aryiele::ASTContext context;
+            
+            auto startTime = std::chrono::steady_clock::now();
+            
+            lexer->open(path, false);
+            
+            Aryiele::TokenStream stream(*lexer);
+            
+            parser->parse(context, path, stream);
+            
+            auto elapsedTime = getElapsedTime(startTime);
+            
+            streamedTime = i == 0 ? elapsedTime : std::min(streamedTime, elapsedTime);
+            
+            checkNodeCount(context, "streamed");
+        }
+        
+        LOG_INFO("parser: benchmark: ", tokens.size(), " tokens, parsed in ", replayedTime * 1000.0, " ms (",
+            static_cast<long long>(tokens.size() / std::max(replayedTime, 1e-9)), " tokens/s), lexed and parsed in ",
+            streamedTime * 1000.0, " ms when streamed")
+        
+        // Scaling of the parallel parser, doubling the threads up to the requested count.
+        if (m_parserThreadCount != 1) {
+            auto maximumThreadCount = m_parserThreadCount != 0 ? m_parserThreadCount :
+                std::max<size_t>(std::thread::hardware_concurrency(), 1);
+            
+            for (size_t threadCount = 2;; threadCount = std::min(threadCount * 2, maximumThreadCount)) {
+                parser->setThreadCount(threadCount);
+                
+                const auto elapsedTime = timeParse("parallel");
+                
+                LOG_INFO("parser: parallel: ", threadCount, " threads: ", elapsedTime * 1000.0, " ms (x",
+                    replayedTime / std::max(elapsedTime, 1e-9), ")")
+                
+                if (threadCount >= maximumThreadCount)
+                    break;
+            }
+        }
+        
+        parser->setThreadCount(1);
+    }
+    
+    void ARCBench::replayEdits(const std::string& path) {
+        std::string source;
+        
+        {
+            std::ifstream file(path, std::ios::binary);
+            
+            source.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+        
+        // A space typed before another one or a line break keeps the file valid, each is removed right after.
+        std::vector<size_t> offsets;
+        
+        for (size_t i = 0; i < source.size(); i++) {
+            if (source[i] == ' ' || source[i] == '\n')
+                offsets.push_back(i);
+        }
+        
+        if (offsets.empty()) {
+            LOG_ERROR("document: ", path, ": no space to edit")
+            
+            return;
+        }
+        
+        Aryiele::ParserDocument document;
+        auto startTime = std::chrono::steady_clock::now();
+        
+        if (!document.open(path)) {
+            LOG_ERROR("document: ", path, ": cannot open file")
+            
+            return;
+        }
+        
+        LOG_INFO("document: ", document.getTokens().size(), " tokens opened in ", getElapsedTime(startTime) * 1000.0,
+            " ms")
+        
+        const auto tokenCount = document.getTokens().size();
+        std::mt19937 random(0);
+        std::vector<double> latencies;
+        size_t reparsedCount = 0;
+        
+        latencies.reserve(m_editCount * 2);
+        
+        for (size_t i = 0; i < m_editCount; i++) {
+            const auto offset = offsets[random() % offsets.size()];
+            
+            for (auto& edit : { Aryiele::SourceEdit { offset, 0, " " }, Aryiele::SourceEdit { offset, 1, "" } }) {
+                startTime = std::chrono::steady_clock::now();
+                
+                document.edit(edit);
+                
+                latencies.push_back(getElapsedTime(startTime));
+                reparsedCount += document.getReparsedCount();
+            }
+        }
+        
+        if (document.getTokens().size() != tokenCount) {
+            LOG_ERROR("document: ", document.getTokens().size(), " tokens after the edits instead of ", tokenCount)
+        }
+        
+        std::sort(latencies.begin(), latencies.end());
+        
+        const auto getPercentile = [&](size_t percent) {
+            return latencies[std::min(latencies.size() * percent / 100, latencies.size() - 1)] * 1000.0;
+        };
+        
+        LOG_INFO("document: ", latencies.size(), " edits: p50 ", getPercentile(50), " ms, p90 ", getPercentile(90),
+            " ms, p99 ", getPercentile(99), " ms, max ", latencies.back() * 1000.0, " ms (",
+            static_cast<double>(reparsedCount) / latencies.size(), " declarations parsed again per edit)")
+    }
+    
+    void ARCBench::stressParser() {
+        const auto n = m_stressOperandCount;
+        const auto path = (std::filesystem::temp_directory_path() / "arcbench-stress.ac").string();
+        const char* operators[] = { " + ", " - ", " * ", " / ", " % ", " < ", " == ", " && " };
+        
+        std::vector<std::pair<std::string, std::string>> expressions(6);
+        
+        expressions[0].first = "long expression";
+        expressions[1].first = "nested parentheses";
+        expressions[2].first = "right nested operations";
+        expressions[3].first = "assignment chain";
+        expressions[4].first = "ternary chain";
+        expressions[5].first = "prefix chain";
+        
+        for (size_t i = 1; i < n; i++) {
+            expressions[0].second += std::to_string(i % 9 + 1) + operators[i % std::size(operators)];
+            expressions[1].second += "(";
+            expressions[2].second += "(1 + ";
+            expressions[3].second += "a = ";
+            expressions[4].second += "a ? 1 : ";
+            expressions[5].second += "! ";
+        }
+        
+        expressions[0].second += "1";
+        expressions[1].second += "1" + std::string(n - 1, ')');
+        expressions[2].second += "1" + std::string(n - 1, ')');
+        expressions[3].second += "1";
+        expressions[4].second += "0";
+        expressions[5].second += "a";
+        
+        for (auto& expression : expressions) {
+            {
+                std::ofstream file(path, std::ios::binary);
+                
+                file << "func main(): Int32 {\n    var a: Int32 = 1;\n    a = " << expression.second <<
+                    ";\n    return a;\n}\n";
+            }
+            
+            auto tokens = Aryiele::getLexer().lex(path);
+            auto tokenCount = tokens.size();
+            
+            Aryiele::ASTContext context;
+            Aryiele::TokenStream stream(std::move(tokens));
+            
+            const auto errorCount = ::Vanir::Logger::errorCount;
+            auto startTime = std::chrono::steady_clock::now();
+            
+            auto nodeRoot = Aryiele::getParser().parse(context, path, stream);
+            
+            auto elapsedTime = getElapsedTime(startTime);
+            
+            // Every expression is valid, whatever its size.
+            if (!nodeRoot || ::Vanir::Logger::errorCount != errorCount) {
+                LOG_ERROR("parser: ", expression.first, ": cannot parse ", n, " operands")
+                
+                continue;
+            }
+            
+            LOG_INFO("parser: ", expression.first, ": ", tokenCount, " tokens, ", context.getObjectCount(),
+                " nodes in ", elapsedTime * 1000.0, " ms (", static_cast<long long>(tokenCount / std::max(elapsedTime, 1e-9)),
+                " tokens/s)")
+        }
+        
+        remove(path.c_str());
+    }
+    
+    void ARCBench::stressReturnAnalysis() {
+        const auto n = m_stressReturnDepth;
+        const auto walkCount = 10;
+        const auto path = (std::filesystem::temp_directory_path() / "arcbench-stress-returns.ac").string();
+        
+        {
+            std::ofstream file(path, std::ios::binary);
+            
+            file << "func main(): Int32 {\n    var a: Int32 = 0;\n";
+            
+            for (size_t i = 0; i < n; i++) {
+                file << "for i" << i << " = 0 while i" << i << " < 2 {\n";
+                file << "if a < " << i << " {\n";
+            }
+            
+            file << "return a;\n";
+            
+            for (size_t i = 0; i < n; i++)
+                file << "} else {\na = a + 1;\n}\n}\n";
+            
+            file << "    return a;\n}\n";
+        }
+        
+        Aryiele::ASTContext context;
+        auto nodeRoot = parseFile(context, path);
+        
+        remove(path.c_str());
+        
+        if (!nodeRoot) {
+            LOG_ERROR("return analysis: cannot parse ", n, " levels")
+            
+            return;
+        }
+        
+        std::vector<Aryiele::Node*> nodes;
+        
+        collectNodes(nodeRoot, nodes);
+        
+        // The code generator asks about every statement and ternary it generates: each node is asked about once,
+        // walking its subtree again or reading the bit of a single analysis.
+        std::vector<bool> walkedResults(nodes.size());
+        std::vector<bool> analyzedResults(nodes.size());
+        auto walkTime = 0.0;
+        auto analysisTime = 0.0;
+        
+        for (auto i = 0; i < walkCount; i++) {
+            auto startTime = std::chrono::steady_clock::now();
+            
+            for (size_t j = 0; j < nodes.size(); j++)
+                walkedResults[j] = Aryiele::ReturnAnalysis::walk(nodes[j]);
+            
+            auto middleTime = std::chrono::steady_clock::now();
+            
+            Aryiele::ReturnAnalysis::analyze(nodeRoot);
+            
+            for (size_t j = 0; j < nodes.size(); j++)
+                analyzedResults[j] = nodes[j]->isReturning;
+            
+            auto endTime = std::chrono::steady_clock::now();
+            auto elapsedWalkTime = std::chrono::duration<double>(middleTime - startTime).count();
+            auto elapsedAnalysisTime = std::chrono::duration<double>(endTime - middleTime).count();
+            
+            walkTime = i == 0 ? elapsedWalkTime : std::min(walkTime, elapsedWalkTime);
+            analysisTime = i == 0 ? elapsedAnalysisTime : std::min(analysisTime, elapsedAnalysisTime);
+        }
+        
+        if (walkedResults != analyzedResults) {
+            LOG_ERROR("return analysis: walks and analysis differ")
+        }
+        
+        LOG_INFO("return analysis: ", n, " levels, ", nodes.size(), " nodes: walks ", walkTime * 1000.0,
+            " ms, analysis ", analysisTime * 1000.0, " ms (x", walkTime / std::max(analysisTime, 1e-9), ")")
+    }
+    
+    void ARCBench::commandShowHelp(const std::string& s) {
+        LOG("Usage: arcbench [options] [file]")
+        LOG("")
+        
+        auto help = Vanir::CLI::getOptionsDescriptionList(m_options);
+        
+        for (auto& hLine : help) {
+            LOG(hLine)
+        }
+    }
+    
+    void ARCBench::commandShowVersion(const std::string& s) {
+        LOG("arcbench (Aryiele Compiler Benchmarks) ", ARCBENCH_VERSION)
+    }
+    
+    void ARCBench::commandDefineLexerMode(const std::string& s) {
+        auto result = getOptionValue(s);
+        
+        if (!result.empty()) {
+            if (result == "single") {
+                m_lexerMode = Aryiele::LexerMode_SinglePass;
+            }
+            else if (result == "multi") {
+                m_lexerMode = Aryiele::LexerMode_MultiPass;
+            }
+            else if (result == "parallel") {
+                m_lexerMode = Aryiele::LexerMode_Parallel;
+            }
+            else {
+                LOG_WARNING("unknown lexer mode value: ", s)
+            }
+        }
+    }
+    
+    void ARCBench::commandDefineLexerThreads(const std::string& s) {
+        getOptionCount(s, 3, "lexer thread count", m_lexerThreadCount);
+    }
+    
+    void ARCBench::commandDefineParserThreads(const std::string& s) {
+        getOptionCount(s, 3, "parser thread count", m_parserThreadCount);
+    }
+    
+    void ARCBench::commandCompareLexerModes(const std::string& s) {
+        m_compareLexerModes = true;
+    }
+    
+    void ARCBench::commandCountLexerAllocations(const std::string& s) {
+        getOptionCount(s, 8, "line count", m_allocationLineCount);
+    }
+    
+    void ARCBench::commandCompareASTLayouts(const std::string& s) {
+        m_compareASTLayouts = true;
+    }
+    
+    void ARCBench::commandBenchmarkParser(const std::string& s) {
+        getOptionCount(s, 6, "benchmark iteration count", m_parserBenchmarkCount);
+    }
+    
+    void ARCBench::commandReplayEdits(const std::string& s) {
+        getOptionCount(s, 7, "edit count", m_editCount);
+    }
+    
+    void ARCBench::commandStressParser(const std::string& s) {
+        getOptionCount(s, 9, "operand count", m_stressOperandCount);
+    }
+    
+    void ARCBench::commandStressReturnAnalysis(const std::string& s) {
+        getOptionCount(s, 5, "nesting depth", m_stressReturnDepth);
+    }
+    
+    void ARCBench::commandOptionNotFound(const std::string& s) {
+        LOG("arcbench: unknown command line argument '", s, "'. Try: 'arcbench --help'")
+        LOG("arcbench: did you mean '", Vanir::CLI::findClosestOption(s, m_options), "'?")
+    }
+    
+    std::string ARCBench::getOptionValue(const std::string &option) {
+        auto optionName = option.substr(0, option.find('=') + 1);
+        auto result = option.substr(option.find('=') + 1);
+        
+        if (result.empty()) {
+            LOG_WARNING("empty value after option '", optionName, "'")
+            
+            return std::string();
+        }
+        else {
+            return result;
+        }
+    }
+    
+    bool ARCBench::getOptionCount(const std::string& option, size_t maximumSize, const std::string& name,
+        size_t& count) {
+        auto result = getOptionValue(option);
+        
+        if (result.empty())
+            return false;
+        
+        if (result.find_first_not_of("0123456789") != std::string::npos || result.size() > maximumSize) {
+            LOG_WARNING("invalid ", name, ": ", option)
+            
+            return false;
+        }
+        
+        count = std::stoul(result);
+        
+        return true;
+    }
+    
+} /* Namespace ARCBench. */